@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+namespace facebook::velox::common{
+
+/// Collects the join keys of a hash join build side for a dynamic IN-list
+/// filter on the probe side. Batches may be added from several threads at
+/// once. The builder tracks min, max and the number of distinct keys; the
+/// keys themselves are kept until there are more than 'maxValues' distinct
+/// ones, after which only a Bloom filter is maintained. kind() then picks the
+/// cheapest filter for what was seen, see createBigintValuesTVL( builder ).
+   class BigintValuesBuilder{
+      public:
+         enum class Kind{
+            /// No keys, nothing passes.
+            kEmpty,
+            /// The keys are exactly [min, max].
+            kRange,
+            /// Dense keys, one bit per value in [min, max].
+            kBitmask,
+            kHashTable,
+            /// Too many keys to keep, false positives are possible.
+            kBloomFilter, };
+
+         /// A bitmask over [min, max] is used while it takes at most this
+         /// many bits per distinct key, a few words like a hash table entry,
+         /// and at most kMaxBitmaskBits in total.
+         static constexpr int64_t kMaxBitmaskBitsPerValue = 4*64;
+         static constexpr int64_t kMaxBitmaskBits = 8LL<<20;
+
+         /// Multiplier of the Bloom filter hash. The top bits of key *
+         /// kBloomMultiplier select the word, the 18 bits below them select
+         /// three bits of the word. Only the high bits of the product depend
+         /// on all bits of the key.
+         static constexpr uint64_t kBloomMultiplier = 0x9E3779B97F4A7C15ULL;
+
+         /// @param maxValues Largest number of distinct keys kept exactly.
+         /// @param bloomBytes Size of the Bloom filter used past maxValues,
+         /// rounded up to a power of two.
+         explicit BigintValuesBuilder( int64_t maxValues = 100'000, int64_t bloomBytes = 4<<20 );
+
+         /// Adds a batch of keys. Thread safe.
+         void add( const int64_t * keys, int32_t size );
+
+         /// The accessors below must not run concurrently with add().
+         Kind kind( ) const;
+
+         int64_t min( ) const{
+            return min_.load( std::memory_order_relaxed );
+         }
+
+         int64_t max( ) const{
+            return max_.load( std::memory_order_relaxed );
+         }
+
+         /// Exact number of distinct keys while they are kept, estimated from
+         /// the fill of the Bloom filter afterwards.
+         int64_t distinctCount( ) const;
+
+         /// The distinct keys in ascending order, empty for kBloomFilter.
+         std::vector< int64_t > values( ) const;
+
+         /// Bloom filter words, a power of two of them. Empty unless kind()
+         /// is kBloomFilter.
+         std::vector< uint64_t > bloomFilter( ) const;
+
+         /// Returns the word and the three bits a key sets in a Bloom filter
+         /// of 1 << log2Words words.
+         static uint64_t bloomWord( int64_t key, int32_t log2Words ){
+            return ( static_cast< uint64_t >( key )*kBloomMultiplier )>>( 64-log2Words );
+         }
+
+         static uint64_t bloomBits( int64_t key, int32_t log2Words ){
+            auto const hash = ( static_cast< uint64_t >( key )*kBloomMultiplier )>>bloomBitsShift( log2Words );
+            return ( 1ULL<<( hash&63 ) )|( 1ULL<<( ( hash>>6 )&63 ) )|( 1ULL<<( ( hash>>12 )&63 ) );
+         }
+
+         /// Position of the 18 bits of the product bloomBits takes.
+         static int32_t bloomBitsShift( int32_t log2Words ){
+            return 64-log2Words-18;
+         }
+
+      private:
+         static constexpr int32_t kShards = 16;
+
+         struct alignas( 64 ) Shard{
+            std::mutex mutex;
+            std::unordered_set< int64_t > values;
+         };
+
+         // Moves all kept keys into the Bloom filter. Called with every shard
+         // locked.
+         void overflow( );
+
+         void addToBloomFilter( const int64_t * keys, int32_t size );
+
+         const int64_t maxValues_;
+         const int32_t log2BloomWords_;
+         std::atomic< int64_t > min_;
+         std::atomic< int64_t > max_;
+         std::atomic< int64_t > distinct_{ 0 };
+         // Set with all shards locked, read with one shard locked.
+         bool overflowed_ = false;
+         std::unique_ptr< Shard[] > shards_;
+         std::unique_ptr< std::atomic< uint64_t >[] > bloom_;
+   };
+
+} // namespace facebook::velox::common
@@ -70,7 +70,46 @@ inline void setBit(T* bits, int32_t idx, bool value) {
   value ? setBit(bits, idx) : clearBit(bits, idx);
 }
 
+// Ranges of at least this many bits are handed to the vectorized kernels in
+// BitUtilTVL.h compiled for the host, see detail::andRangeTVL and friends.
+constexpr int32_t kMinTVLBits = 2048;
+
+namespace detail {
+// Defined in BitUtil.cpp, dispatch to the BitsTVLKernels of bestTVLTarget().
+void andRangeTVL(
+    bool negate,
+    uint64_t* target,
+    const uint64_t* left,
+    const uint64_t* right,
+    int32_t begin,
+    int32_t end);
+void orRangeTVL(
+    bool negate,
+    uint64_t* target,
+    const uint64_t* left,
+    const uint64_t* right,
+    int32_t begin,
+    int32_t end);
+void negateTVL(char* bits, int32_t size);
+int32_t toIndicesTVL(
+    const uint64_t* bits,
+    int32_t begin,
+    int32_t end,
+    int32_t* indices);
+int32_t countBitsTVL(const uint64_t* bits, int32_t begin, int32_t end);
+void copyBitsTVL(
+    const uint64_t* source,
+    uint64_t sourceOffset,
+    uint64_t* target,
+    uint64_t targetOffset,
+    uint64_t numBits);
+} // namespace detail
+
 inline void negate(char* bits, int32_t size) {
+  if (size >= kMinTVLBits) {
+    detail::negateTVL(bits, size);
+    return;
+  }
   int32_t i = 0;
   for (; i + 64 <= size; i += 64) {
     auto wordPtr = reinterpret_cast<uint64_t*>(bits + (i / 8));
@@ -253,6 +292,9 @@ inline void fillBits(uint64_t* bits, int32_t begin, int32_t end, bool value) {
 }
 
 inline int32_t countBits(const uint64_t* bits, int32_t begin, int32_t end) {
+  if (end - begin >= kMinTVLBits) {
+    return detail::countBitsTVL(bits, begin, end);
+  }
   int32_t count = 0;
   forEachWord(
       begin,
@@ -369,6 +411,19 @@ forEachSetBit(const uint64_t* bits, int32_t begin, int32_t end, Callable func) {
   forEachBit(bits, begin, end, true, func);
 }
 
+/// Writes the positions of the set bits in [begin, end) to 'indices' in
+/// ascending order and returns their number. 'indices' must have room for
+/// end - begin values. Turns a filter bitmap into a selection vector.
+inline int32_t
+toIndices(const uint64_t* bits, int32_t begin, int32_t end, int32_t* indices) {
+  if (end - begin >= kMinTVLBits) {
+    return detail::toIndicesTVL(bits, begin, end, indices);
+  }
+  int32_t count = 0;
+  forEachSetBit(bits, begin, end, [&](int32_t idx) { indices[count++] = idx; });
+  return count;
+}
+
 /// Invokes a function for each unset bit.
 template <typename Callable>
 inline void forEachUnsetBit(
@@ -482,6 +537,10 @@ inline void andRange(
     const uint64_t* right,
     int32_t begin,
     int32_t end) {
+  if (end - begin >= kMinTVLBits) {
+    detail::andRangeTVL(negate, target, left, right, begin, end);
+    return;
+  }
   forEachWord(
       begin,
       end,
@@ -501,6 +560,10 @@ inline void orRange(
     const uint64_t* right,
     int32_t begin,
     int32_t end) {
+  if (end - begin >= kMinTVLBits) {
+    detail::orRangeTVL(negate, target, left, right, begin, end);
+    return;
+  }
   forEachWord(
       begin,
       end,
@@ -764,6 +827,27 @@ storeBits(uint64_t* target, uint64_t offset, uint64_t word, uint8_t numBits) {
         (*lastByteAddress & ~lastByteMask) | (word >> (kBitSize - bitOffset));
   }
 }
+
+// Fetches 'numBits' bits of data, from data starting at lastBit -
+// numbits (inclusive) and ending at lastBit (exclusive). 'lastBit' is
+// updated to be the bit offset of the lowest returned bit. Successive
+// calls will go through 'data' from high to low in consecutive chunks
+// of up to 64 bits each.
+inline uint64_t
+getBitField(const char* data, int32_t numBits, int32_t& lastBit) {
+  int32_t highByte = lastBit / 8;
+  int32_t lowByte = (lastBit - numBits) / 8;
+  int32_t lowBit = (lastBit - numBits) & 7;
+  uint64_t bits = *reinterpret_cast<const uint64_t*>(data + lowByte) >> lowBit;
+  if (numBits + lowBit > 64) {
+    auto fromNextByte = numBits + lowBit - 64;
+    uint8_t lastBits = *reinterpret_cast<const uint8_t*>(data + highByte) &
+        bits::lowMask(fromNextByte);
+    bits |= static_cast<uint64_t>(lastBits) << (64 - lowBit);
+  }
+  lastBit -= numBits;
+  return bits;
+}
 } // namespace detail
 
 // Copies a string of bits between locations in memory given by an
@@ -774,6 +858,10 @@ inline void copyBits(
     uint64_t* target,
     uint64_t targetOffset,
     uint64_t numBits) {
+  if (numBits >= kMinTVLBits) {
+    detail::copyBitsTVL(source, sourceOffset, target, targetOffset, numBits);
+    return;
+  }
   uint64_t i = 0;
   for (; i + 64 <= numBits; i += 64) {
     uint64_t word = detail::loadBits<uint64_t>(source, i + sourceOffset, 64);
@@ -803,7 +891,8 @@ inline void copyBits(
 // positions of 'target' where 'targetMask' is 0 are 0. A sample use
 // case is reading a column of boolean with nulls. The booleans
 // from the column get inserted into the places given by ones in the
-// present bitmap.
+// present bitmap. Dispatches to the BitsTVLKernels of bestTVLTarget(),
+// which deposit with pdep on BMI2 hosts and a byte table elsewhere.
 void scatterBits(
     int32_t numSource,
     int32_t numTarget,
@@ -811,6 +900,18 @@ void scatterBits(
     const uint64_t* targetMask,
     char* target);
 
+// Sets bit i of 'result' to bit indices[i] of 'bits' for i in [0, size) if
+// bit i of 'selection' is set, and returns the number of bits set.
+// 'selection' may be nullptr. Every index must be below 'numBits'. Dispatches
+// to the BitsTVLKernels of bestTVLTarget(), see simd::gatherBits.
+int32_t gatherBits(
+    const uint64_t* bits,
+    int32_t numBits,
+    const int32_t* indices,
+    int32_t size,
+    const uint64_t* selection,
+    uint64_t* result);
+
 } // namespace bits
 } // namespace velox
 } // namespace facebook
@@ -0,0 +1,295 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+// Vectorized counterparts of the bitmap helpers in BitUtil.h. Like HashTVL.h
+// this must only be included after TVL_TARGET_PUSH in the per-ISA translation
+// units (see FilterTVLDispatch.h).
+
+#include <algorithm>
+#include <cstdint>
+
+#include "BitUtil.h"
+#include "tvl/tvlintrin.hpp"
+
+namespace facebook {
+namespace velox {
+namespace bits {
+
+// Same as bits::toIndices(bits, begin, end, indices). Every aligned group of
+// 16 bits is expanded with one tvl::bit_indices, which looks up the positions
+// per byte (or compresses them on AVX-512) instead of a branch per set bit.
+// Words with few set bits are walked with __builtin_ctzll, which is cheaper
+// than four table lookups.
+template <tvl::VectorProcessingStyle Vec>
+int32_t
+toIndices(const uint64_t* bits, int32_t begin, int32_t end, int32_t* indices) {
+  constexpr int32_t kGroup = 16;
+  // Words with at most this many set bits are cheaper to walk bit by bit.
+  constexpr int32_t kSparseBits = 4;
+  int32_t const first = roundUp(begin, kGroup);
+  int32_t const last = end & ~(kGroup - 1);
+  if (first >= last) {
+    return toIndices(bits, begin, end, indices);
+  }
+  // bit_indices writes 16 entries. The groups lie within [begin, end), so
+  // the positions written never reach past indices + end - begin.
+  int32_t count = toIndices(bits, begin, first, indices);
+  int32_t i = first;
+  for (; i < last && i % 64 != 0; i += kGroup) {
+    count += tvl::bit_indices<Vec>(
+        static_cast<uint32_t>(bits[i / 64] >> (i % 64)), i, indices + count);
+  }
+  for (; i + 64 <= last; i += 64) {
+    auto word = bits[i / 64];
+    if (__builtin_popcountll(word) <= kSparseBits) {
+      for (; word != 0; word &= word - 1) {
+        indices[count++] = i + __builtin_ctzll(word);
+      }
+      continue;
+    }
+    for (int32_t group = 0; group < 64; group += kGroup) {
+      count += tvl::bit_indices<Vec>(
+          static_cast<uint32_t>(word >> group), i + group, indices + count);
+    }
+  }
+  for (; i < last; i += kGroup) {
+    count += tvl::bit_indices<Vec>(
+        static_cast<uint32_t>(bits[i / 64] >> (i % 64)), i, indices + count);
+  }
+  return count + toIndices(bits, last, end, indices + count);
+}
+
+namespace detail {
+// Applies 'op' to the words of [begin, end) of 'left' and 'right' and writes
+// the result to 'target'. Full words go through 'op' one register at a time,
+// the partial words at both ends are left to 'scalar', which BitUtil.h keeps
+// scalar for ranges this short.
+template <
+    tvl::VectorProcessingStyle Vec,
+    typename VectorOp,
+    typename WordOp,
+    typename Scalar>
+inline void combineWords(
+    uint64_t* target,
+    const uint64_t* left,
+    const uint64_t* right,
+    int32_t begin,
+    int32_t end,
+    VectorOp op,
+    WordOp wordOp,
+    Scalar scalar) {
+  static_assert(kMinTVLBits >= 128, "partial words must stay scalar");
+  constexpr int32_t kStep = Vec::vector_element_count();
+  int32_t const firstWord = roundUp(begin, 64) / 64;
+  int32_t const lastWord = end / 64;
+  if (firstWord >= lastWord) {
+    scalar(begin, end);
+    return;
+  }
+  scalar(begin, firstWord * 64);
+  int32_t i = firstWord;
+  for (; i + kStep <= lastWord; i += kStep) {
+    tvl::storeu<Vec>(
+        reinterpret_cast<int64_t*>(target + i),
+        op(tvl::loadu<Vec>(reinterpret_cast<const int64_t*>(left + i)),
+           tvl::loadu<Vec>(reinterpret_cast<const int64_t*>(right + i))));
+  }
+  for (; i < lastWord; ++i) {
+    target[i] = wordOp(left[i], right[i]);
+  }
+  scalar(lastWord * 64, end);
+}
+} // namespace detail
+
+// Same as bits::andRange<negate>, 512 bits per step on AVX-512.
+template <tvl::VectorProcessingStyle Vec, bool negate>
+void andRange(
+    uint64_t* target,
+    const uint64_t* left,
+    const uint64_t* right,
+    int32_t begin,
+    int32_t end) {
+  detail::combineWords<Vec>(
+      target,
+      left,
+      right,
+      begin,
+      end,
+      [](auto l, auto r) {
+        return negate ? tvl::bitwise_andnot<Vec>(l, r)
+                      : tvl::bitwise_and<Vec>(l, r);
+      },
+      [](uint64_t l, uint64_t r) { return l & (negate ? ~r : r); },
+      [=](int32_t from, int32_t to) {
+        andRange<negate>(target, left, right, from, to);
+      });
+}
+
+// Same as bits::orRange<negate>. The OR NOT is one vpternlogq on AVX-512.
+template <tvl::VectorProcessingStyle Vec, bool negate>
+void orRange(
+    uint64_t* target,
+    const uint64_t* left,
+    const uint64_t* right,
+    int32_t begin,
+    int32_t end) {
+  detail::combineWords<Vec>(
+      target,
+      left,
+      right,
+      begin,
+      end,
+      [](auto l, auto r) {
+        return negate ? tvl::bitwise_ornot<Vec>(l, r)
+                      : tvl::bitwise_or<Vec>(l, r);
+      },
+      [](uint64_t l, uint64_t r) { return l | (negate ? ~r : r); },
+      [=](int32_t from, int32_t to) {
+        orRange<negate>(target, left, right, from, to);
+      });
+}
+
+// Same as bits::negate(bits, size). 'bits' need not be aligned.
+template <tvl::VectorProcessingStyle Vec>
+void negate(char* bits, int32_t size) {
+  constexpr int32_t kStepBits = Vec::vector_size_b();
+  auto* words = reinterpret_cast<int64_t*>(bits);
+  int32_t i = 0;
+  for (; i + kStepBits <= size; i += kStepBits) {
+    tvl::storeu<Vec>(
+        words + i / 64, tvl::bitwise_not<Vec>(tvl::loadu<Vec>(words + i / 64)));
+  }
+  negate(bits + i / 8, size - i);
+}
+
+// Same as bits::countBits(bits, begin, end). Accumulates the per lane
+// popcounts (VPOPCNTQ on AVX-512 where available, vcnt on NEON) and adds the
+// lanes up once at the end.
+template <tvl::VectorProcessingStyle Vec>
+int32_t countBits(const uint64_t* bits, int32_t begin, int32_t end) {
+  constexpr int32_t kStep = Vec::vector_element_count();
+  int32_t const firstWord = roundUp(begin, 64) / 64;
+  int32_t const lastWord = end / 64;
+  if (firstWord >= lastWord) {
+    return countBits(bits, begin, end);
+  }
+  int32_t count = countBits(bits, begin, firstWord * 64);
+  auto counts = tvl::set1<Vec>(0);
+  int32_t i = firstWord;
+  for (; i + kStep <= lastWord; i += kStep) {
+    counts = tvl::add<Vec>(
+        counts,
+        tvl::popcount<Vec>(
+            tvl::loadu<Vec>(reinterpret_cast<const int64_t*>(bits + i))));
+  }
+  alignas(Vec::vector_alignment()) int64_t lanes[kStep];
+  tvl::store<Vec>(lanes, counts);
+  for (auto lane : lanes) {
+    count += lane;
+  }
+  for (; i < lastWord; ++i) {
+    count += __builtin_popcountll(bits[i]);
+  }
+  return count + countBits(bits, lastWord * 64, end);
+}
+
+// Same as bits::copyBits. Once the target is word aligned, every target
+// word is the funnel shift of two neighbouring source words, computed for a
+// register of words per step.
+template <tvl::VectorProcessingStyle Vec>
+void copyBits(
+    const uint64_t* source,
+    uint64_t sourceOffset,
+    uint64_t* target,
+    uint64_t targetOffset,
+    uint64_t numBits) {
+  constexpr int32_t kStep = Vec::vector_element_count();
+  static_assert(kMinTVLBits > 64 * (kStep + 1), "edges must stay scalar");
+  uint64_t const head =
+      std::min<uint64_t>(numBits, (64 - targetOffset % 64) % 64);
+  copyBits(source, sourceOffset, target, targetOffset, head);
+  uint64_t const from = sourceOffset + head;
+  auto* to = reinterpret_cast<int64_t*>(target + (targetOffset + head) / 64);
+  auto* words = reinterpret_cast<const int64_t*>(source + from / 64);
+  int32_t const shift = from % 64;
+  uint64_t const numWords = (numBits - head) / 64;
+  uint64_t i = 0;
+  if (shift == 0) {
+    for (; i + kStep <= numWords; i += kStep) {
+      tvl::storeu<Vec>(to + i, tvl::loadu<Vec>(words + i));
+    }
+  } else {
+    // With a shift the full target words take the bits of numWords + 1
+    // source words, so words + i + 1 stays within the source.
+    for (; i + kStep <= numWords; i += kStep) {
+      tvl::storeu<Vec>(
+          to + i,
+          tvl::bitwise_or<Vec>(
+              tvl::shift_right<Vec>(tvl::loadu<Vec>(words + i), shift),
+              tvl::shift_left<Vec>(
+                  tvl::loadu<Vec>(words + i + 1), 64 - shift)));
+    }
+  }
+  uint64_t const done = head + i * 64;
+  copyBits(
+      source, sourceOffset + done, target, targetOffset + done, numBits - done);
+}
+
+// Same as bits::scatterBits. Goes from the top of 'target' down a word of
+// 'targetMask' at a time, so 'source' may be a prefix of 'target'. Each
+// word takes popcount(mask) source bits, deposited with tvl::deposit_bits:
+// pdep on AVX2 and AVX-512, a byte table on SSE and NEON.
+template <tvl::VectorProcessingStyle Vec>
+void scatterBits(
+    int32_t numSource,
+    int32_t numTarget,
+    const char* source,
+    const uint64_t* targetMask,
+    char* target) {
+  int32_t highByte = numTarget / 8;
+  int32_t highBit = numTarget & 7;
+  int32_t lowByte = std::max(0, highByte - 7);
+  auto maskAsBytes = reinterpret_cast<const char*>(targetMask);
+  for (;;) {
+    auto numBitsToWrite = (highByte - lowByte) * 8 + highBit;
+    uint64_t mask = *(reinterpret_cast<const uint64_t*>(maskAsBytes + lowByte));
+    auto targetPtr = reinterpret_cast<uint64_t*>(target + lowByte);
+    if (numBitsToWrite == 64) {
+      uint64_t bits = detail::getBitField(
+          source, __builtin_popcountll(mask), numSource);
+      *targetPtr = tvl::deposit_bits<Vec>(bits, mask);
+    } else {
+      auto writeMask = lowMask(numBitsToWrite);
+      mask &= writeMask;
+      uint64_t bits = detail::getBitField(
+          source, __builtin_popcountll(mask), numSource);
+      *targetPtr = (*targetPtr & ~writeMask) |
+          (tvl::deposit_bits<Vec>(bits, mask) & writeMask);
+    }
+    if (!lowByte) {
+      break;
+    }
+    highByte = lowByte;
+    highBit = 0;
+    lowByte = std::max(lowByte - 8, 0);
+  }
+}
+
+} // namespace bits
+} // namespace velox
+} // namespace facebook
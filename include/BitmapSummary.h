@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "BitUtil.h"
+
+namespace facebook {
+namespace velox {
+namespace bits {
+
+// Summary level over a bitmap: for every block of kBlockWords words one bit
+// telling whether the block is all zeros and one telling whether it is all
+// ones. Null masks and the results of very selective or unselective filters
+// consist mostly of such blocks, which the summary-aware scans below skip or
+// take whole instead of looking at each of their words. The bitmap is not
+// owned. Changes to it must be followed by update() for the changed range.
+class BitmapSummary {
+ public:
+  static constexpr int32_t kBlockWords = 64;
+  static constexpr int32_t kBlockBits = kBlockWords * 64;
+
+  BitmapSummary(const uint64_t* bits, int32_t numBits)
+      : bits_(bits),
+        numBits_(numBits),
+        allZero_(nwords(numBlocks())),
+        allOne_(nwords(numBlocks())) {
+    update(0, numBits);
+  }
+
+  // Recomputes the summary of the blocks overlapping [begin, end).
+  void update(int32_t begin, int32_t end) {
+    if (begin >= end) {
+      return;
+    }
+    for (int32_t block = begin / kBlockBits; block * kBlockBits < end;
+         ++block) {
+      int32_t const blockBegin = block * kBlockBits;
+      int32_t const blockEnd = std::min(blockBegin + kBlockBits, numBits_);
+      setBit(
+          allZero_.data(),
+          block,
+          bits::isAllSet(bits_, blockBegin, blockEnd, false));
+      setBit(
+          allOne_.data(),
+          block,
+          bits::isAllSet(bits_, blockBegin, blockEnd, true));
+    }
+  }
+
+  int32_t numBits() const {
+    return numBits_;
+  }
+
+  // Same as bits::isAllSet(bits, begin, end, value).
+  bool isAllSet(int32_t begin, int32_t end, bool value = true) const {
+    bool result = true;
+    forEachBlock(
+        begin,
+        end,
+        [&](int32_t from, int32_t to, bool allZero, bool allOne) {
+          if (value ? allOne : allZero) {
+            return true;
+          }
+          result = !(value ? allZero : allOne) &&
+              bits::isAllSet(bits_, from, to, value);
+          return result;
+        });
+    return result;
+  }
+
+  // Same as bits::countBits(bits, begin, end).
+  int32_t countBits(int32_t begin, int32_t end) const {
+    int32_t count = 0;
+    forEachBlock(
+        begin,
+        end,
+        [&](int32_t from, int32_t to, bool allZero, bool allOne) {
+          if (allOne) {
+            count += to - from;
+          } else if (!allZero) {
+            count += bits::countBits(bits_, from, to);
+          }
+          return true;
+        });
+    return count;
+  }
+
+  // Same as bits::findFirstBit(bits, begin, end).
+  int32_t findFirstBit(int32_t begin, int32_t end) const {
+    int32_t found = -1;
+    forEachBlock(
+        begin,
+        end,
+        [&](int32_t from, int32_t to, bool allZero, bool allOne) {
+          if (allZero) {
+            return true;
+          }
+          found = allOne ? from : bits::findFirstBit(bits_, from, to);
+          return found < 0;
+        });
+    return found;
+  }
+
+  // Same as bits::forEachSetBit(bits, begin, end, func).
+  template <typename Callable>
+  void forEachSetBit(int32_t begin, int32_t end, Callable func) const {
+    forEachBlock(
+        begin,
+        end,
+        [&](int32_t from, int32_t to, bool allZero, bool allOne) {
+          if (allOne) {
+            for (auto row = from; row < to; ++row) {
+              func(row);
+            }
+          } else if (!allZero) {
+            bits::forEachSetBit(bits_, from, to, func);
+          }
+          return true;
+        });
+  }
+
+ private:
+  int32_t numBlocks() const {
+    return (numBits_ + kBlockBits - 1) / kBlockBits;
+  }
+
+  // Calls func(from, to, allZero, allOne) for the part of each block within
+  // [begin, end) in ascending order, while it returns true. A part of a
+  // block is all zeros or all ones if the block is. Runs of blocks that are
+  // all zeros or all ones are found a summary word at a time.
+  template <typename BlockFunc>
+  void forEachBlock(int32_t begin, int32_t end, BlockFunc func) const {
+    if (begin >= end) {
+      return;
+    }
+    int32_t block = begin / kBlockBits;
+    int32_t const lastBlock = (end + kBlockBits - 1) / kBlockBits;
+    while (block < lastBlock) {
+      int32_t const from = std::max(begin, block * kBlockBits);
+      // The uniform blocks following 'block' up to the next one with other
+      // content form one call.
+      bool const allZero = isBitSet(allZero_.data(), block);
+      bool const allOne = isBitSet(allOne_.data(), block);
+      int32_t next = block + 1;
+      if (allZero || allOne) {
+        next = nextMixedOrFlipped(
+            allZero ? allZero_.data() : allOne_.data(), next, lastBlock);
+      }
+      int32_t const to = std::min(end, next * kBlockBits);
+      if (!func(from, to, allZero, allOne)) {
+        return;
+      }
+      block = next;
+    }
+  }
+
+  // Returns the first block in [block, lastBlock) whose bit in 'uniform' is
+  // clear, lastBlock if there is none.
+  static int32_t
+  nextMixedOrFlipped(const uint64_t* uniform, int32_t block, int32_t lastBlock) {
+    while (block < lastBlock) {
+      uint64_t const word = ~uniform[block / 64] >> (block % 64);
+      if (word != 0) {
+        return std::min(lastBlock, block + __builtin_ctzll(word));
+      }
+      block = roundUp(block + 1, 64);
+    }
+    return lastBlock;
+  }
+
+  const uint64_t* bits_;
+  const int32_t numBits_;
+  std::vector<uint64_t> allZero_;
+  std::vector<uint64_t> allOne_;
+};
+
+} // namespace bits
+} // namespace velox
+} // namespace facebook
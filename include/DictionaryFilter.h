@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace facebook::velox::common{
+
+   class FilterTVLKernel;
+
+/// Filter over a dictionary encoded column. The filter is evaluated once per
+/// dictionary entry into a pass bitmap, the rows are then filtered by
+/// gathering the bit of their code (simd::gatherBits), so a value repeated
+/// by many rows is tested once. Dictionaries of up to 64 entries keep the
+/// bitmap in a register. Build one per dictionary, see DictionaryFilterCache.
+   class DictionaryFilter{
+      public:
+         /// Tests the 'size' values of an int64_t dictionary with 'kernel'.
+         DictionaryFilter( const FilterTVLKernel & kernel, const int64_t * dictionary, int32_t size );
+
+         /// Calls test( i ) for every entry i in [0, size), e.g. testBytes of a
+         /// string filter on the strings of the dictionary.
+         template< typename Test >
+         static DictionaryFilter fromTest( int32_t size, Test test ){
+            DictionaryFilter result( size );
+            for( int32_t i = 0; i < size; ++i )
+               {
+                  if( test( i ) )
+                     {
+                        result.passing_[ i / 64 ] |= 1ULL<<( i % 64 );
+                        ++result.numPassing_;
+                     }
+               }
+            return result;
+         }
+
+         /// Number of dictionary entries.
+         int32_t size( ) const{
+            return size_;
+         }
+
+         /// Number of dictionary entries passing the filter.
+         int32_t numPassing( ) const{
+            return numPassing_;
+         }
+
+         bool passes( int32_t code ) const{
+            return ( passing_[ code / 64 ]>>( code % 64 ) )&1;
+         }
+
+         /// Same as FilterTVLKernel::filterToBits for the rows with the
+         /// dictionary codes 'codes', which must be below size(). If no entry
+         /// or every entry passes, the codes are not looked at.
+         int32_t filterToBits( const int32_t * codes, int32_t size, const uint64_t * selection, uint64_t * result ) const;
+
+      private:
+         explicit DictionaryFilter( int32_t size )
+            : size_( size ), numPassing_( 0 ), passing_( ( size+63 ) / 64 ){ }
+
+         int32_t size_;
+         int32_t numPassing_;
+         std::vector< uint64_t > passing_;
+   };
+
+/// The DictionaryFilters of the last few dictionaries of one column, keyed by
+/// the address and size of the dictionary, e.g. across the row groups of a
+/// file that share one. A cached dictionary must not be changed or freed
+/// while its address may be reused; clear() forgets all of them. Not thread
+/// safe, keep one per column and scan.
+   class DictionaryFilterCache{
+      public:
+         explicit DictionaryFilterCache( int32_t maxEntries = 4 )
+            : maxEntries_( maxEntries ){ }
+
+         /// Returns the filter of 'dictionary', made by build( ) if it is not
+         /// cached. The least recently used entry is evicted when full.
+         template< typename Build >
+         std::shared_ptr< const DictionaryFilter > get( const void * dictionary, int32_t size, Build build ){
+            auto it = std::find_if( entries_.begin( ), entries_.end( ), [ & ]( const Entry & entry ){
+               return entry.dictionary == dictionary && entry.filter->size( ) == size;
+            } );
+            if( it != entries_.end( ) )
+               {
+                  // Most recently used last.
+                  std::rotate( it, it+1, entries_.end( ) );
+                  return entries_.back( ).filter;
+               }
+            if( static_cast< int32_t >( entries_.size( ) ) >= maxEntries_ )
+               {
+                  entries_.erase( entries_.begin( ) );
+               }
+            entries_.push_back( { dictionary, std::make_shared< const DictionaryFilter >( build( ) ) } );
+            return entries_.back( ).filter;
+         }
+
+         void clear( ){
+            entries_.clear( );
+         }
+
+      private:
+         struct Entry{
+            const void * dictionary;
+            std::shared_ptr< const DictionaryFilter > filter;
+         };
+
+         const int32_t maxEntries_;
+         std::vector< Entry > entries_;
+   };
+
+} // namespace facebook::velox::common
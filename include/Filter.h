@@ -24,9 +24,6 @@
 #include <cstddef>
 
 #include "FilterMisc.h"
-#ifndef NEON
-   #include "SimdUtil.h"
-#endif
 
 #include <folly/Range.h>
 #include <folly/container/F14Set.h>
@@ -112,35 +109,6 @@ namespace facebook ::velox::common {
             VELOX_UNSUPPORTED("{}: testInt64() is not supported.", toString());
          }
 
-#ifndef NEON
-         virtual simdutil::__m256i test4x64(simdutil::__m256i x) {
-            return _mm256_setr_epi64x(
-               testInt64(x[0]) ? -1LL : 0LL,
-               testInt64(x[1]) ? -1LL : 0LL,
-               testInt64(x[2]) ? -1LL : 0LL,
-               testInt64(x[3]) ? -1LL : 0LL);
-         }
-         virtual simdutil::__m256si test8x32(simdutil::__m256i x) {
-            auto as32 = reinterpret_cast<simdutil::__m256si>(x);
-            return (simdutil::__m256si)_mm256_setr_epi32(
-               testInt64(simd::Vectors<int32_t>::extract<0>(as32)) ? -1 : 0,
-               testInt64(simd::Vectors<int32_t>::extract<1>(as32)) ? -1 : 0,
-               testInt64(simd::Vectors<int32_t>::extract<2>(as32)) ? -1 : 0,
-               testInt64(simd::Vectors<int32_t>::extract<3>(as32)) ? -1 : 0,
-               testInt64(simd::Vectors<int32_t>::extract<4>(as32)) ? -1 : 0,
-               testInt64(simd::Vectors<int32_t>::extract<5>(as32)) ? -1 : 0,
-               testInt64(simd::Vectors<int32_t>::extract<6>(as32)) ? -1 : 0,
-               testInt64(simd::Vectors<int32_t>::extract<7>(as32)) ? -1 : 0);
-         }
-
-         virtual simdutil::__m256hi test16x16(simdutil::__m256i x) {
-            int16_t result[16];
-            for (auto i = 0; i < 16; ++i) {
-                  result[i] = testInt64(reinterpret_cast<const int16_t*>(&x)[i]) ? -1 : 0;
-               }
-            return *reinterpret_cast<simdutil::__m256hi_u*>(&result);
-         }
-#endif
          virtual bool testDouble(double /* unused */) const {
             VELOX_UNSUPPORTED("{}: testDouble() is not supported.", toString());
          }
@@ -176,20 +144,6 @@ namespace facebook ::velox::common {
             VELOX_UNSUPPORTED("{}: testLength() is not supported.", toString());
          }
 
-#ifndef NEON
-         // Tests 8 lengths at a time.
-         virtual simdutil::__m256si test8xLength(simdutil::__m256si lengths) const {
-            return (simdutil::__m256si)_mm256_setr_epi32(
-               testLength(simd::Vectors<int32_t>::extract<0>(lengths)) ? -1 : 0,
-               testLength(simd::Vectors<int32_t>::extract<1>(lengths)) ? -1 : 0,
-               testLength(simd::Vectors<int32_t>::extract<2>(lengths)) ? -1 : 0,
-               testLength(simd::Vectors<int32_t>::extract<3>(lengths)) ? -1 : 0,
-               testLength(simd::Vectors<int32_t>::extract<4>(lengths)) ? -1 : 0,
-               testLength(simd::Vectors<int32_t>::extract<5>(lengths)) ? -1 : 0,
-               testLength(simd::Vectors<int32_t>::extract<6>(lengths)) ? -1 : 0,
-               testLength(simd::Vectors<int32_t>::extract<7>(lengths)) ? -1 : 0);
-         }
-#endif
          // Returns true if at least one value in the specified range can pass the
          // filter. The range is defined as all values between min and max inclusive
          // plus null if hasNull is true.
@@ -264,11 +218,6 @@ namespace facebook ::velox::common {
          }
 
          bool testInt64(int64_t value) const final;
-#ifndef NEON
-         simdutil::__m256i test4x64(simdutil::__m256i x) final;
-#endif
-
-//         simdutil::__m256si test8x32(simdutil::__m256i x) final;
          bool testInt64Range(int64_t min, int64_t max, bool hashNull) const final;
 
          std::unique_ptr<Filter> mergeWith(const Filter* other) const final;
@@ -6,7 +6,7 @@
 namespace facebook ::velox::common{
 
    enum class FilterKind{
-      kAlwaysFalse, kAlwaysTrue, kIsNull, kIsNotNull, kBoolValue, kBigintRange, kBigintValuesUsingHashTable, kBigintValuesUsingBitmask, kDoubleRange, kFloatRange, kBytesRange, kBytesValues, kBigintMultiRange, kMultiRange, };
+      kAlwaysFalse, kAlwaysTrue, kIsNull, kIsNotNull, kBoolValue, kBigintRange, kBigintValuesUsingHashTable, kBigintValuesUsingBitmask, kDoubleRange, kFloatRange, kBytesRange, kBytesValues, kBigintMultiRange, kMultiRange, kBigintValuesUsingBloomFilter, };
 
 
 
@@ -16,16 +16,22 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <sstream>
 #include <string>
 #include <vector>
 #include <cstdint>
 #include <cstddef>
+#include <type_traits>
+#include <utility>
 
 #include <folly/Range.h>
 #include <folly/container/F14Set.h>
 
+#include "BigintValuesBuilder.h"
+#include "BitUtil.h"
+#include "FilterTVLDispatch.h"
 #include "StringView.h"
 //#include "Exceptions.h"
 
@@ -38,6 +44,336 @@ namespace facebook::velox::common{
 
 
 
+   namespace detail{
+      template< tvl::VectorProcessingStyle Vec >
+      TVL_FORCE_INLINE typename Vec::register_type loadTVL( const int64_t * values ){
+         return tvl::loadu< Vec >( values );
+      }
+
+      template< tvl::VectorProcessingStyle Vec >
+      TVL_FORCE_INLINE typename Vec::register_type loadTVL( const int32_t * values ){
+         return tvl::loadu_extend_int32< Vec >( values );
+      }
+
+      template< tvl::VectorProcessingStyle Vec >
+      TVL_FORCE_INLINE typename Vec::register_type maskzLoadTVL( const int64_t * values, typename Vec::mask_type mask ){
+         return tvl::maskz_loadu< Vec >( values, mask );
+      }
+
+      template< tvl::VectorProcessingStyle Vec >
+      TVL_FORCE_INLINE typename Vec::register_type maskzLoadTVL( const int32_t * values, typename Vec::mask_type mask ){
+         return tvl::maskz_loadu_extend_int32< Vec >( values, mask );
+      }
+
+      // Byte selectors and shifts of UnpackTVL for every register of a group.
+      template< tvl::VectorProcessingStyle Vec, int32_t kBitWidth >
+      struct UnpackTables{
+         static constexpr int32_t kLanes = Vec::vector_element_count( );
+         alignas( Vec::vector_alignment( ) ) uint8_t selectors[ 64 / kLanes ][ Vec::vector_size_B( ) ];
+         alignas( Vec::vector_alignment( ) ) int64_t shifts[ 64 / kLanes ][ kLanes ];
+      };
+
+      template< tvl::VectorProcessingStyle Vec, int32_t kBitWidth >
+      constexpr UnpackTables< Vec, kBitWidth > makeUnpackTables( ){
+         constexpr int32_t kLanes = Vec::vector_element_count( );
+         UnpackTables< Vec, kBitWidth > tables{ };
+         for( int32_t r = 0; r < 64 / kLanes; ++r )
+            {
+               for( int32_t lane = 0; lane < kLanes; ++lane )
+                  {
+                     // Bit of the value relative to the first byte the register loads.
+                     int32_t const bit = r*kLanes*kBitWidth%8+lane*kBitWidth;
+                     for( int32_t byte = 0; byte < 8; ++byte )
+                        {
+                           tables.selectors[ r ][ lane*8+byte ] = bit / 8+byte;
+                        }
+                     tables.shifts[ r ][ lane ] = 64-kBitWidth-bit%8;
+                  }
+            }
+         return tables;
+      }
+
+      // Unpacks groups of 64 values of kBitWidth bits stored LSB first. A
+      // group takes 8 * kBitWidth bytes, so every group starts at a byte and
+      // the layout of its registers is the same for all groups. A register
+      // loads the bytes from its first value on, tvl::lookup_bytes moves the
+      // 8 bytes from the first byte of each value into its lane and the value
+      // is shifted to the top of the lane and back down, as in
+      // simd::gather16x32. A value starts at most 7 bits into its first byte
+      // and has at most 32 bits, so it lies within these 8 bytes.
+      template< tvl::VectorProcessingStyle Vec, int32_t kBitWidth >
+      struct UnpackTVL{
+         static_assert( kBitWidth >= 1 && kBitWidth <= 32, "values must fit the bytes of one lane" );
+         static constexpr int32_t kLanes = Vec::vector_element_count( );
+         static constexpr int32_t kRegisters = 64 / kLanes;
+         /// Bytes from the start of a group up to the end of the load of its last register.
+         static constexpr int32_t kReadBytes = ( 64-kLanes )*kBitWidth / 8+Vec::vector_size_B( );
+         static constexpr UnpackTables< Vec, kBitWidth > kTables = makeUnpackTables< Vec, kBitWidth >( );
+
+         static TVL_FORCE_INLINE typename Vec::register_type load( const uint8_t * group, int32_t r ){
+            auto const bytes = tvl::loadu< Vec >( reinterpret_cast< const int64_t * >( group+r*kLanes*kBitWidth / 8 ) );
+            auto const lanes = tvl::lookup_bytes< Vec >( bytes, tvl::load< Vec >( reinterpret_cast< const int64_t * >( kTables.selectors[ r ] ) ) );
+            return tvl::shift_right< Vec >( tvl::shift_left_variable< Vec >( lanes, tvl::load< Vec >( kTables.shifts[ r ] ) ), 64-kBitWidth );
+         }
+      };
+
+      // Shifts the lanes of a register up by 2^step lanes, filling with zeros.
+      template< tvl::VectorProcessingStyle Vec >
+      struct LaneShiftTables{
+         static constexpr int32_t kLanes = Vec::vector_element_count( );
+         static constexpr int32_t kSteps = __builtin_ctz( kLanes );
+         alignas( Vec::vector_alignment( ) ) int64_t indices[ kSteps+1 ][ kLanes ];
+         alignas( Vec::vector_alignment( ) ) int64_t keep[ kSteps+1 ][ kLanes ];
+      };
+
+      template< tvl::VectorProcessingStyle Vec >
+      constexpr LaneShiftTables< Vec > makeLaneShiftTables( ){
+         LaneShiftTables< Vec > tables{ };
+         for( int32_t step = 0; step < LaneShiftTables< Vec >::kSteps; ++step )
+            {
+               int32_t const shift = 1<<step;
+               for( int32_t lane = 0; lane < Vec::vector_element_count( ); ++lane )
+                  {
+                     tables.indices[ step ][ lane ] = lane >= shift ? lane-shift : 0;
+                     tables.keep[ step ][ lane ] = lane >= shift ? -1 : 0;
+                  }
+            }
+         return tables;
+      }
+
+      template< tvl::VectorProcessingStyle Vec >
+      inline constexpr LaneShiftTables< Vec > kLaneShiftTables = makeLaneShiftTables< Vec >( );
+
+      // Inclusive prefix sum over the lanes of 'x' in log2(lanes) steps of
+      // permute, mask and add.
+      template< tvl::VectorProcessingStyle Vec >
+      TVL_FORCE_INLINE typename Vec::register_type prefixSumTVL( typename Vec::register_type x ){
+         auto const & tables = kLaneShiftTables< Vec >;
+         for( int32_t step = 0; step < LaneShiftTables< Vec >::kSteps; ++step )
+            {
+               auto const shifted = tvl::permute< Vec >( x, tvl::load< Vec >( tables.indices[ step ] ) );
+               x = tvl::add< Vec >( x, tvl::bitwise_and< Vec >( shifted, tvl::load< Vec >( tables.keep[ step ] ) ) );
+            }
+         return x;
+      }
+
+      // Every lane set to the last lane of 'x'.
+      template< tvl::VectorProcessingStyle Vec >
+      TVL_FORCE_INLINE typename Vec::register_type broadcastLastTVL( typename Vec::register_type x ){
+         return tvl::permute< Vec >( x, tvl::set1< Vec >( Vec::vector_element_count( )-1 ) );
+      }
+   } // namespace detail
+
+   /// Returns the number of values in [values, values + size) passing
+   /// 'filter', a FilterTVL or a FilterTVL expression (FilterTVLExpr.h). The
+   /// last size % lanes values are loaded with a lane mask, so nothing past
+   /// the end is read. The zeroed lanes are tested as well and masked out of
+   /// the result.
+   template< typename Expr, typename T >
+   int32_t countPassingTVL( Expr & filter, const T * values, int32_t size ){
+      using Vec = typename std::remove_const_t< Expr >::vec_type;
+      constexpr int32_t kLanes = Vec::vector_element_count( );
+      int32_t count = 0;
+      int32_t i = 0;
+      for( ; i+kLanes <= size; i += kLanes )
+         {
+            auto result = filter.test( detail::loadTVL< Vec >( values+i ) );
+            count += tvl::mask_popcount< Vec >( tvl::get_msb< Vec >( result ) );
+         }
+      if( i < size )
+         {
+            auto tail = tvl::leading_mask< Vec >( size-i );
+            auto result = filter.test( detail::maskzLoadTVL< Vec >( values+i, tail ) );
+            count += tvl::mask_popcount< Vec >( tvl::get_msb< Vec >( result )&tvl::to_integral< Vec >( tail ) );
+         }
+      return count;
+   }
+
+   /// Sets bit i of 'result' if values[i] passes 'filter' and bit i of
+   /// 'selection' is set, clears it otherwise, and returns the number of
+   /// bits set. 'selection' may be nullptr to test every value. The masks of
+   /// the registers of a 64 value group are packed straight into its result
+   /// word, one byte per register on AVX-512, and groups with no selected
+   /// value are not loaded. The bits from 'size' to the end of the last word
+   /// are cleared.
+   template< typename Expr, typename T >
+   int32_t filterToBitsTVL( Expr & filter, const T * values, int32_t size, const uint64_t * selection, uint64_t * result ){
+      using Vec = typename std::remove_const_t< Expr >::vec_type;
+      constexpr int32_t kLanes = Vec::vector_element_count( );
+      static_assert( 64 % kLanes == 0, "registers must not straddle result words" );
+      int32_t count = 0;
+      for( int32_t begin = 0; begin < size; begin += 64 )
+         {
+            int32_t const end = std::min( begin+64, size );
+            uint64_t const selected = selection ? selection[ begin / 64 ] : ~0ULL;
+            uint64_t word = 0;
+            if( selected != 0 )
+               {
+                  int32_t i = begin;
+                  for( ; i+kLanes <= end; i += kLanes )
+                     {
+                        auto passed = tvl::get_msb< Vec >( filter.test( detail::loadTVL< Vec >( values+i ) ) );
+                        word |= static_cast< uint64_t >( passed )<<( i-begin );
+                     }
+                  if( i < end )
+                     {
+                        auto tail = tvl::leading_mask< Vec >( end-i );
+                        auto passed = tvl::get_msb< Vec >( filter.test( detail::maskzLoadTVL< Vec >( values+i, tail ) ) )&tvl::to_integral< Vec >( tail );
+                        word |= static_cast< uint64_t >( passed )<<( i-begin );
+                     }
+                  word &= selected;
+               }
+            result[ begin / 64 ] = word;
+            count += __builtin_popcountll( word );
+         }
+      return count;
+   }
+
+   /// Same as filterToBitsTVL for 'size' values of a block encoded as in
+   /// TVLEncodedBlock, with codes of kBitWidth bits packed LSB first at
+   /// 'packed', code i at bits [i * kBitWidth, (i + 1) * kBitWidth). The
+   /// codes are unpacked and decoded in registers and tested right away
+   /// instead of being decoded to an int64_t array first. Groups whose
+   /// registers would load past the last packed byte are copied to a zero
+   /// padded buffer first, so nothing past the packed codes is read.
+   template< int32_t kBitWidth, TVLEncodedBlock::Encoding kEncoding, typename Expr >
+   int32_t filterEncodedToBitsTVL(
+      Expr & filter, int64_t base, const uint64_t * packed, int32_t size, const uint64_t * selection, uint64_t * result
+   ){
+      using Vec = typename std::remove_const_t< Expr >::vec_type;
+      using Unpack = detail::UnpackTVL< Vec, kBitWidth >;
+      constexpr int32_t kLanes = Vec::vector_element_count( );
+      constexpr bool kDelta = kEncoding == TVLEncodedBlock::Encoding::kDelta;
+      auto const * bytes = reinterpret_cast< const uint8_t * >( packed );
+      int64_t const numBytes = ( static_cast< int64_t >( size )*kBitWidth+7 ) / 8;
+      // The base for frame of reference, the last value so far for delta.
+      auto carry = tvl::set1< Vec >( base );
+      int32_t count = 0;
+      for( int32_t begin = 0; begin < size; begin += 64 )
+         {
+            uint64_t const selected = selection ? selection[ begin / 64 ] : ~0ULL;
+            uint64_t word = 0;
+            // Delta codes are decoded without a selected value as well,
+            // they are part of every later value.
+            if( kDelta || selected != 0 )
+               {
+                  int64_t const offset = static_cast< int64_t >( begin / 64 )*8*kBitWidth;
+                  auto const * group = bytes+offset;
+                  alignas( Vec::vector_alignment( ) ) uint8_t padded[ Unpack::kReadBytes ];
+                  if( offset+Unpack::kReadBytes > numBytes )
+                     {
+                        std::fill( std::copy( group, bytes+numBytes, padded ), padded+Unpack::kReadBytes, 0 );
+                        group = padded;
+                     }
+                  for( int32_t r = 0; r < Unpack::kRegisters; ++r )
+                     {
+                        auto values = Unpack::load( group, r );
+                        if constexpr( kDelta )
+                           {
+                              values = tvl::add< Vec >( detail::prefixSumTVL< Vec >( values ), carry );
+                              carry = detail::broadcastLastTVL< Vec >( values );
+                           }
+                        else
+                           {
+                              values = tvl::add< Vec >( values, carry );
+                           }
+                        if( !kDelta || selected != 0 )
+                           {
+                              auto passed = tvl::get_msb< Vec >( filter.test( values ) );
+                              word |= static_cast< uint64_t >( passed )<<( r*kLanes );
+                           }
+                     }
+                  word &= selected;
+                  if( size-begin < 64 )
+                     {
+                        word &= ( 1ULL<<( size-begin ) )-1;
+                     }
+               }
+            result[ begin / 64 ] = word;
+            count += __builtin_popcountll( word );
+         }
+      return count;
+   }
+
+   /// filterEncodedToBitsTVL for a bit width from 1 to 32 known at runtime.
+   template< TVLEncodedBlock::Encoding kEncoding, typename Expr >
+   int32_t filterEncodedToBitsTVL(
+      Expr & filter, int64_t base, const uint64_t * packed, int32_t bitWidth, int32_t size, const uint64_t * selection, uint64_t * result
+   ){
+      using Kernel = int32_t ( * )( Expr &, int64_t, const uint64_t *, int32_t, const uint64_t *, uint64_t * );
+      static constexpr auto kKernels = []< int32_t... kWidths >( std::integer_sequence< int32_t, kWidths... > ){
+         return std::array< Kernel, sizeof...( kWidths ) >{ &filterEncodedToBitsTVL< kWidths+1, kEncoding, Expr >... };
+      }( std::make_integer_sequence< int32_t, 32 >( ) );
+      if( bitWidth < 1 || bitWidth > 32 )
+         {
+            throw "bit width must be between 1 and 32";
+         }
+      return kKernels[ bitWidth-1 ]( filter, base, packed, size, selection, result );
+   }
+
+   /// Same as filterToBitsTVL for 'size' unsigned values of 'bitWidth' bits
+   /// packed LSB first at 'packed'.
+   template< typename Expr >
+   int32_t filterPackedToBitsTVL( Expr & filter, const uint64_t * packed, int32_t bitWidth, int32_t size, const uint64_t * selection, uint64_t * result ){
+      return filterEncodedToBitsTVL< TVLEncodedBlock::Encoding::kFrameOfReference >( filter, 0, packed, bitWidth, size, selection, result );
+   }
+
+   /// Same as filterToBitsTVL for the values of 'block'. A block none of
+   /// whose values in [block.min, block.max] can pass the filter is skipped
+   /// without looking at its codes.
+   template< typename Expr >
+   int32_t filterBlockToBitsTVL( Expr & filter, const TVLEncodedBlock & block, const uint64_t * selection, uint64_t * result ){
+      if( !filter.testInt64Range( block.min, block.max, false ) )
+         {
+            std::fill( result, result+( block.size+63 ) / 64, 0 );
+            return 0;
+         }
+      if( block.encoding == TVLEncodedBlock::Encoding::kDelta )
+         {
+            return filterEncodedToBitsTVL< TVLEncodedBlock::Encoding::kDelta >(
+               filter, block.base, block.packed, block.bitWidth, block.size, selection, result
+            );
+         }
+      return filterEncodedToBitsTVL< TVLEncodedBlock::Encoding::kFrameOfReference >(
+         filter, block.base, block.packed, block.bitWidth, block.size, selection, result
+      );
+   }
+
+   /// Same as filterToBitsTVL for a run length encoded column, where run r
+   /// is lengths[r] rows (possibly 0) of values[r]. The run values are tested
+   /// a register at a time, up to 1024 runs per filterToBitsTVL, and every run
+   /// is written with one bits::fillBits, so the cost grows with the number
+   /// of runs, not rows. 'selection' and 'result' cover the rows.
+   template< typename Expr >
+   int32_t filterRunsToBitsTVL(
+      Expr & filter, const int64_t * values, const int32_t * lengths, int32_t numRuns, const uint64_t * selection, uint64_t * result
+   ){
+      constexpr int32_t kRunBatch = 1024;
+      uint64_t passing[ kRunBatch / 64 ];
+      int32_t row = 0;
+      int32_t count = 0;
+      for( int32_t begin = 0; begin < numRuns; begin += kRunBatch )
+         {
+            int32_t const size = std::min( kRunBatch, numRuns-begin );
+            filterToBitsTVL( filter, values+begin, size, nullptr, passing );
+            for( int32_t i = 0; i < size; ++i )
+               {
+                  int32_t const end = row+lengths[ begin+i ];
+                  bool const passed = ( passing[ i / 64 ]>>( i % 64 ) )&1;
+                  bits::fillBits( result, row, end, passed );
+                  count += passed ? end-row : 0;
+                  row = end;
+               }
+         }
+      bits::fillBits( result, row, bits::roundUp( row, 64 ), false );
+      if( selection )
+         {
+            bits::andBits( result, selection, 0, row );
+            count = bits::countBits( result, 0, row );
+         }
+      return count;
+   }
+
 /**
  * A simple filter (e.g. comparison with literal) that can be applied
  * efficiently while extracting values from an ORC stream.
@@ -45,7 +381,24 @@ namespace facebook::velox::common{
    template< tvl::VectorProcessingStyle Vec >
    class FilterTVL{
       public:
+         using vec_type = Vec;
          using register_type = typename Vec::register_type;
+
+         /// Batch loops of a filter, see batch(). 'filter' must be the filter
+         /// the loops were taken from.
+         struct Batch{
+            int32_t ( * countPassing64 )( FilterTVL & filter, const int64_t * values, int32_t size );
+            int32_t ( * countPassing32 )( FilterTVL & filter, const int32_t * values, int32_t size );
+            int32_t ( * filterToBits64 )( FilterTVL & filter, const int64_t * values, int32_t size, const uint64_t * selection, uint64_t * result );
+            int32_t ( * filterToBits32 )( FilterTVL & filter, const int32_t * values, int32_t size, const uint64_t * selection, uint64_t * result );
+            int32_t ( * filterPackedToBits )(
+               FilterTVL & filter, const uint64_t * packed, int32_t bitWidth, int32_t size, const uint64_t * selection, uint64_t * result
+            );
+            int32_t ( * filterBlockToBits )( FilterTVL & filter, const TVLEncodedBlock & block, const uint64_t * selection, uint64_t * result );
+            int32_t ( * filterRunsToBits )(
+               FilterTVL & filter, const int64_t * values, const int32_t * lengths, int32_t numRuns, const uint64_t * selection, uint64_t * result
+            );
+         };
       protected:
          FilterTVL( bool deterministic, bool nullAllowed, FilterKind kind )
             : nullAllowed_( nullAllowed ), deterministic_( deterministic ), kind_( kind ){ }
@@ -129,6 +482,18 @@ namespace facebook::velox::common{
             return tvl::load< Vec >( tmp_buf.data( ) );
          }
 
+         /// Returns the batch loops of this filter. Filters deriving from
+         /// FilterTVLBase return loops instantiated for their concrete type,
+         /// which inline test(), so a caller pays one indirect call per batch
+         /// instead of one virtual call per register. The default loops call
+         /// the virtual test().
+         virtual Batch batch( ) const{
+            return {
+               &countPassingTVL< FilterTVL, int64_t >, &countPassingTVL< FilterTVL, int32_t >,
+               &filterToBitsTVL< FilterTVL, int64_t >, &filterToBitsTVL< FilterTVL, int32_t >, &filterPackedToBitsTVL< FilterTVL >,
+               &filterBlockToBitsTVL< FilterTVL >, &filterRunsToBitsTVL< FilterTVL > };
+         }
+
          virtual bool testDouble( double /* unused */ ) const{
             throw "not supported";
          }
@@ -164,15 +529,16 @@ namespace facebook::velox::common{
             throw "not supported";
          }
 
-         // Tests 8 lengths at a time.
-//         virtual __m256si test8xLength( __m256si lengths ) const{
-//            return ( __m256si ) _mm256_setr_epi32(
-//               testLength( simd::Vectors< int32_t >::extract< 0 >( lengths ) ) ? -1 : 0, testLength( simd::Vectors< int32_t >::extract< 1 >( lengths ) ) ? -1 : 0, testLength( simd::Vectors< int32_t >::extract< 2 >( lengths ) ) ? -1 : 0, testLength(
-//                  simd::Vectors< int32_t >::extract< 3 >( lengths )
-//               ) ? -1 : 0, testLength( simd::Vectors< int32_t >::extract< 4 >( lengths ) ) ? -1 : 0, testLength( simd::Vectors< int32_t >::extract< 5 >( lengths ) ) ? -1 : 0, testLength( simd::Vectors< int32_t >::extract< 6 >( lengths ) ) ? -1 : 0
-//               , testLength( simd::Vectors< int32_t >::extract< 7 >( lengths ) ) ? -1 : 0
-//            );
-//         }
+         // Tests one register of lengths at a time.
+         virtual register_type testLengths( register_type lengths ) const{
+            alignas( Vec::vector_alignment() )
+               std::array< int64_t, Vec::vector_element_count() > tmp_buf{ };
+            for( auto i = 0; i < Vec::vector_element_count(); ++i ) {
+               tmp_buf[ i ] = testLength( lengths[ i ] ) ? -1LL : 0LL;
+            }
+
+            return tvl::load< Vec >( tmp_buf.data( ) );
+         }
 
          // Returns true if at least one value in the specified range can pass the
          // filter. The range is defined as all values between min and max inclusive
@@ -221,6 +587,8 @@ namespace facebook::velox::common{
                   break;
                   case FilterKind::kBigintValuesUsingBitmask:strKind = "BigintValuesUsingBitmask";
                   break;
+                  case FilterKind::kBigintValuesUsingBloomFilter:strKind = "BigintValuesUsingBloomFilter";
+                  break;
                   case FilterKind::kDoubleRange:strKind = "DoubleRange";
                   break;
                   case FilterKind::kFloatRange:strKind = "FloatRange";
@@ -248,11 +616,123 @@ namespace facebook::velox::common{
          const FilterKind kind_;
    };
 
+   /// Base of the concrete filters. Exports batch loops instantiated for
+   /// 'Derived', which must be final so test() is called without a virtual
+   /// call.
+   template< typename Derived, tvl::VectorProcessingStyle Vec >
+   class FilterTVLBase
+      : public FilterTVL< Vec >{
+      protected:
+         using FilterTVL< Vec >::FilterTVL;
+
+      public:
+         typename FilterTVL< Vec >::Batch batch( ) const final{
+            return {
+               &countPassing< int64_t >, &countPassing< int32_t >, &filterToBits< int64_t >, &filterToBits< int32_t >, &filterPackedToBits,
+               &filterBlockToBits, &filterRunsToBits };
+         }
+
+      private:
+         template< typename T >
+         static int32_t countPassing( FilterTVL< Vec > & filter, const T * values, int32_t size ){
+            static_assert( std::is_final_v< Derived >, "FilterTVLBase needs a final Derived" );
+            return countPassingTVL( static_cast< Derived & >( filter ), values, size );
+         }
+
+         template< typename T >
+         static int32_t filterToBits( FilterTVL< Vec > & filter, const T * values, int32_t size, const uint64_t * selection, uint64_t * result ){
+            return filterToBitsTVL( static_cast< Derived & >( filter ), values, size, selection, result );
+         }
+
+         static int32_t filterPackedToBits(
+            FilterTVL< Vec > & filter, const uint64_t * packed, int32_t bitWidth, int32_t size, const uint64_t * selection, uint64_t * result
+         ){
+            return filterPackedToBitsTVL( static_cast< Derived & >( filter ), packed, bitWidth, size, selection, result );
+         }
+
+         static int32_t filterBlockToBits( FilterTVL< Vec > & filter, const TVLEncodedBlock & block, const uint64_t * selection, uint64_t * result ){
+            return filterBlockToBitsTVL( static_cast< Derived & >( filter ), block, selection, result );
+         }
+
+         static int32_t filterRunsToBits(
+            FilterTVL< Vec > & filter, const int64_t * values, const int32_t * lengths, int32_t numRuns, const uint64_t * selection, uint64_t * result
+         ){
+            return filterRunsToBitsTVL( static_cast< Derived & >( filter ), values, lengths, numRuns, selection, result );
+         }
+   };
+
+   template< tvl::VectorProcessingStyle Vec >
+   std::unique_ptr< FilterTVL< Vec > > createBigintValuesTVL(
+      const std::vector< int64_t > & values, bool nullAllowed
+   );
+
+/// Range filter for integral data types: min <= value <= max.
+   template< tvl::VectorProcessingStyle Vec >
+   class BigintRangeTVL final
+      : public FilterTVLBase< BigintRangeTVL< Vec >, Vec >{
+      public:
+         using register_type = Vec::register_type;
+         using FilterTVL< Vec >::nullAllowed_;
+      public:
+         /// @param lower Lower end of the range, inclusive.
+         /// @param upper Upper end of the range, inclusive.
+         /// @param nullAllowed Null values are passing the filter if true.
+         BigintRangeTVL( int64_t lower, int64_t upper, bool nullAllowed )
+            : FilterTVLBase< BigintRangeTVL< Vec >, Vec >( true, nullAllowed, FilterKind::kBigintRange ), lower_( lower ), upper_( upper ){ }
+
+         std::unique_ptr< FilterTVL< Vec > > clone(
+            std::optional< bool > nullAllowed = std::nullopt
+         ) const final{
+            return std::make_unique< BigintRangeTVL< Vec > >(
+               lower_, upper_, nullAllowed ? nullAllowed.value( ) : nullAllowed_
+            );
+         }
+
+         bool testInt64( int64_t value ) const final{
+            return value >= lower_ && value <= upper_;
+         }
+
+         typename Vec::register_type test( typename Vec::register_type x ) final{
+            return tvl::to_vector< Vec >(
+               tvl::between_inclusive< Vec >(
+                  x, tvl::set1< Vec >( lower_ ), tvl::set1< Vec >( upper_ )
+               )
+            );
+         }
+
+         bool testInt64Range( int64_t min, int64_t max, bool hasNull ) const final{
+            if( hasNull && nullAllowed_ )
+               {
+                  return true;
+               }
+            return !( min > upper_ || max < lower_ );
+         }
+
+         int64_t lower( ) const{
+            return lower_;
+         }
+
+         int64_t upper( ) const{
+            return upper_;
+         }
+
+         std::string toString( ) const final{
+            return fmt::format(
+               "BigintRangeTVL: [{}, {}] {}", lower_, upper_, nullAllowed_ ? "with nulls" : "no nulls"
+            );
+         }
+
+      private:
+         const int64_t lower_;
+         const int64_t upper_;
+   };
+
+
 /// IN-list filter for integral data types. Implemented as a hash table. Good
 /// for large number of values that do not fit within a small range.
    template< tvl::VectorProcessingStyle Vec >
    class BigintValuesUsingHashTableTVL final
-      : public FilterTVL< Vec >{
+      : public FilterTVLBase< BigintValuesUsingHashTableTVL< Vec >, Vec >{
       public:
          using register_type = Vec::register_type;
          using FilterTVL< Vec >::nullAllowed_;
@@ -265,8 +745,9 @@ namespace facebook::velox::common{
          BigintValuesUsingHashTableTVL(
             int64_t min, int64_t max, const std::vector< int64_t > & values, bool nullAllowed
          )
-            : FilterTVL< Vec >( true, nullAllowed, FilterKind::kBigintValuesUsingHashTable ), min_( min ), max_( max ), values_( values ){
-            constexpr int32_t kPaddingElements = 4;
+            : FilterTVLBase< BigintValuesUsingHashTableTVL< Vec >, Vec >( true, nullAllowed, FilterKind::kBigintValuesUsingHashTable ), min_( min ), max_( max ), values_( values ){
+            // One full register may be loaded from the last used index.
+            constexpr int32_t kPaddingElements = Vec::vector_element_count( );
             if( min >= max )
                {
                   throw "min must be less than max";
@@ -282,6 +763,7 @@ namespace facebook::velox::common{
             auto size = 1u<<( uint32_t ) std::log2( values.size( )*5 );
             hashTable_.resize( size+kPaddingElements );
             sizeMask_ = size-1;
+            hashShift_ = 64-__builtin_ctz( size );
             std::fill( hashTable_.begin( ), hashTable_.end( ), kEmptyMarker );
             for( auto value : values )
                {
@@ -290,7 +772,7 @@ namespace facebook::velox::common{
                         containsEmptyMarker_ = true;
                      }else
                      {
-                        auto position = ( ( value*M )&( size-1 ) );
+                        auto position = ( value*M )>>hashShift_;
                         for( auto i = position; i < position+size; i++ )
                            {
                               uint32_t index = i&sizeMask_;
@@ -314,7 +796,7 @@ namespace facebook::velox::common{
          BigintValuesUsingHashTableTVL(
             const BigintValuesUsingHashTableTVL & other, bool nullAllowed
          )
-            : FilterTVL< Vec >( true, nullAllowed, other.kind( ) ), min_( other.min_ ), max_( other.max_ ), hashTable_( other.hashTable_ ), containsEmptyMarker_( other.containsEmptyMarker_ ), values_( other.values_ ), sizeMask_( other.sizeMask_ ){ }
+            : FilterTVLBase< BigintValuesUsingHashTableTVL< Vec >, Vec >( true, nullAllowed, other.kind( ) ), min_( other.min_ ), max_( other.max_ ), hashTable_( other.hashTable_ ), containsEmptyMarker_( other.containsEmptyMarker_ ), values_( other.values_ ), sizeMask_( other.sizeMask_ ), hashShift_( other.hashShift_ ){ }
 
          std::unique_ptr< FilterTVL< Vec > > clone(
             std::optional< bool > nullAllowed = std::nullopt
@@ -339,7 +821,7 @@ namespace facebook::velox::common{
                {
                   return false;
                }
-            uint32_t pos = ( value*M )&sizeMask_;
+            uint32_t pos = ( value*M )>>hashShift_;
             for( auto i = pos; i <= pos+sizeMask_; i++ )
                {
                   int32_t idx = i&sizeMask_;
@@ -372,7 +854,7 @@ namespace facebook::velox::common{
                   return FilterTVL< Vec >::test( x );
                }
 
-            auto indices = x*M&sizeMask_;
+            auto indices = tvl::multiply_shift< Vec >( x, M, hashShift_ );
             auto const emptyMarkerVec = tvl::set1< Vec >( kEmptyMarker );
             auto data = tvl::gather< Vec >(
                emptyMarkerVec, hashTable_.data( ), indices, rangeMask
@@ -383,7 +865,7 @@ namespace facebook::velox::common{
             auto result = tvl::equal< Vec >( x, data );
             auto missed = tvl::equal< Vec >( data, emptyMarkerVec );
 
-            uint16_t unresolved = tvl::mask_reduce< Vec >(
+            auto unresolved = tvl::mask_reduce< Vec >(
                ~tvl::to_integral< Vec >( result )&
                ~tvl::to_integral< Vec >( missed )
             );
@@ -392,18 +874,20 @@ namespace facebook::velox::common{
                {
                   return tvl::to_vector< Vec >( result );
                }
-            int64_t indicesArray[Vec::vector_element_count()];
-            int64_t valuesArray[Vec::vector_element_count()];
-            int64_t resultArray[Vec::vector_element_count()];
+            alignas( Vec::vector_alignment() ) int64_t indicesArray[Vec::vector_element_count()];
+            alignas( Vec::vector_alignment() ) int64_t valuesArray[Vec::vector_element_count()];
+            alignas( Vec::vector_alignment() ) int64_t resultArray[Vec::vector_element_count()];
 
             * reinterpret_cast<register_type *>(indicesArray) = indices+1;
             * reinterpret_cast<register_type *>(valuesArray) = x;
             * reinterpret_cast<register_type *>(resultArray) = tvl::to_vector< Vec >( result );
             auto allEmpty = tvl::set1< Vec >( kEmptyMarker );
 
-            while( unresolved )
+            int32_t lanes[Vec::vector_element_count()];
+            auto numUnresolved = tvl::mask_lane_indices< Vec >( unresolved, lanes );
+            for( int32_t i = 0; i < numUnresolved; ++i )
                {
-                  auto lane = bits::getAndClearLastSetBit( unresolved );
+                  auto lane = lanes[ i ];
                   // Loop for each unresolved (not hit and
                   // not empty) until finding hit or empty.
                   int64_t index = indicesArray[ lane ];
@@ -425,7 +909,7 @@ namespace facebook::velox::common{
                               resultArray[ lane ] = 0;
                               break;
                            }
-                        index += 4;
+                        index += Vec::vector_element_count();
                         if( index > sizeMask_ )
                            {
                               index = 0;
@@ -513,7 +997,8 @@ namespace facebook::velox::common{
          }
 
          static constexpr int64_t kEmptyMarker = 0xdeadbeefbadefeedL;
-         // from Murmur hash
+         // from Murmur hash. The table index is the upper log2(size) bits of
+         // value * M (multiply-shift hashing), see tvl::multiply_shift.
          static constexpr uint64_t M = 0xc6a4a7935bd1e995L;
 
          const int64_t min_;
@@ -522,8 +1007,205 @@ namespace facebook::velox::common{
          bool containsEmptyMarker_ = false;
          std::vector< int64_t > values_;
          int32_t sizeMask_;
+         int32_t hashShift_;
    };
 
+/// IN-list filter for integral data types. Implemented as a bitmask with one
+/// bit per value in [min, max]. Good for values within a small range.
+   template< tvl::VectorProcessingStyle Vec >
+   class BigintValuesUsingBitmaskTVL final
+      : public FilterTVLBase< BigintValuesUsingBitmaskTVL< Vec >, Vec >{
+      public:
+         using register_type = Vec::register_type;
+         using FilterTVL< Vec >::nullAllowed_;
+      public:
+         /// @param min Minimum value.
+         /// @param max Maximum value.
+         /// @param values A list of values in [min, max] that pass the filter.
+         /// @param nullAllowed Null values are passing the filter if true.
+         BigintValuesUsingBitmaskTVL(
+            int64_t min, int64_t max, const std::vector< int64_t > & values, bool nullAllowed
+         )
+            : FilterTVLBase< BigintValuesUsingBitmaskTVL< Vec >, Vec >( true, nullAllowed, FilterKind::kBigintValuesUsingBitmask ), min_( min ), max_( max ),
+              bitmask_( min <= max ? ( static_cast< uint64_t >( max )-static_cast< uint64_t >( min ) )/64+1 : 0 ){
+            if( min > max )
+               {
+                  throw "min must not be greater than max";
+               }
+            for( auto value : values )
+               {
+                  auto const offset = static_cast< uint64_t >( value )-static_cast< uint64_t >( min );
+                  bitmask_[ offset/64 ] |= 1ULL<<( offset%64 );
+               }
+         }
+
+         BigintValuesUsingBitmaskTVL(
+            const BigintValuesUsingBitmaskTVL & other, bool nullAllowed
+         )
+            : FilterTVLBase< BigintValuesUsingBitmaskTVL< Vec >, Vec >( true, nullAllowed, FilterKind::kBigintValuesUsingBitmask ), min_( other.min_ ), max_( other.max_ ), bitmask_( other.bitmask_ ){ }
+
+         std::unique_ptr< FilterTVL< Vec > > clone(
+            std::optional< bool > nullAllowed = std::nullopt
+         ) const final{
+            return std::make_unique< BigintValuesUsingBitmaskTVL< Vec > >(
+               *this, nullAllowed ? nullAllowed.value( ) : nullAllowed_
+            );
+         }
+
+         bool testInt64( int64_t value ) const final{
+            if( value < min_ || value > max_ )
+               {
+                  return false;
+               }
+            auto const offset = static_cast< uint64_t >( value )-static_cast< uint64_t >( min_ );
+            return ( bitmask_[ offset/64 ]>>( offset%64 ) )&1;
+         }
+
+         typename Vec::register_type test( typename Vec::register_type x ) final{
+            auto const inRange = tvl::between_inclusive< Vec >( x, tvl::set1< Vec >( min_ ), tvl::set1< Vec >( max_ ) );
+            if( tvl::to_integral< Vec >( inRange ) == 0 )
+               {
+                  return tvl::set1< Vec >( 0 );
+               }
+            auto const offsets = tvl::sub< Vec >( x, tvl::set1< Vec >( min_ ) );
+            auto const words = tvl::gather< Vec >(
+               tvl::set1< Vec >( 0 ), reinterpret_cast< const int64_t * >( bitmask_.data( ) ), tvl::shift_right< Vec >( offsets, 6 ), inRange
+            );
+            auto const bits = tvl::shift_left_variable< Vec >( tvl::set1< Vec >( 1 ), tvl::bitwise_and< Vec >( offsets, tvl::set1< Vec >( 63 ) ) );
+            // Lanes outside [min, max] gathered 0 and miss as well.
+            auto const missed = tvl::equal< Vec >( tvl::bitwise_and< Vec >( words, bits ), tvl::set1< Vec >( 0 ) );
+            return tvl::bitwise_xor< Vec >( tvl::to_vector< Vec >( missed ), tvl::set1< Vec >( -1 ) );
+         }
+
+         bool testInt64Range( int64_t min, int64_t max, bool hasNull ) const final{
+            if( hasNull && nullAllowed_ )
+               {
+                  return true;
+               }
+            return !( min > max_ || max < min_ );
+         }
+
+         std::string toString( ) const final{
+            return fmt::format(
+               "BigintValuesUsingBitmaskTVL: [{}, {}] {}", min_, max_, nullAllowed_ ? "with nulls" : "no nulls"
+            );
+         }
+
+      private:
+         const int64_t min_;
+         const int64_t max_;
+         std::vector< uint64_t > bitmask_;
+   };
+
+/// IN-list filter for integral data types that passes every value of the list
+/// and, with a low probability, other values in [min, max]. Implemented as a
+/// Bloom filter with one 64 bit word per value and three bits set per value,
+/// see BigintValuesBuilder::bloomWord and bloomBits. Good for lists too large
+/// to keep, e.g. a dynamic filter from a large hash join build side.
+   template< tvl::VectorProcessingStyle Vec >
+   class BigintValuesUsingBloomFilterTVL final
+      : public FilterTVLBase< BigintValuesUsingBloomFilterTVL< Vec >, Vec >{
+      public:
+         using register_type = Vec::register_type;
+         using FilterTVL< Vec >::nullAllowed_;
+      public:
+         /// @param min Minimum value.
+         /// @param max Maximum value.
+         /// @param words Bloom filter, a power of two of words, at least two.
+         /// @param nullAllowed Null values are passing the filter if true.
+         BigintValuesUsingBloomFilterTVL(
+            int64_t min, int64_t max, std::vector< uint64_t > words, bool nullAllowed
+         )
+            : FilterTVLBase< BigintValuesUsingBloomFilterTVL< Vec >, Vec >( true, nullAllowed, FilterKind::kBigintValuesUsingBloomFilter ), min_( min ), max_( max ),
+              log2Words_( __builtin_ctzll( words.size( ) ) ), words_( std::move( words ) ){
+            if( words_.size( ) < 2 || ( words_.size( )&( words_.size( )-1 ) ) != 0 )
+               {
+                  throw "Bloom filter size must be a power of two";
+               }
+         }
+
+         std::unique_ptr< FilterTVL< Vec > > clone(
+            std::optional< bool > nullAllowed = std::nullopt
+         ) const final{
+            return std::make_unique< BigintValuesUsingBloomFilterTVL< Vec > >(
+               min_, max_, words_, nullAllowed ? nullAllowed.value( ) : nullAllowed_
+            );
+         }
+
+         bool testInt64( int64_t value ) const final{
+            if( value < min_ || value > max_ )
+               {
+                  return false;
+               }
+            auto const bits = BigintValuesBuilder::bloomBits( value, log2Words_ );
+            return ( words_[ BigintValuesBuilder::bloomWord( value, log2Words_ ) ]&bits ) == bits;
+         }
+
+         typename Vec::register_type test( typename Vec::register_type x ) final{
+            auto const inRange = tvl::between_inclusive< Vec >( x, tvl::set1< Vec >( min_ ), tvl::set1< Vec >( max_ ) );
+            if( tvl::to_integral< Vec >( inRange ) == 0 )
+               {
+                  return tvl::set1< Vec >( 0 );
+               }
+            auto const hash = tvl::mul< Vec >( x, tvl::set1< Vec >( static_cast< int64_t >( BigintValuesBuilder::kBloomMultiplier ) ) );
+            auto const words = tvl::gather< Vec >(
+               tvl::set1< Vec >( 0 ), reinterpret_cast< const int64_t * >( words_.data( ) ), tvl::shift_right< Vec >( hash, 64-log2Words_ ), inRange
+            );
+            auto const shift = BigintValuesBuilder::bloomBitsShift( log2Words_ );
+            auto const bit = [ & ]( int offset ){
+               return tvl::shift_left_variable< Vec >(
+                  tvl::set1< Vec >( 1 ), tvl::bitwise_and< Vec >( tvl::shift_right< Vec >( hash, shift+offset ), tvl::set1< Vec >( 63 ) )
+               );
+            };
+            auto const bits = tvl::bitwise_or< Vec >( tvl::bitwise_or< Vec >( bit( 0 ), bit( 6 ) ), bit( 12 ) );
+            // Lanes outside [min, max] gathered 0, which never contains all
+            // three bits.
+            return tvl::to_vector< Vec >( tvl::equal< Vec >( tvl::bitwise_and< Vec >( words, bits ), bits ) );
+         }
+
+         bool testInt64Range( int64_t min, int64_t max, bool hasNull ) const final{
+            if( hasNull && nullAllowed_ )
+               {
+                  return true;
+               }
+            return !( min > max_ || max < min_ );
+         }
+
+         std::string toString( ) const final{
+            return fmt::format(
+               "BigintValuesUsingBloomFilterTVL: [{}, {}] {} words {}", min_, max_, words_.size( ), nullAllowed_ ? "with nulls" : "no nulls"
+            );
+         }
+
+      private:
+         const int64_t min_;
+         const int64_t max_;
+         const int32_t log2Words_;
+         const std::vector< uint64_t > words_;
+   };
+
+// Creates the filter BigintValuesBuilder::kind() picked for the keys added to
+// 'builder'. Must not run concurrently with BigintValuesBuilder::add.
+   template< tvl::VectorProcessingStyle Vec >
+   std::unique_ptr< FilterTVL< Vec > > createBigintValuesTVL(
+      const BigintValuesBuilder & builder, bool nullAllowed
+   ){
+      switch( builder.kind( ) )
+         {
+            case BigintValuesBuilder::Kind::kEmpty:
+               return std::make_unique< BigintRangeTVL< Vec > >( 1, 0, nullAllowed );
+            case BigintValuesBuilder::Kind::kRange:
+               return std::make_unique< BigintRangeTVL< Vec > >( builder.min( ), builder.max( ), nullAllowed );
+            case BigintValuesBuilder::Kind::kBitmask:
+               return std::make_unique< BigintValuesUsingBitmaskTVL< Vec > >( builder.min( ), builder.max( ), builder.values( ), nullAllowed );
+            case BigintValuesBuilder::Kind::kHashTable:
+               return std::make_unique< BigintValuesUsingHashTableTVL< Vec > >( builder.min( ), builder.max( ), builder.values( ), nullAllowed );
+            case BigintValuesBuilder::Kind::kBloomFilter:
+               return std::make_unique< BigintValuesUsingBloomFilterTVL< Vec > >( builder.min( ), builder.max( ), builder.bloomFilter( ), nullAllowed );
+         }
+      throw "unknown BigintValuesBuilder::Kind";
+   }
+
 // Creates a hash or bitmap based IN filter depending on value distribution.
    template< tvl::VectorProcessingStyle Vec >
    std::unique_ptr< FilterTVL< Vec > > createBigintValuesTVL(
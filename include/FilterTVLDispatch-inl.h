@@ -0,0 +1,399 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+// Included by the per-ISA translation units only, after TVL_TARGET_PUSH.
+// Everything that is not a template over Vec lives in an anonymous namespace
+// so no ISA specific code can leak into another translation unit.
+
+#include <cstring>
+
+#include "BitUtilTVL.h"
+#include "FilterTVL.h"
+#include "FilterTVLDispatch.h"
+#include "FilterTVLExpr.h"
+#include "FilterTVLSet.h"
+#include "HashTVL.h"
+#include "SimdTVL.h"
+
+namespace facebook::velox::common{
+   namespace{
+      /// Runs the FilterTVL expression 'Expr' (FilterTVLExpr.h) over a batch.
+      template< TVLTarget kTarget, typename Expr >
+      class FilterTVLKernelImpl final : public FilterTVLKernel{
+            using Vec = typename Expr::vec_type;
+         public:
+            explicit FilterTVLKernelImpl( Expr filter )
+               : filter_( std::move( filter ) ){ }
+
+            TVLTarget target( ) const override{
+               return kTarget;
+            }
+
+            int32_t lanes( ) const override{
+               return Vec::vector_element_count( );
+            }
+
+            int32_t countPassing( const int64_t * values, int32_t size ) const override{
+               return countPassingTVL( filter_, values, size );
+            }
+
+            int32_t countPassing( const int32_t * values, int32_t size ) const override{
+               return countPassingTVL( filter_, values, size );
+            }
+
+            int32_t filterToBits( const int64_t * values, int32_t size, const uint64_t * selection, uint64_t * result ) const override{
+               return filterToBitsTVL( filter_, values, size, selection, result );
+            }
+
+            int32_t filterToBits( const int32_t * values, int32_t size, const uint64_t * selection, uint64_t * result ) const override{
+               return filterToBitsTVL( filter_, values, size, selection, result );
+            }
+
+            int32_t filterPackedToBits(
+               const uint64_t * packed, int32_t bitWidth, int32_t size, const uint64_t * selection, uint64_t * result
+            ) const override{
+               return filterPackedToBitsTVL( filter_, packed, bitWidth, size, selection, result );
+            }
+
+            int32_t filterBlockToBits( const TVLEncodedBlock & block, const uint64_t * selection, uint64_t * result ) const override{
+               return filterBlockToBitsTVL( filter_, block, selection, result );
+            }
+
+            int32_t filterRunsToBits(
+               const int64_t * values, const int32_t * lengths, int32_t numRuns, const uint64_t * selection, uint64_t * result
+            ) const override{
+               return filterRunsToBitsTVL( filter_, values, lengths, numRuns, selection, result );
+            }
+
+         private:
+            Expr filter_;
+      };
+
+      /// Runs the batch loops a FilterTVL exports (FilterTVL::batch), one
+      /// indirect call per batch.
+      template< TVLTarget kTarget, tvl::VectorProcessingStyle Vec >
+      class FilterTVLBatchKernelImpl final : public FilterTVLKernel{
+         public:
+            explicit FilterTVLBatchKernelImpl( std::unique_ptr< FilterTVL< Vec > > filter )
+               : filter_( std::move( filter ) ), batch_( filter_->batch( ) ){ }
+
+            TVLTarget target( ) const override{
+               return kTarget;
+            }
+
+            int32_t lanes( ) const override{
+               return Vec::vector_element_count( );
+            }
+
+            int32_t countPassing( const int64_t * values, int32_t size ) const override{
+               return batch_.countPassing64( *filter_, values, size );
+            }
+
+            int32_t countPassing( const int32_t * values, int32_t size ) const override{
+               return batch_.countPassing32( *filter_, values, size );
+            }
+
+            int32_t filterToBits( const int64_t * values, int32_t size, const uint64_t * selection, uint64_t * result ) const override{
+               return batch_.filterToBits64( *filter_, values, size, selection, result );
+            }
+
+            int32_t filterToBits( const int32_t * values, int32_t size, const uint64_t * selection, uint64_t * result ) const override{
+               return batch_.filterToBits32( *filter_, values, size, selection, result );
+            }
+
+            int32_t filterPackedToBits(
+               const uint64_t * packed, int32_t bitWidth, int32_t size, const uint64_t * selection, uint64_t * result
+            ) const override{
+               return batch_.filterPackedToBits( *filter_, packed, bitWidth, size, selection, result );
+            }
+
+            int32_t filterBlockToBits( const TVLEncodedBlock & block, const uint64_t * selection, uint64_t * result ) const override{
+               return batch_.filterBlockToBits( *filter_, block, selection, result );
+            }
+
+            int32_t filterRunsToBits(
+               const int64_t * values, const int32_t * lengths, int32_t numRuns, const uint64_t * selection, uint64_t * result
+            ) const override{
+               return batch_.filterRunsToBits( *filter_, values, lengths, numRuns, selection, result );
+            }
+
+         private:
+            std::unique_ptr< FilterTVL< Vec > > filter_;
+            const typename FilterTVL< Vec >::Batch batch_;
+      };
+
+      template< tvl::VectorProcessingStyle Vec, TVLTarget kTarget >
+      std::unique_ptr< FilterTVLKernel > createFilterTVLKernelFor( const std::vector< int64_t > & values, bool nullAllowed ){
+         return std::make_unique< FilterTVLBatchKernelImpl< kTarget, Vec > >( createBigintValuesTVL< Vec >( values, nullAllowed ) );
+      }
+
+      template< tvl::VectorProcessingStyle Vec, TVLTarget kTarget >
+      std::unique_ptr< FilterTVLKernel > createFilterTVLKernelFor( const BigintValuesBuilder & builder, bool nullAllowed ){
+         return std::make_unique< FilterTVLBatchKernelImpl< kTarget, Vec > >( createBigintValuesTVL< Vec >( builder, nullAllowed ) );
+      }
+
+      // x BETWEEN lower AND upper AND x NOT IN ( excluded ). The fused kernel
+      // is one inlined expression, the other one calls the same two filters
+      // through FilterTVL.
+      template< tvl::VectorProcessingStyle Vec, TVLTarget kTarget >
+      std::unique_ptr< FilterTVLKernel > createBetweenNotInTVLKernelFor(
+         int64_t lower, int64_t upper, const std::vector< int64_t > & excluded, bool fused
+      ){
+         auto range = std::make_unique< BigintRangeTVL< Vec > >( lower, upper, false );
+         auto [ min, max ] = std::minmax_element( excluded.begin( ), excluded.end( ) );
+         auto in = std::make_unique< BigintValuesUsingHashTableTVL< Vec > >( *min, *max, excluded, false );
+         if( fused )
+            {
+               using Expr = And< StaticTVL< BigintRangeTVL< Vec > >, Not< StaticTVL< BigintValuesUsingHashTableTVL< Vec > > > >;
+               return std::make_unique< FilterTVLKernelImpl< kTarget, Expr > >(
+                  Expr( StaticTVL( std::move( range ) ), Not( StaticTVL( std::move( in ) ) ) )
+               );
+            }
+         using Expr = And< DynamicTVL< Vec >, Not< DynamicTVL< Vec > > >;
+         return std::make_unique< FilterTVLKernelImpl< kTarget, Expr > >(
+            Expr( DynamicTVL< Vec >( std::move( range ) ), Not( DynamicTVL< Vec >( std::move( in ) ) ) )
+         );
+      }
+
+      /// Runs a FilterTVLSet over batches of kBatchSize values. The set keeps
+      /// its statistics across calls and threads, the row numbers of a batch
+      /// live on the stack of the call. 32 bit, packed and encoded values are
+      /// decoded a batch at a time into an int64_t buffer on the stack first.
+      template< TVLTarget kTarget, tvl::VectorProcessingStyle Vec >
+      class FilterTVLSetKernelImpl final : public FilterTVLKernel{
+            static constexpr int32_t kBatchSize = 1024;
+         public:
+            explicit FilterTVLSetKernelImpl( std::unique_ptr< const FilterTVLSet< Vec > > filters )
+               : filters_( std::move( filters ) ){ }
+
+            TVLTarget target( ) const override{
+               return kTarget;
+            }
+
+            int32_t lanes( ) const override{
+               return Vec::vector_element_count( );
+            }
+
+            int32_t countPassing( const int64_t * values, int32_t size ) const override{
+               return filterBatches( size, [ values ]( int32_t begin, int32_t, int64_t * ){
+                  return values+begin;
+               }, nullptr );
+            }
+
+            int32_t countPassing( const int32_t * values, int32_t size ) const override{
+               return filterBatches( size, widen( values ), nullptr );
+            }
+
+            int32_t filterToBits( const int64_t * values, int32_t size, const uint64_t * selection, uint64_t * result ) const override{
+               return filterBatchesToBits( size, [ values ]( int32_t begin, int32_t, int64_t * ){
+                  return values+begin;
+               }, selection, result );
+            }
+
+            int32_t filterToBits( const int32_t * values, int32_t size, const uint64_t * selection, uint64_t * result ) const override{
+               return filterBatchesToBits( size, widen( values ), selection, result );
+            }
+
+            int32_t filterPackedToBits(
+               const uint64_t * packed, int32_t bitWidth, int32_t size, const uint64_t * selection, uint64_t * result
+            ) const override{
+               if( bitWidth < 1 || bitWidth > 32 )
+                  {
+                     throw "bit width must be between 1 and 32";
+                  }
+               return filterBatchesToBits( size, [ packed, bitWidth ]( int32_t begin, int32_t size, int64_t * buffer ){
+                  for( int32_t i = 0; i < size; ++i )
+                     {
+                        buffer[ i ] = code( packed, bitWidth, begin+i );
+                     }
+                  return buffer;
+               }, selection, result );
+            }
+
+            int32_t filterBlockToBits( const TVLEncodedBlock & block, const uint64_t * selection, uint64_t * result ) const override{
+               if( !filters_->testInt64Range( block.min, block.max, false ) )
+                  {
+                     std::fill( result, result+bits::nwords( block.size ), 0 );
+                     return 0;
+                  }
+               if( block.bitWidth < 1 || block.bitWidth > 32 )
+                  {
+                     throw "bit width must be between 1 and 32";
+                  }
+               bool const delta = block.encoding == TVLEncodedBlock::Encoding::kDelta;
+               // The last value so far for delta, the batches come in order.
+               int64_t last = block.base;
+               return filterBatchesToBits( block.size, [ & ]( int32_t begin, int32_t size, int64_t * buffer ){
+                  for( int32_t i = 0; i < size; ++i )
+                     {
+                        int64_t const value = code( block.packed, block.bitWidth, begin+i );
+                        buffer[ i ] = delta ? last += value : block.base+value;
+                     }
+                  return buffer;
+               }, selection, result );
+            }
+
+            // Tests the run values a batch at a time and writes every run
+            // with one bits::fillBits, like filterRunsToBitsTVL.
+            int32_t filterRunsToBits(
+               const int64_t * values, const int32_t * lengths, int32_t numRuns, const uint64_t * selection, uint64_t * result
+            ) const override{
+               int32_t rows[ kBatchSize ];
+               uint64_t passing[ kBatchSize / 64 ];
+               int32_t row = 0;
+               int32_t count = 0;
+               for( int32_t begin = 0; begin < numRuns; begin += kBatchSize )
+                  {
+                     int32_t const size = std::min( kBatchSize, numRuns-begin );
+                     std::fill( passing, passing+bits::nwords( size ), 0 );
+                     auto const numPassing = filters_->filter( values+begin, size, rows );
+                     for( int32_t j = 0; j < numPassing; ++j )
+                        {
+                           bits::setBit( passing, rows[ j ] );
+                        }
+                     for( int32_t i = 0; i < size; ++i )
+                        {
+                           int32_t const end = row+lengths[ begin+i ];
+                           bool const passed = bits::isBitSet( passing, i );
+                           bits::fillBits( result, row, end, passed );
+                           count += passed ? end-row : 0;
+                           row = end;
+                        }
+                  }
+               bits::fillBits( result, row, bits::roundUp( row, 64 ), false );
+               if( selection )
+                  {
+                     bits::andBits( result, selection, 0, row );
+                     count = bits::countBits( result, 0, row );
+                  }
+               return count;
+            }
+
+         private:
+            // Returns a decoder of 32 bit values for filterBatches.
+            static auto widen( const int32_t * values ){
+               return [ values ]( int32_t begin, int32_t size, int64_t * buffer ){
+                  std::copy( values+begin, values+begin+size, buffer );
+                  return buffer;
+               };
+            }
+
+            // Returns code 'index' of 'bitWidth' bits packed LSB first. Reads
+            // only the bytes holding the code.
+            static int64_t code( const uint64_t * packed, int32_t bitWidth, int32_t index ){
+               int64_t const bit = static_cast< int64_t >( index )*bitWidth;
+               uint64_t word = 0;
+               std::memcpy( &word, reinterpret_cast< const uint8_t * >( packed )+bit / 8, ( bit % 8+bitWidth+7 ) / 8 );
+               return ( word>>( bit % 8 ) )&bits::lowMask( bitWidth );
+            }
+
+            // Runs the set over 'size' values in batches. 'decode'( begin,
+            // size, buffer ) returns the values of a batch, either in place or
+            // decoded into 'buffer'. Sets the bits of the passing rows in
+            // 'result' if given and returns their number.
+            template< typename Decode >
+            int32_t filterBatches( int32_t size, Decode decode, uint64_t * result ) const{
+               int64_t buffer[ kBatchSize ];
+               int32_t rows[ kBatchSize ];
+               int32_t count = 0;
+               for( int32_t i = 0; i < size; i += kBatchSize )
+                  {
+                     int32_t const batchSize = std::min( size-i, kBatchSize );
+                     auto const numPassing = filters_->filter( decode( i, batchSize, buffer ), batchSize, rows );
+                     for( int32_t j = 0; result && j < numPassing; ++j )
+                        {
+                           bits::setBit( result, i+rows[ j ] );
+                        }
+                     count += numPassing;
+                  }
+               return count;
+            }
+
+            // Sets the bits of the passing rows, then applies 'selection'.
+            template< typename Decode >
+            int32_t filterBatchesToBits( int32_t size, Decode decode, const uint64_t * selection, uint64_t * result ) const{
+               std::fill( result, result+bits::nwords( size ), 0 );
+               auto const count = filterBatches( size, decode, result );
+               if( !selection )
+                  {
+                     return count;
+                  }
+               bits::andBits( result, selection, 0, size );
+               return bits::countBits( result, 0, size );
+            }
+
+            std::unique_ptr< const FilterTVLSet< Vec > > filters_;
+      };
+
+      template< tvl::VectorProcessingStyle Vec, TVLTarget kTarget >
+      std::unique_ptr< FilterTVLKernel > createConjunctsTVLKernelFor( const std::vector< TVLConjunct > & conjuncts, bool adaptive ){
+         auto filters = std::make_unique< FilterTVLSet< Vec > >( adaptive );
+         for( auto & conjunct : conjuncts )
+            {
+               if( conjunct.values.empty( ) )
+                  {
+                     filters->add( std::make_unique< BigintRangeTVL< Vec > >( conjunct.lower, conjunct.upper, false ) );
+                  }
+               else
+                  {
+                     filters->add( createBigintValuesTVL< Vec >( conjunct.values, false ) );
+                  }
+            }
+         return std::make_unique< FilterTVLSetKernelImpl< kTarget, Vec > >( std::move( filters ) );
+      }
+
+      template< tvl::VectorProcessingStyle Vec >
+      const HashTVLKernels & hashTVLKernelsFor( ){
+         static const HashTVLKernels kernels{ &bits::hashMix< Vec >, &bits::commutativeHashMix< Vec > };
+         return kernels;
+      }
+
+      template< tvl::VectorProcessingStyle Vec >
+      const BitsTVLKernels & bitsTVLKernelsFor( ){
+         static const BitsTVLKernels kernels{
+            &bits::toIndices< Vec >,
+            &bits::andRange< Vec, false >,
+            &bits::andRange< Vec, true >,
+            &bits::orRange< Vec, false >,
+            &bits::orRange< Vec, true >,
+            &bits::negate< Vec >,
+            &bits::countBits< Vec >,
+            &bits::copyBits< Vec >,
+            &bits::scatterBits< Vec >,
+            &simd::gatherBits< Vec > };
+         return kernels;
+      }
+
+      // libc beats the register loop below the streaming threshold in the
+      // size sweep of main.cpp, the streaming stores win above it.
+      template< tvl::VectorProcessingStyle Vec >
+      void copyMemory( void * to, const void * from, int64_t bytes ){
+         if( bytes < tvlStreamingBytes( ) )
+            {
+               std::memcpy( to, from, bytes );
+               return;
+            }
+         simd::memcpy< Vec >( to, from, bytes, tvlStreamingBytes( ) );
+      }
+
+      template< tvl::VectorProcessingStyle Vec >
+      const MemoryTVLKernels & memoryTVLKernelsFor( ){
+         static const MemoryTVLKernels kernels{ &copyMemory< Vec > };
+         return kernels;
+      }
+   } // namespace
+} // namespace facebook::velox::common
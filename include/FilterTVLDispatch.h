@@ -0,0 +1,286 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+// Compiles everything between TVL_TARGET_PUSH and TVL_TARGET_POP for the
+// given ISA, independent of the flags of the translation unit. Headers whose
+// inline code is shared with other translation units (std, folly, Velox) must
+// be included before the push, otherwise their COMDAT copies may be emitted
+// with instructions the host does not have.
+#define TVL_DO_PRAGMA( x ) _Pragma( #x )
+#if defined( __clang__ )
+   #define TVL_TARGET_PUSH( isa ) \
+      TVL_DO_PRAGMA( clang attribute push( __attribute__( ( target( isa ) ) ), apply_to = function ) )
+   #define TVL_TARGET_POP( ) TVL_DO_PRAGMA( clang attribute pop )
+#else
+   #define TVL_TARGET_PUSH( isa ) \
+      TVL_DO_PRAGMA( GCC push_options ) \
+      TVL_DO_PRAGMA( GCC target( isa ) )
+   #define TVL_TARGET_POP( ) TVL_DO_PRAGMA( GCC pop_options )
+#endif
+
+namespace facebook::velox::common{
+
+   class BigintValuesBuilder;
+
+   /// Processing styles FilterTVL is compiled for, ordered from narrowest to
+   /// widest.
+   enum class TVLTarget{
+      kScalar, kNeon, kSse, kAvx2, kAvx512VL, kAvx512, };
+
+   /// A block of integers stored as unsigned codes of 'bitWidth' bits (1 to
+   /// 32) packed LSB first, code i at bit i * bitWidth.
+   struct TVLEncodedBlock{
+      enum class Encoding{
+         /// Value i is base + code i.
+         kFrameOfReference,
+         /// Value i is base + code 0 + ... + code i.
+         kDelta, };
+
+      Encoding encoding;
+      int64_t base;
+      const uint64_t * packed;
+      int32_t bitWidth;
+      int32_t size;
+      /// Smallest and largest value of the block, e.g. from its statistics.
+      int64_t min;
+      int64_t max;
+   };
+
+   /// A filter compiled for one TVLTarget behind a batch interface: any
+   /// FilterTVL expression, the adaptive FilterTVLSet, and the hash table,
+   /// bitmask and Bloom filters picked by BigintValuesBuilder. Instances
+   /// come from the create*TVLKernel functions below. The virtual call is
+   /// paid once per batch, the loop inside is monomorphic.
+   class FilterTVLKernel{
+      public:
+         virtual ~FilterTVLKernel( ) = default;
+
+         virtual TVLTarget target( ) const = 0;
+
+         /// Number of lanes processed per step. Batches of any size are
+         /// accepted, the last size % lanes() values use masked loads.
+         virtual int32_t lanes( ) const = 0;
+
+         /// Returns the number of values in [values, values + size) passing
+         /// the filter.
+         virtual int32_t countPassing( const int64_t * values, int32_t size ) const = 0;
+
+         /// Same for 32 bit values (e.g. dates), which are sign extended while
+         /// loading instead of being widened into a temporary first.
+         virtual int32_t countPassing( const int32_t * values, int32_t size ) const = 0;
+
+         /// Sets bit i of 'result' if values[i] passes the filter and bit i
+         /// of 'selection' is set, and returns the number of bits set.
+         /// 'selection' may be nullptr to test every value. 'result' needs
+         /// bits::nwords(size) words, the bits past 'size' are cleared.
+         virtual int32_t filterToBits( const int64_t * values, int32_t size, const uint64_t * selection, uint64_t * result ) const = 0;
+
+         virtual int32_t filterToBits( const int32_t * values, int32_t size, const uint64_t * selection, uint64_t * result ) const = 0;
+
+         /// Same for 'size' unsigned values of 'bitWidth' bits (1 to 32)
+         /// packed LSB first at 'packed', value i at bit i * bitWidth. The
+         /// values are unpacked in registers and passed to the filter without
+         /// going through an int64_t array.
+         virtual int32_t filterPackedToBits(
+            const uint64_t * packed, int32_t bitWidth, int32_t size, const uint64_t * selection, uint64_t * result
+         ) const = 0;
+
+         /// Same for the values of 'block', decoded in registers: the base is
+         /// added to every code, delta codes are summed up across the lanes.
+         /// If no value in [block.min, block.max] can pass, the block is
+         /// skipped without decoding it.
+         virtual int32_t filterBlockToBits( const TVLEncodedBlock & block, const uint64_t * selection, uint64_t * result ) const = 0;
+
+         /// Same for a run length encoded column: run r is lengths[r] rows of
+         /// values[r]. Every run is tested once and written as one range, so
+         /// sorted and clustered columns cost time per run, not per row.
+         /// 'selection' and 'result' cover the sum of 'lengths' rows.
+         virtual int32_t filterRunsToBits(
+            const int64_t * values, const int32_t * lengths, int32_t numRuns, const uint64_t * selection, uint64_t * result
+         ) const = 0;
+   };
+
+   /// One conjunct of createConjunctsTVLKernel: x IN (values) if 'values' is
+   /// not empty, x BETWEEN lower AND upper otherwise.
+   struct TVLConjunct{
+      int64_t lower;
+      int64_t upper;
+      std::vector< int64_t > values;
+   };
+
+   /// Batch hash kernels from HashTVL.h instantiated for one TVLTarget.
+   struct HashTVLKernels{
+      using Batch = void ( * )( const uint64_t * upper, const uint64_t * lower, int32_t size, uint64_t * result );
+      Batch hashMix;
+      Batch commutativeHashMix;
+   };
+
+   /// Bitmap kernels from BitUtilTVL.h instantiated for one TVLTarget.
+   struct BitsTVLKernels{
+      int32_t ( * toIndices )( const uint64_t * bits, int32_t begin, int32_t end, int32_t * indices );
+      void ( * andBits )( uint64_t * target, const uint64_t * left, const uint64_t * right, int32_t begin, int32_t end );
+      void ( * andWithNegatedBits )( uint64_t * target, const uint64_t * left, const uint64_t * right, int32_t begin, int32_t end );
+      void ( * orBits )( uint64_t * target, const uint64_t * left, const uint64_t * right, int32_t begin, int32_t end );
+      void ( * orWithNegatedBits )( uint64_t * target, const uint64_t * left, const uint64_t * right, int32_t begin, int32_t end );
+      void ( * negate )( char * bits, int32_t size );
+      int32_t ( * countBits )( const uint64_t * bits, int32_t begin, int32_t end );
+      void ( * copyBits )( const uint64_t * source, uint64_t sourceOffset, uint64_t * target, uint64_t targetOffset, uint64_t numBits );
+      void ( * scatterBits )( int32_t numSource, int32_t numTarget, const char * source, const uint64_t * targetMask, char * target );
+      /// simd::gatherBits from SimdTVL.h.
+      int32_t ( * gatherBits )( const uint64_t * bits, int32_t numBits, const int32_t * indices, int32_t size, const uint64_t * selection, uint64_t * result );
+   };
+
+   /// Copies for one TVLTarget: std::memcpy below tvlStreamingBytes(), the
+   /// streaming simd::memcpy from SimdTVL.h from there on.
+   struct MemoryTVLKernels{
+      void ( * memcpy )( void * to, const void * from, int64_t bytes );
+   };
+
+   const char * tvlTargetName( TVLTarget target );
+
+   /// True if this binary contains code for 'target' and the host can run it.
+   bool tvlTargetSupported( TVLTarget target );
+
+   /// Widest TVLTarget supported by the host, kAvx512VL instead of kAvx512
+   /// with --tvl_avx512_256. Resolved on the first call and kept for the
+   /// process, like the kernels bits:: and tvlMemcpy() take from it. That
+   /// call must come after the flags are parsed, otherwise --avx2, --avx512,
+   /// --bmi2 and --tvl_avx512_256 keep their defaults.
+   TVLTarget bestTVLTarget( );
+
+   /// Creates an IN-list kernel for 'target' or nullptr if
+   /// tvlTargetSupported(target) is false.
+   std::unique_ptr< FilterTVLKernel > createFilterTVLKernel(
+      TVLTarget target, const std::vector< int64_t > & values, bool nullAllowed
+   );
+
+   /// Creates a kernel for the filter BigintValuesBuilder::kind() picked, e.g.
+   /// a dynamic filter from a hash join build side, or nullptr if
+   /// tvlTargetSupported(target) is false. Must not run concurrently with
+   /// BigintValuesBuilder::add.
+   std::unique_ptr< FilterTVLKernel > createFilterTVLKernel(
+      TVLTarget target, const BigintValuesBuilder & builder, bool nullAllowed
+   );
+
+   /// Creates a kernel for x BETWEEN lower AND upper AND x NOT IN (excluded)
+   /// or nullptr if tvlTargetSupported(target) is false. If 'fused', both
+   /// predicates are inlined into one loop (FilterTVLExpr.h), otherwise every
+   /// register goes through the virtual FilterTVL::test of each.
+   std::unique_ptr< FilterTVLKernel > createBetweenNotInTVLKernel(
+      TVLTarget target, int64_t lower, int64_t upper, const std::vector< int64_t > & excluded, bool fused
+   );
+
+   /// Creates a kernel for the conjunction of 'conjuncts' or nullptr if
+   /// tvlTargetSupported(target) is false. The conjuncts are applied in the
+   /// given order to batches of up to 1024 values (FilterTVLSet.h). If
+   /// 'adaptive', they are reordered by observed cost and selectivity. Like
+   /// every kernel it may be shared between threads, which then contribute to
+   /// the same statistics. Takes at most 16 conjuncts. 32 bit, packed and
+   /// encoded values are decoded a batch at a time before the conjuncts run.
+   std::unique_ptr< FilterTVLKernel > createConjunctsTVLKernel(
+      TVLTarget target, const std::vector< TVLConjunct > & conjuncts, bool adaptive
+   );
+
+   /// Returns the hash kernels for 'target' or nullptr if
+   /// tvlTargetSupported(target) is false.
+   const HashTVLKernels * hashTVLKernels( TVLTarget target );
+
+   /// Returns the bitmap kernels for 'target' or nullptr if
+   /// tvlTargetSupported(target) is false.
+   const BitsTVLKernels * bitsTVLKernels( TVLTarget target );
+
+   /// Returns the memory kernels for 'target' or nullptr if
+   /// tvlTargetSupported(target) is false.
+   const MemoryTVLKernels * memoryTVLKernels( TVLTarget target );
+
+   /// Copies from this size on use non-temporal stores: half of the
+   /// last level cache, at most simd::kStreamingBytes.
+   int64_t tvlStreamingBytes( );
+
+   namespace detail{
+      // Defined in the per-ISA translation units FilterTVL<Isa>.cpp.
+      std::unique_ptr< FilterTVLKernel > createFilterTVLKernelScalar( const std::vector< int64_t > & values, bool nullAllowed );
+      std::unique_ptr< FilterTVLKernel > createFilterTVLKernelScalar( const BigintValuesBuilder & builder, bool nullAllowed );
+      std::unique_ptr< FilterTVLKernel > createBetweenNotInTVLKernelScalar( int64_t lower, int64_t upper, const std::vector< int64_t > & excluded, bool fused );
+      std::unique_ptr< FilterTVLKernel > createConjunctsTVLKernelScalar( const std::vector< TVLConjunct > & conjuncts, bool adaptive );
+      const HashTVLKernels & hashTVLKernelsScalar( );
+      const BitsTVLKernels & bitsTVLKernelsScalar( );
+      const MemoryTVLKernels & memoryTVLKernelsScalar( );
+#ifdef NEON
+      std::unique_ptr< FilterTVLKernel > createFilterTVLKernelNeon( const std::vector< int64_t > & values, bool nullAllowed );
+      std::unique_ptr< FilterTVLKernel > createFilterTVLKernelNeon( const BigintValuesBuilder & builder, bool nullAllowed );
+      std::unique_ptr< FilterTVLKernel > createBetweenNotInTVLKernelNeon( int64_t lower, int64_t upper, const std::vector< int64_t > & excluded, bool fused );
+      std::unique_ptr< FilterTVLKernel > createConjunctsTVLKernelNeon( const std::vector< TVLConjunct > & conjuncts, bool adaptive );
+      const HashTVLKernels & hashTVLKernelsNeon( );
+      const BitsTVLKernels & bitsTVLKernelsNeon( );
+      const MemoryTVLKernels & memoryTVLKernelsNeon( );
+#else
+      std::unique_ptr< FilterTVLKernel > createFilterTVLKernelSse( const std::vector< int64_t > & values, bool nullAllowed );
+      std::unique_ptr< FilterTVLKernel > createFilterTVLKernelSse( const BigintValuesBuilder & builder, bool nullAllowed );
+      std::unique_ptr< FilterTVLKernel > createBetweenNotInTVLKernelSse( int64_t lower, int64_t upper, const std::vector< int64_t > & excluded, bool fused );
+      std::unique_ptr< FilterTVLKernel > createConjunctsTVLKernelSse( const std::vector< TVLConjunct > & conjuncts, bool adaptive );
+      const HashTVLKernels & hashTVLKernelsSse( );
+      const BitsTVLKernels & bitsTVLKernelsSse( );
+      const MemoryTVLKernels & memoryTVLKernelsSse( );
+      std::unique_ptr< FilterTVLKernel > createFilterTVLKernelAvx2( const std::vector< int64_t > & values, bool nullAllowed );
+      std::unique_ptr< FilterTVLKernel > createFilterTVLKernelAvx2( const BigintValuesBuilder & builder, bool nullAllowed );
+      std::unique_ptr< FilterTVLKernel > createBetweenNotInTVLKernelAvx2( int64_t lower, int64_t upper, const std::vector< int64_t > & excluded, bool fused );
+      std::unique_ptr< FilterTVLKernel > createConjunctsTVLKernelAvx2( const std::vector< TVLConjunct > & conjuncts, bool adaptive );
+      const HashTVLKernels & hashTVLKernelsAvx2( );
+      const BitsTVLKernels & bitsTVLKernelsAvx2( );
+      const MemoryTVLKernels & memoryTVLKernelsAvx2( );
+      std::unique_ptr< FilterTVLKernel > createFilterTVLKernelAvx512VL( const std::vector< int64_t > & values, bool nullAllowed );
+      std::unique_ptr< FilterTVLKernel > createFilterTVLKernelAvx512VL( const BigintValuesBuilder & builder, bool nullAllowed );
+      std::unique_ptr< FilterTVLKernel > createBetweenNotInTVLKernelAvx512VL( int64_t lower, int64_t upper, const std::vector< int64_t > & excluded, bool fused );
+      std::unique_ptr< FilterTVLKernel > createConjunctsTVLKernelAvx512VL( const std::vector< TVLConjunct > & conjuncts, bool adaptive );
+      const HashTVLKernels & hashTVLKernelsAvx512VL( );
+      const BitsTVLKernels & bitsTVLKernelsAvx512VL( );
+      const MemoryTVLKernels & memoryTVLKernelsAvx512VL( );
+      std::unique_ptr< FilterTVLKernel > createFilterTVLKernelAvx512( const std::vector< int64_t > & values, bool nullAllowed );
+      std::unique_ptr< FilterTVLKernel > createFilterTVLKernelAvx512( const BigintValuesBuilder & builder, bool nullAllowed );
+      std::unique_ptr< FilterTVLKernel > createBetweenNotInTVLKernelAvx512( int64_t lower, int64_t upper, const std::vector< int64_t > & excluded, bool fused );
+      std::unique_ptr< FilterTVLKernel > createConjunctsTVLKernelAvx512( const std::vector< TVLConjunct > & conjuncts, bool adaptive );
+      const HashTVLKernels & hashTVLKernelsAvx512( );
+      const BitsTVLKernels & bitsTVLKernelsAvx512( );
+      const MemoryTVLKernels & memoryTVLKernelsAvx512( );
+#endif
+
+      // Copies through the memory kernels of bestTVLTarget().
+      void tvlMemcpyDispatched( void * to, const void * from, int64_t bytes );
+   } // namespace detail
+
+   /// Copies below this size go to libc without looking up a kernel. It is
+   /// below any tvlStreamingBytes() in practice.
+   constexpr int64_t kMinDispatchedCopyBytes = 64 << 10;
+
+   /// std::memcpy for column buffers. Large copies go through the memory
+   /// kernels of bestTVLTarget(), which stream from tvlStreamingBytes() on.
+   inline void tvlMemcpy( void * to, const void * from, int64_t bytes ){
+      if( bytes < kMinDispatchedCopyBytes )
+         {
+            std::memcpy( to, from, bytes );
+            return;
+         }
+      detail::tvlMemcpyDispatched( to, from, bytes );
+   }
+
+} // namespace facebook::velox::common
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+// Filter expressions composed at compile time. And< StaticTVL< A >, Not<
+// StaticTVL< B > > > is a single type, so its test() inlines both predicates
+// into the scan loop instead of paying a virtual call and a mask round trip
+// per predicate and register. DynamicTVL wraps any FilterTVL for shapes that
+// are only known at runtime. Like FilterTVL.h this must only be included after
+// TVL_TARGET_PUSH in the per-ISA translation units.
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "FilterTVL.h"
+
+namespace facebook::velox::common{
+
+   /// Leaf calling a concrete filter, e.g. BigintRangeTVL, without a virtual
+   /// call.
+   template< typename Filter >
+   class StaticTVL{
+         static_assert( std::is_final_v< Filter >, "StaticTVL needs a final FilterTVL" );
+      public:
+         using vec_type = typename Filter::vec_type;
+         using register_type = typename vec_type::register_type;
+
+         explicit StaticTVL( std::unique_ptr< Filter > filter )
+            : filter_( std::move( filter ) ){ }
+
+         TVL_FORCE_INLINE register_type test( register_type x ) const{
+            return filter_->Filter::test( x );
+         }
+
+         bool testInt64( int64_t value ) const{
+            return filter_->Filter::testInt64( value );
+         }
+
+         bool testInt64Range( int64_t min, int64_t max, bool hasNull ) const{
+            return filter_->Filter::testInt64Range( min, max, hasNull );
+         }
+
+      private:
+         std::unique_ptr< Filter > filter_;
+   };
+
+   /// Leaf for any FilterTVL, one virtual call per register.
+   template< tvl::VectorProcessingStyle Vec >
+   class DynamicTVL{
+      public:
+         using vec_type = Vec;
+         using register_type = typename Vec::register_type;
+
+         explicit DynamicTVL( std::unique_ptr< FilterTVL< Vec > > filter )
+            : filter_( std::move( filter ) ){ }
+
+         register_type test( register_type x ) const{
+            return filter_->test( x );
+         }
+
+         bool testInt64( int64_t value ) const{
+            return filter_->testInt64( value );
+         }
+
+         bool testInt64Range( int64_t min, int64_t max, bool hasNull ) const{
+            return filter_->testInt64Range( min, max, hasNull );
+         }
+
+      private:
+         std::unique_ptr< FilterTVL< Vec > > filter_;
+   };
+
+   /// Passes if both sides pass. Right is skipped for registers in which no
+   /// lane passed Left, so put the cheap and selective predicate first.
+   template< typename Left, typename Right >
+   class And{
+      public:
+         using vec_type = typename Left::vec_type;
+         using register_type = typename vec_type::register_type;
+
+         And( Left left, Right right )
+            : left_( std::move( left ) ), right_( std::move( right ) ){ }
+
+         TVL_FORCE_INLINE register_type test( register_type x ) const{
+            auto result = left_.test( x );
+            if( tvl::get_msb< vec_type >( result ) == 0 )
+               {
+                  return result;
+               }
+            return tvl::bitwise_and< vec_type >( result, right_.test( x ) );
+         }
+
+         bool testInt64( int64_t value ) const{
+            return left_.testInt64( value ) && right_.testInt64( value );
+         }
+
+         bool testInt64Range( int64_t min, int64_t max, bool hasNull ) const{
+            return left_.testInt64Range( min, max, hasNull ) && right_.testInt64Range( min, max, hasNull );
+         }
+
+      private:
+         Left left_;
+         Right right_;
+   };
+
+   /// Passes if either side passes. Right is skipped for registers in which
+   /// every lane passed Left.
+   template< typename Left, typename Right >
+   class Or{
+      public:
+         using vec_type = typename Left::vec_type;
+         using register_type = typename vec_type::register_type;
+
+         Or( Left left, Right right )
+            : left_( std::move( left ) ), right_( std::move( right ) ){ }
+
+         TVL_FORCE_INLINE register_type test( register_type x ) const{
+            constexpr auto kAllLanes = ( 1ULL<<vec_type::vector_element_count( ) )-1;
+            auto result = left_.test( x );
+            if( static_cast< uint64_t >( tvl::get_msb< vec_type >( result ) ) == kAllLanes )
+               {
+                  return result;
+               }
+            return tvl::bitwise_or< vec_type >( result, right_.test( x ) );
+         }
+
+         bool testInt64( int64_t value ) const{
+            return left_.testInt64( value ) || right_.testInt64( value );
+         }
+
+         bool testInt64Range( int64_t min, int64_t max, bool hasNull ) const{
+            return left_.testInt64Range( min, max, hasNull ) || right_.testInt64Range( min, max, hasNull );
+         }
+
+      private:
+         Left left_;
+         Right right_;
+   };
+
+   template< typename Operand >
+   class Not{
+      public:
+         using vec_type = typename Operand::vec_type;
+         using register_type = typename vec_type::register_type;
+
+         explicit Not( Operand operand )
+            : operand_( std::move( operand ) ){ }
+
+         TVL_FORCE_INLINE register_type test( register_type x ) const{
+            return tvl::bitwise_xor< vec_type >( operand_.test( x ), tvl::set1< vec_type >( -1 ) );
+         }
+
+         bool testInt64( int64_t value ) const{
+            return !operand_.testInt64( value );
+         }
+
+         // The operand only tells whether some value may pass, so a range of
+         // more than one value may always pass its negation.
+         bool testInt64Range( int64_t min, int64_t max, bool hasNull ) const{
+            return min != max || hasNull || !operand_.testInt64( min );
+         }
+
+      private:
+         Operand operand_;
+   };
+} // namespace facebook::velox::common
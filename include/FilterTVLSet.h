@@ -0,0 +1,248 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+// Conjunction of FilterTVLs over one column, evaluated one filter after the
+// other on the rows that passed so far. The set records rows in, rows out and
+// CPU time per filter and periodically moves the filters that drop the most
+// rows per nanosecond to the front, like the ScanSpec of a table scan orders
+// its column filters. filter() may run on several threads at once: the
+// statistics are relaxed atomics and the order is one packed word, so a
+// reorder is picked up by the next batch of every thread. Like FilterTVL.h
+// this must only be included after TVL_TARGET_PUSH in the per-ISA
+// translation units.
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "FilterTVL.h"
+#include "ProcessBase.h"
+
+namespace facebook::velox::common{
+
+   template< tvl::VectorProcessingStyle Vec >
+   class FilterTVLSet{
+         using register_type = typename Vec::register_type;
+         static constexpr int32_t kLanes = Vec::vector_element_count( );
+      public:
+         /// The filters are reordered every this many batches.
+         static constexpr int32_t kReorderInterval = 16;
+
+         /// Every this many batches is timed, threadCpuNanos() is a system
+         /// call.
+         static constexpr int32_t kTimingInterval = 4;
+
+         /// Most conjuncts a set takes, 4 bits of the order word each.
+         static constexpr int32_t kMaxConjuncts = 16;
+
+         /// @param adaptive Keeps the order of add() if false.
+         explicit FilterTVLSet( bool adaptive )
+            : adaptive_( adaptive ){ }
+
+         /// Adds a conjunct, evaluated after the ones added before until the
+         /// set is reordered. Not safe to call concurrently with filter().
+         void add( std::unique_ptr< FilterTVL< Vec > > filter ){
+            if( conjuncts_.size( ) == kMaxConjuncts )
+               {
+                  throw "FilterTVLSet takes at most 16 conjuncts";
+               }
+            order_.store( order_.load( std::memory_order_relaxed )|conjuncts_.size( )<<( 4*conjuncts_.size( ) ), std::memory_order_relaxed );
+            conjuncts_.push_back( std::make_unique< Conjunct >( std::move( filter ) ) );
+         }
+
+         int32_t size( ) const{
+            return conjuncts_.size( );
+         }
+
+         /// Returns the conjunct evaluated at 'position' in the current order.
+         const FilterTVL< Vec > & conjunct( int32_t position ) const{
+            return *conjuncts_[ at( order_.load( std::memory_order_relaxed ), position ) ]->filter;
+         }
+
+         /// False if no value in [min, max] can pass all conjuncts.
+         bool testInt64Range( int64_t min, int64_t max, bool hasNull ) const{
+            return std::all_of(
+               conjuncts_.begin( ), conjuncts_.end( ), [ & ]( const std::unique_ptr< Conjunct > & conjunct ){
+                  return conjunct->filter->testInt64Range( min, max, hasNull );
+               }
+            );
+         }
+
+         /// Writes the indices of the values in [values, values + size)
+         /// passing all conjuncts to 'rows', which must have room for 'size'
+         /// entries, and returns their number.
+         int32_t filter( const int64_t * values, int32_t size, int32_t * rows ) const{
+            if( conjuncts_.empty( ) )
+               {
+                  for( int32_t i = 0; i < size; ++i )
+                     {
+                        rows[ i ] = i;
+                     }
+                  return size;
+               }
+            uint64_t const order = order_.load( std::memory_order_relaxed );
+            bool const timed = adaptive_ && batches_.load( std::memory_order_relaxed ) % kTimingInterval == 0;
+            int32_t numRows = size;
+            for( size_t i = 0; i < conjuncts_.size( ) && numRows > 0; ++i )
+               {
+                  auto & conjunct = *conjuncts_[ at( order, i ) ];
+                  uint64_t const start = timed ? process::threadCpuNanos( ) : 0;
+                  int32_t const passed = i == 0
+                     ? filterDense( *conjunct.filter, values, size, rows )
+                     : filterRows( *conjunct.filter, values, rows, numRows );
+                  conjunct.rowsIn.fetch_add( numRows, std::memory_order_relaxed );
+                  conjunct.rowsOut.fetch_add( passed, std::memory_order_relaxed );
+                  if( timed )
+                     {
+                        conjunct.timedRowsIn.fetch_add( numRows, std::memory_order_relaxed );
+                        conjunct.nanos.fetch_add( process::threadCpuNanos( )-start, std::memory_order_relaxed );
+                     }
+                  numRows = passed;
+               }
+            if( adaptive_ && ( batches_.fetch_add( 1, std::memory_order_relaxed )+1 ) % kReorderInterval == 0 )
+               {
+                  reorder( );
+               }
+            return numRows;
+         }
+
+      private:
+         struct Conjunct{
+            explicit Conjunct( std::unique_ptr< FilterTVL< Vec > > filter )
+               : filter( std::move( filter ) ){ }
+
+            std::unique_ptr< FilterTVL< Vec > > filter;
+            std::atomic< uint64_t > rowsIn = 0;
+            std::atomic< uint64_t > rowsOut = 0;
+            std::atomic< uint64_t > timedRowsIn = 0;
+            std::atomic< uint64_t > nanos = 0;
+
+            /// Nanoseconds per dropped row, cost / (1 - selectivity). The
+            /// conjunct with the lowest score goes first.
+            double score( ) const{
+               uint64_t const in = rowsIn.load( std::memory_order_relaxed );
+               uint64_t const out = rowsOut.load( std::memory_order_relaxed );
+               uint64_t const timedIn = timedRowsIn.load( std::memory_order_relaxed );
+               if( timedIn == 0 || out >= in )
+                  {
+                     return std::numeric_limits< double >::max( );
+                  }
+               double const cost = static_cast< double >( nanos.load( std::memory_order_relaxed ) ) / timedIn;
+               double const selectivity = static_cast< double >( out ) / in;
+               return cost / ( 1-selectivity );
+            }
+         };
+
+         // Returns the index of the conjunct at 'position' in 'order'.
+         static int32_t at( uint64_t order, int32_t position ){
+            return ( order>>( 4*position ) )&0xf;
+         }
+
+         // Appends the indices of the lanes in 'mask' to 'rows', offset by
+         // 'base'.
+         static TVL_FORCE_INLINE int32_t appendRows( typename Vec::base_type mask, int32_t base, int32_t * rows ){
+            int32_t lanes[ kLanes ];
+            auto const count = tvl::mask_lane_indices< Vec >( mask, lanes );
+            for( int32_t j = 0; j < count; ++j )
+               {
+                  rows[ j ] = base+lanes[ j ];
+               }
+            return count;
+         }
+
+         static int32_t filterDense( FilterTVL< Vec > & filter, const int64_t * values, int32_t size, int32_t * rows ){
+            int32_t count = 0;
+            int32_t i = 0;
+            for( ; i+kLanes <= size; i += kLanes )
+               {
+                  auto const passed = tvl::get_msb< Vec >( filter.test( tvl::loadu< Vec >( values+i ) ) );
+                  count += appendRows( passed, i, rows+count );
+               }
+            if( i < size )
+               {
+                  auto const tail = tvl::leading_mask< Vec >( size-i );
+                  auto const passed = tvl::get_msb< Vec >( filter.test( tvl::maskz_loadu< Vec >( values+i, tail ) ) );
+                  count += appendRows( passed&tvl::to_integral< Vec >( tail ), i, rows+count );
+               }
+            return count;
+         }
+
+         // Keeps the rows whose value passes 'filter', in place.
+         static int32_t filterRows( FilterTVL< Vec > & filter, const int64_t * values, int32_t * rows, int32_t numRows ){
+            int32_t lanes[ kLanes ];
+            int32_t count = 0;
+            for( int32_t i = 0; i < numRows; i += kLanes )
+               {
+                  auto const active = tvl::leading_mask< Vec >( std::min( numRows-i, kLanes ) );
+                  auto const indices = tvl::maskz_loadu_extend_int32< Vec >( rows+i, active );
+                  auto const x = tvl::gather< Vec >( tvl::set1< Vec >( 0 ), values, indices, active );
+                  auto const passed = tvl::get_msb< Vec >( filter.test( x ) )&tvl::to_integral< Vec >( active );
+                  auto const n = tvl::mask_lane_indices< Vec >( passed, lanes );
+                  for( int32_t j = 0; j < n; ++j )
+                     {
+                        rows[ count+j ] = rows[ i+lanes[ j ] ];
+                     }
+                  count += n;
+               }
+            return count;
+         }
+
+         void reorder( ) const{
+            // The scores are taken once, other threads keep updating the
+            // statistics while sorting.
+            std::array< double, kMaxConjuncts > scores;
+            std::array< int32_t, kMaxConjuncts > positions;
+            uint64_t const order = order_.load( std::memory_order_relaxed );
+            for( size_t i = 0; i < conjuncts_.size( ); ++i )
+               {
+                  scores[ i ] = conjuncts_[ i ]->score( );
+                  positions[ i ] = at( order, i );
+               }
+            std::stable_sort(
+               positions.begin( ), positions.begin( )+conjuncts_.size( ), [ & ]( int32_t left, int32_t right ){
+                  return scores[ left ] < scores[ right ];
+               }
+            );
+            uint64_t reordered = 0;
+            for( size_t i = 0; i < conjuncts_.size( ); ++i )
+               {
+                  reordered |= static_cast< uint64_t >( positions[ i ] )<<( 4*i );
+               }
+            order_.store( reordered, std::memory_order_relaxed );
+            // Halving the history lets the order follow a drift in the data.
+            // Subtracting keeps what other threads added meanwhile.
+            for( auto & conjunct : conjuncts_ )
+               {
+                  for( auto * counter : { &conjunct->rowsIn, &conjunct->rowsOut, &conjunct->timedRowsIn, &conjunct->nanos } )
+                     {
+                        counter->fetch_sub( counter->load( std::memory_order_relaxed ) / 2, std::memory_order_relaxed );
+                     }
+               }
+         }
+
+         std::vector< std::unique_ptr< Conjunct > > conjuncts_;
+         const bool adaptive_;
+         // Conjunct indices in evaluation order, 4 bits each.
+         mutable std::atomic< uint64_t > order_ = 0;
+         mutable std::atomic< int32_t > batches_ = 0;
+   };
+} // namespace facebook::velox::common
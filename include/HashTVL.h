@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+// Vectorized counterparts of the hash helpers in BitUtil.h. Kept apart from
+// BitUtil.h because TVL must only be included after TVL_TARGET_PUSH in the
+// per-ISA translation units (see FilterTVLDispatch.h).
+
+#include <cstdint>
+#include <cstring>
+
+#include "BitUtil.h"
+#include "tvl/tvlintrin.hpp"
+
+namespace facebook {
+namespace velox {
+namespace bits {
+
+// Lane-wise hashMix(upper[i], lower[i]).
+template <tvl::VectorProcessingStyle Vec>
+inline typename Vec::register_type hashMix(
+    typename Vec::register_type upper,
+    typename Vec::register_type lower) {
+  return tvl::hash_mix<Vec>(upper, lower);
+}
+
+// Lane-wise commutativeHashMix(upper[i], lower[i]).
+template <tvl::VectorProcessingStyle Vec>
+inline typename Vec::register_type commutativeHashMix(
+    typename Vec::register_type upper,
+    typename Vec::register_type lower) {
+  return tvl::commutative_hash_mix<Vec>(upper, lower);
+}
+
+// Sets result[i] = hashMix(upper[i], lower[i]) for i < size. 'result' may
+// alias 'upper' or 'lower', which makes this usable for folding the hashes of
+// one key column after the other into a row hash.
+template <tvl::VectorProcessingStyle Vec>
+void hashMix(
+    const uint64_t* upper,
+    const uint64_t* lower,
+    int32_t size,
+    uint64_t* result) {
+  constexpr int32_t kStep = Vec::vector_element_count();
+  int32_t i = 0;
+  for (; i + kStep <= size; i += kStep) {
+    auto mixed = hashMix<Vec>(
+        tvl::loadu<Vec>(reinterpret_cast<const int64_t*>(upper + i)),
+        tvl::loadu<Vec>(reinterpret_cast<const int64_t*>(lower + i)));
+    memcpy(result + i, &mixed, sizeof(mixed));
+  }
+  for (; i < size; ++i) {
+    result[i] = hashMix(upper[i], lower[i]);
+  }
+}
+
+// Sets result[i] = commutativeHashMix(upper[i], lower[i]) for i < size.
+template <tvl::VectorProcessingStyle Vec>
+void commutativeHashMix(
+    const uint64_t* upper,
+    const uint64_t* lower,
+    int32_t size,
+    uint64_t* result) {
+  constexpr int32_t kStep = Vec::vector_element_count();
+  int32_t i = 0;
+  for (; i + kStep <= size; i += kStep) {
+    auto mixed = commutativeHashMix<Vec>(
+        tvl::loadu<Vec>(reinterpret_cast<const int64_t*>(upper + i)),
+        tvl::loadu<Vec>(reinterpret_cast<const int64_t*>(lower + i)));
+    memcpy(result + i, &mixed, sizeof(mixed));
+  }
+  for (; i < size; ++i) {
+    result[i] = commutativeHashMix(upper[i], lower[i]);
+  }
+}
+
+} // namespace bits
+} // namespace velox
+} // namespace facebook
@@ -55,14 +55,31 @@ std::string getCurrentDirectory();
  */
 uint64_t threadCpuNanos();
 
-// True if the machine has Intel AVX2 instructions and these are not disabled by
-// flag.
+/**
+ * Size of the largest CPU cache in bytes, 0 if the system does not report it.
+ */
+int64_t lastLevelCacheBytes();
+
+// True if the machine has SSE4.2 and POPCNT instructions.
+bool hasSse42();
+
+// True if the machine has Intel AVX2, BMI1, BMI2 and POPCNT instructions and
+// AVX2 is not disabled by flag.
 bool hasAvx2();
 
+// True if hasAvx2() and the machine has AVX-512 F, VL, DQ, BW and CD
+// instructions and AVX-512 is not disabled by flag.
+bool hasAvx512();
+
 // True if the machine has Intel BMI2 instructions and these are not disabled by
 // flag.
 bool hasBmi2();
 
+// True if the AVX-512 TVL kernels should run at 256 bits (AVX-512VL) instead
+// of 512 bits, set by --tvl_avx512_256. Like the flags above it only takes
+// effect if parsed before the first common::bestTVLTarget() call.
+bool preferAvx512VL();
+
 } // namespace process
 } // namespace velox
 } // namespace facebook
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace facebook::velox::common{
+
+/// Set of row numbers that stays compact at any selectivity, e.g. the deleted
+/// rows of a table or the rows passing several predicates over billions of
+/// rows. Like a roaring bitmap the rows are split into chunks of kChunkRows
+/// and every non-empty chunk is kept in the smallest of three containers: a
+/// sorted array of 16 bit offsets (at most kMaxArrayRows), a bitmap of
+/// kChunkRows bits or a list of runs. Bitmap containers are combined with the
+/// vectorized bits::andBits / orBits and converted with bits::toIndices.
+/// toBits() hands a batch of the set to FilterTVLKernel::filterToBits as
+/// selection, fromBits() takes its result back.
+   class RowSet{
+      public:
+         static constexpr int32_t kChunkBits = 16;
+         static constexpr int32_t kChunkRows = 1<<kChunkBits;
+         static constexpr int32_t kMaxArrayRows = 4096;
+
+         enum class Kind{
+            kArray,
+            kBitmap,
+            /// Pairs of first and last offset of every run.
+            kRun, };
+
+         RowSet( ) = default;
+
+         /// Rows begin + i for the set bits i in [0, numRows) of 'bits'.
+         static RowSet fromBits( const uint64_t * bits, int64_t begin, int64_t numRows );
+
+         /// Rows [begin, end).
+         static RowSet fromRange( int64_t begin, int64_t end );
+
+         static RowSet intersect( const RowSet & left, const RowSet & right );
+
+         static RowSet unite( const RowSet & left, const RowSet & right );
+
+         int64_t count( ) const;
+
+         bool contains( int64_t row ) const;
+
+         /// Sets bit i of 'bits' if row begin + i is in the set and clears it
+         /// otherwise, for i in [0, numRows).
+         void toBits( int64_t begin, int32_t numRows, uint64_t * bits ) const;
+
+         /// Bytes taken by the containers.
+         int64_t bytes( ) const;
+
+         int32_t numChunks( ) const{
+            return chunks_.size( );
+         }
+
+         Kind chunkKind( int32_t index ) const{
+            return chunks_[ index ].kind;
+         }
+
+      private:
+         struct Chunk{
+            /// Row >> kChunkBits of the rows in this chunk.
+            int64_t key;
+            Kind kind;
+            int32_t count;
+            /// Offsets for kArray, first and last offset of every run for kRun.
+            std::vector< uint16_t > values;
+            /// kChunkRows bits for kBitmap.
+            std::vector< uint64_t > bits;
+         };
+
+         // Picks the smallest container for the set bits of 'words', which
+         // has kChunkRows bits. Returns a chunk with count 0 if none is set.
+         static Chunk fromWords( int64_t key, const uint64_t * words );
+
+         // Same with the number of set bits in 'words' already known.
+         static Chunk fromWords( int64_t key, const uint64_t * words, int32_t count );
+
+         // Writes the rows of 'chunk' to kChunkRows bits at 'words'.
+         static void toWords( const Chunk & chunk, uint64_t * words );
+
+         static bool containsOffset( const Chunk & chunk, uint16_t offset );
+
+         static Chunk intersect( const Chunk & left, const Chunk & right );
+
+         // Intersects two run containers by merging their runs.
+         static Chunk intersectRuns( const Chunk & left, const Chunk & right );
+
+         static Chunk unite( const Chunk & left, const Chunk & right );
+
+         // Unites two run or array containers by merging their runs, an
+         // array taking part as runs of one row.
+         static Chunk uniteRuns( const Chunk & left, const Chunk & right );
+
+         // Turns a run container with minimal runs into an array or a bitmap
+         // where that is smaller, like fromWords would.
+         static Chunk encodeRuns( Chunk chunk );
+
+         // Returns the index of the first chunk with key >= 'key'.
+         size_t lowerBound( int64_t key ) const;
+
+         // Sorted by key, no empty chunks.
+         std::vector< Chunk > chunks_;
+   };
+
+} // namespace facebook::velox::common
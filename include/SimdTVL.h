@@ -0,0 +1,360 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+// The helpers of the former AVX2-only SimdUtil.h, written against TVL so they
+// exist for every processing style. Like HashTVL.h this must only be included
+// after TVL_TARGET_PUSH in the per-ISA translation units (see
+// FilterTVLDispatch.h).
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#include "tvl/tvlintrin.hpp"
+
+namespace facebook {
+namespace velox {
+namespace simd {
+
+// Adds 'bytes' bytes to an address of arbitrary type.
+template <typename T>
+inline T* addBytes(T* pointer, int64_t bytes) {
+  return reinterpret_cast<T*>(reinterpret_cast<uint64_t>(pointer) + bytes);
+}
+
+// Returns true if 'values[0]' to 'values[size - 1]' are consecutive
+// values of T. The values are expected to be sorted.
+template <typename T>
+inline bool isDense(const T* values, int32_t size) {
+  return (values[size - 1] - values[0] == size - 1);
+}
+
+// Returns a mask selecting the lanes whose bit is set in 'bits'. Replaces the
+// int64Masks_/int32Masks_ lookup tables.
+template <tvl::VectorProcessingStyle Vec>
+inline typename Vec::mask_type laneMask(uint64_t bits) {
+  return tvl::from_integral<Vec>(bits);
+}
+
+// Returns a mask selecting the first 'n' lanes. 'n' may be larger than the
+// number of lanes.
+template <tvl::VectorProcessingStyle Vec>
+inline typename Vec::mask_type leadingMask(int32_t n) {
+  constexpr int32_t kLanes = Vec::vector_element_count();
+  return tvl::leading_mask<Vec>(std::min(n, kLanes));
+}
+
+namespace detail {
+// Returns bit i set if bit indices[i] of 'words' is set, for the first
+// min(n, lanes) indices. The addressed word of each lane is gathered, or
+// broadcast if kOneWord says all indices are below 64, and the addressed bit
+// is moved into the sign bit of its lane.
+template <tvl::VectorProcessingStyle Vec, bool kOneWord>
+inline uint64_t
+gatherLaneBits(const int64_t* words, const int32_t* indices, int32_t n) {
+  auto const kLow6 = tvl::set1<Vec>(63);
+  auto active = leadingMask<Vec>(n);
+  auto offsets = tvl::maskz_loadu_extend_int32<Vec>(indices, active);
+  typename Vec::register_type data;
+  if constexpr (kOneWord) {
+    data = tvl::set1<Vec>(words[0]);
+  } else {
+    data = tvl::gather<Vec>(
+        tvl::set1<Vec>(0), words, tvl::shift_right<Vec>(offsets, 6), active);
+  }
+  auto shifted = tvl::shift_left_variable<Vec>(
+      data, tvl::sub<Vec>(kLow6, tvl::bitwise_and<Vec>(offsets, kLow6)));
+  return tvl::get_msb<Vec>(shifted);
+}
+
+// Same as gatherLaneBits for up to 64 indices.
+template <tvl::VectorProcessingStyle Vec, bool kOneWord>
+inline uint64_t
+gatherWordBits(const int64_t* words, const int32_t* indices, int32_t n) {
+  constexpr int32_t kLanes = Vec::vector_element_count();
+  uint64_t result = 0;
+  for (int32_t i = 0; i < n; i += kLanes) {
+    result |= gatherLaneBits<Vec, kOneWord>(words, indices + i, n - i) << i;
+  }
+  return result;
+}
+} // namespace detail
+
+// Loads up to 8 disjoint bits at bit offsets 'indices' and returns these as a
+// bit mask.
+template <tvl::VectorProcessingStyle Vec>
+inline uint8_t
+gather8Bits(const uint64_t* bits, const int32_t* indices, int32_t numIndices) {
+  constexpr int32_t kLanes = Vec::vector_element_count();
+  auto words = reinterpret_cast<const int64_t*>(bits);
+  uint32_t result = 0;
+  for (int32_t i = 0; i < numIndices && i < 8; i += kLanes) {
+    result |= detail::gatherLaneBits<Vec, false>(
+                  words, indices + i, numIndices - i)
+        << i;
+  }
+  return result & ((1U << std::min(numIndices, 8)) - 1);
+}
+
+// Sets bit i of 'result' to bit indices[i] of 'bits' for i in [0, size), if
+// bit i of 'selection' is set, and returns the number of bits set.
+// 'selection' may be nullptr. 'bits' has 'numBits' bits and every index must
+// be below it, e.g. the codes of a dictionary encoded column looking up the
+// per entry result of a filter. Like gather8Bits, one register of indices is
+// looked up per step. If 'bits' is a single word it stays in a register and
+// no memory is gathered at all. Groups of 64 indices whose selection word is
+// 0 are not loaded. 'result' needs (size + 63) / 64 words, the bits past
+// 'size' are cleared.
+template <tvl::VectorProcessingStyle Vec>
+int32_t gatherBits(
+    const uint64_t* bits,
+    int32_t numBits,
+    const int32_t* indices,
+    int32_t size,
+    const uint64_t* selection,
+    uint64_t* result) {
+  auto words = reinterpret_cast<const int64_t*>(bits);
+  int32_t count = 0;
+  for (int32_t begin = 0; begin < size; begin += 64) {
+    uint64_t word = selection ? selection[begin / 64] : ~0ULL;
+    if (word != 0) {
+      int32_t const end = std::min(begin + 64, size);
+      int32_t const n = end - begin;
+      uint64_t const gathered = numBits <= 64
+          ? detail::gatherWordBits<Vec, true>(words, indices + begin, n)
+          : detail::gatherWordBits<Vec, false>(words, indices + begin, n);
+      // Lanes past 'end' are not loaded but may shift out a set bit.
+      word &= gathered & (n == 64 ? ~0ULL : (1ULL << n) - 1);
+    }
+    result[begin / 64] = word;
+    count += __builtin_popcountll(word);
+  }
+  return count;
+}
+
+// Loads up to 16 non-contiguous 16 bit values at 'base' + 'indices[i]' *
+// 'scale' bytes into 'result'. 'base' must be 2 byte aligned.
+template <tvl::VectorProcessingStyle Vec, uint8_t scale = 2>
+inline void gather16x32(
+    const void* base,
+    const int32_t* indices,
+    int32_t numIndices,
+    int16_t* result) {
+  static_assert(
+      scale % 2 == 0 && (scale & (scale - 1)) == 0,
+      "gather16x32 expects an even power of two scale");
+  constexpr int32_t kLanes = Vec::vector_element_count();
+  auto address = reinterpret_cast<uintptr_t>(base);
+  auto words = reinterpret_cast<const int64_t*>(address & ~7ULL);
+  auto const misalignment = tvl::set1<Vec>(address & 7);
+  auto const kScaleShift = tvl::set1<Vec>(__builtin_ctz(scale));
+  auto const kLow3 = tvl::set1<Vec>(7);
+  auto const kTop = tvl::set1<Vec>(48);
+  for (int32_t i = 0; i < numIndices && i < 16; i += kLanes) {
+    auto active = leadingMask<Vec>(numIndices - i);
+    auto bytes = tvl::add<Vec>(
+        tvl::shift_left_variable<Vec>(
+            tvl::maskz_loadu_extend_int32<Vec>(indices + i, active),
+            kScaleShift),
+        misalignment);
+    auto data = tvl::gather<Vec>(
+        tvl::set1<Vec>(0), words, tvl::shift_right<Vec>(bytes, 3), active);
+    // Moves the addressed 16 bits to the top of the lane, then down again.
+    auto bitOffset = tvl::shift_left_variable<Vec>(
+        tvl::bitwise_and<Vec>(bytes, kLow3), tvl::set1<Vec>(3));
+    auto values = tvl::shift_right<Vec>(
+        tvl::shift_left_variable<Vec>(data, tvl::sub<Vec>(kTop, bitOffset)),
+        48);
+    alignas(Vec::vector_alignment()) int64_t lanes[kLanes];
+    tvl::store<Vec>(lanes, values);
+    for (int32_t lane = 0; lane < kLanes && i + lane < numIndices; ++lane) {
+      result[i + lane] = lanes[lane];
+    }
+  }
+}
+
+// Copies of at least this many bytes use non-temporal stores so they do not
+// evict the working set. Callers that know the cache size pass their
+// own threshold (see tvlStreamingBytes() in FilterTVLDispatch.h).
+constexpr int64_t kStreamingBytes = 8 << 20;
+
+// True if Vec has byte masked loads and stores (AVX-512BW). Otherwise short
+// tails are cheaper as a cascade of scalar moves.
+template <tvl::VectorProcessingStyle Vec>
+constexpr bool hasMaskedTail() {
+  return tvl::details::storeu_partial_impl<Vec, tvl::workaround>::
+      native_supported();
+}
+
+namespace detail {
+template <tvl::VectorProcessingStyle Vec>
+inline typename Vec::base_type* lanes(void* pointer) {
+  return reinterpret_cast<typename Vec::base_type*>(pointer);
+}
+
+template <tvl::VectorProcessingStyle Vec>
+inline const typename Vec::base_type* lanes(const void* pointer) {
+  return reinterpret_cast<const typename Vec::base_type*>(pointer);
+}
+
+// Number of bytes from 'pointer' to the next register aligned address, in
+// [1, vector_size_B()].
+template <tvl::VectorProcessingStyle Vec>
+inline int32_t bytesToAlignment(const void* pointer) {
+  constexpr int32_t kByteWidth = Vec::vector_size_B();
+  return kByteWidth - (reinterpret_cast<uintptr_t>(pointer) & (kByteWidth - 1));
+}
+
+// Moves 4 registers per call so the loads are issued ahead of the stores.
+template <tvl::VectorProcessingStyle Vec, bool kStream>
+inline void copy4(void* to, const void* from) {
+  constexpr auto kLanes = Vec::vector_element_count();
+  auto in = lanes<Vec>(from);
+  auto out = lanes<Vec>(to);
+  auto r0 = tvl::loadu<Vec>(in);
+  auto r1 = tvl::loadu<Vec>(in + kLanes);
+  auto r2 = tvl::loadu<Vec>(in + 2 * kLanes);
+  auto r3 = tvl::loadu<Vec>(in + 3 * kLanes);
+  if constexpr (kStream) {
+    tvl::stream<Vec>(out, r0);
+    tvl::stream<Vec>(out + kLanes, r1);
+    tvl::stream<Vec>(out + 2 * kLanes, r2);
+    tvl::stream<Vec>(out + 3 * kLanes, r3);
+  } else {
+    tvl::storeu<Vec>(out, r0);
+    tvl::storeu<Vec>(out + kLanes, r1);
+    tvl::storeu<Vec>(out + 2 * kLanes, r2);
+    tvl::storeu<Vec>(out + 3 * kLanes, r3);
+  }
+}
+} // namespace detail
+
+// 'memcpy' implementation that copies at register width. Ends with one masked
+// move on AVX-512 and with a register overlapping the previous one elsewhere.
+// Copies of 'streamingBytes' or more bypass the caches.
+template <tvl::VectorProcessingStyle Vec>
+inline void memcpy(
+    void* to,
+    const void* from,
+    int64_t bytes,
+    int64_t streamingBytes = kStreamingBytes) {
+  constexpr int32_t kByteWidth = Vec::vector_size_B();
+  if (bytes < kByteWidth) {
+    if constexpr (hasMaskedTail<Vec>()) {
+      tvl::storeu_partial<Vec>(
+          detail::lanes<Vec>(to),
+          tvl::loadu_partial<Vec>(detail::lanes<Vec>(from), bytes),
+          bytes);
+    } else {
+      for (int32_t width = kByteWidth / 2; width >= 1 && bytes; width /= 2) {
+        if (bytes >= width) {
+          std::memcpy(to, from, width);
+          from = addBytes(from, width);
+          to = addBytes(to, width);
+          bytes -= width;
+        }
+      }
+    }
+    return;
+  }
+  auto const* end = addBytes(from, bytes);
+  auto* toEnd = addBytes(to, bytes);
+  // Streaming needs the aligned loop below.
+  bool const streaming = bytes > 4 * kByteWidth && bytes >= streamingBytes;
+  if (bytes > 4 * kByteWidth) {
+    // The first register is stored unaligned, the loop starts at the next
+    // aligned address of 'to' so no store splits a cache line.
+    tvl::storeu<Vec>(
+        detail::lanes<Vec>(to), tvl::loadu<Vec>(detail::lanes<Vec>(from)));
+    auto head = detail::bytesToAlignment<Vec>(to);
+    from = addBytes(from, head);
+    to = addBytes(to, head);
+    bytes -= head;
+  }
+  if (streaming) {
+    while (bytes >= 4 * kByteWidth) {
+      detail::copy4<Vec, true>(to, from);
+      from = addBytes(from, 4 * kByteWidth);
+      to = addBytes(to, 4 * kByteWidth);
+      bytes -= 4 * kByteWidth;
+    }
+    while (bytes >= kByteWidth) {
+      tvl::stream<Vec>(
+          detail::lanes<Vec>(to), tvl::loadu<Vec>(detail::lanes<Vec>(from)));
+      from = addBytes(from, kByteWidth);
+      to = addBytes(to, kByteWidth);
+      bytes -= kByteWidth;
+    }
+    tvl::stream_fence<Vec>();
+  } else {
+    while (bytes > 4 * kByteWidth) {
+      detail::copy4<Vec, false>(to, from);
+      from = addBytes(from, 4 * kByteWidth);
+      to = addBytes(to, 4 * kByteWidth);
+      bytes -= 4 * kByteWidth;
+    }
+    while (bytes > kByteWidth) {
+      tvl::storeu<Vec>(
+          detail::lanes<Vec>(to), tvl::loadu<Vec>(detail::lanes<Vec>(from)));
+      from = addBytes(from, kByteWidth);
+      to = addBytes(to, kByteWidth);
+      bytes -= kByteWidth;
+    }
+  }
+  if constexpr (hasMaskedTail<Vec>()) {
+    tvl::storeu_partial<Vec>(
+        detail::lanes<Vec>(to),
+        tvl::loadu_partial<Vec>(detail::lanes<Vec>(from), bytes),
+        bytes);
+  } else if (bytes) {
+    tvl::storeu<Vec>(
+        detail::lanes<Vec>(addBytes(toEnd, -kByteWidth)),
+        tvl::loadu<Vec>(detail::lanes<Vec>(addBytes(end, -kByteWidth))));
+  }
+}
+
+// memset implementation that writes at register width and unrolls for
+// constant values of 'bytes'.
+template <tvl::VectorProcessingStyle Vec>
+inline void memset(void* to, char data, int32_t bytes) {
+  constexpr int32_t kByteWidth = Vec::vector_size_B();
+  constexpr int32_t kWordBytes = sizeof(int64_t);
+  int64_t data64 = 0x0101010101010101ULL * static_cast<uint8_t>(data);
+  auto dataVec = tvl::set1<Vec>(data64);
+  while (bytes >= kByteWidth) {
+    tvl::storeu<Vec>(reinterpret_cast<int64_t*>(to), dataVec);
+    to = addBytes(to, kByteWidth);
+    bytes -= kByteWidth;
+  }
+  while (bytes >= kWordBytes) {
+    std::memcpy(to, &data64, kWordBytes);
+    to = addBytes(to, kWordBytes);
+    bytes -= kWordBytes;
+  }
+  for (int32_t width = 4; width >= 1 && bytes; width /= 2) {
+    if (bytes >= width) {
+      std::memcpy(to, &data64, width);
+      to = addBytes(to, width);
+      bytes -= width;
+    }
+  }
+}
+
+} // namespace simd
+} // namespace velox
+} // namespace facebook
@@ -0,0 +1,137 @@
+/**********************************************************************************************
+ * This file is part of the TVL Project.                                                      *
+ * Copyright (C) 2022 by TVL-Team                                                             *
+ *                                                                                            *
+ * This file is part of TVL - a template simd library.                                        *
+ *                                                                                            *
+ * This program is free software: you can redistribute it and/or modify it under the          *
+ * terms of the GNU General Public License as published by the Free Software Foundation,      *
+ * either version 3 of the License, or (at your option) any later version.                    *
+ *                                                                                            *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;  *
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  *
+ * See the GNU General Public License for more details.                                       *
+ *                                                                                            *
+ * You should have received a copy of the GNU General Public License along with this program. *
+ * If not, see <http://www.gnu.org/licenses/>.                                                *
+ **********************************************************************************************/
+ //todo: Apache2
+/*
+ * @file lib/generated/declarations/bits.hpp
+ * @date 17.02.2022
+ * @brief Bit counting and bit position primitives.
+ */
+#ifndef TUD_D2RG_TVL_LIB_GENERATED_DECLARATIONS_BITS_HPP
+#define TUD_D2RG_TVL_LIB_GENERATED_DECLARATIONS_BITS_HPP
+
+
+namespace tvl {
+   namespace details {
+      template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof >
+      struct popcount_impl{};
+   } // end namespace details
+   /*
+    * @brief Counts the set bits of every lane.
+    * @details todo.
+    * @param vec Vector containing the values.
+    * @return Vector containing popcount( vec[*] ).
+    */
+   template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof = workaround >
+   [[nodiscard]] 
+   TVL_FORCE_INLINE typename Vec::register_type popcount(
+      typename Vec::register_type  vec
+   ) {
+      return details::popcount_impl< Vec, Idof >::apply(
+         vec
+      );
+   }
+   
+   namespace details {
+      template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof >
+      struct lzcnt_impl{};
+   } // end namespace details
+   /*
+    * @brief Counts the leading zero bits of every lane.
+    * @details todo.
+    * @param vec Vector containing the values.
+    * @return Vector containing the number of leading zeros of vec[*] (64 for 0).
+    */
+   template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof = workaround >
+   [[nodiscard]] 
+   TVL_FORCE_INLINE typename Vec::register_type lzcnt(
+      typename Vec::register_type  vec
+   ) {
+      return details::lzcnt_impl< Vec, Idof >::apply(
+         vec
+      );
+   }
+   
+   namespace details {
+      template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof >
+      struct tzcnt_impl{};
+   } // end namespace details
+   /*
+    * @brief Counts the trailing zero bits of every lane.
+    * @details todo.
+    * @param vec Vector containing the values.
+    * @return Vector containing the number of trailing zeros of vec[*] (64 for 0).
+    */
+   template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof = workaround >
+   [[nodiscard]] 
+   TVL_FORCE_INLINE typename Vec::register_type tzcnt(
+      typename Vec::register_type  vec
+   ) {
+      return details::tzcnt_impl< Vec, Idof >::apply(
+         vec
+      );
+   }
+   
+   namespace details {
+      template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof >
+      struct bit_indices_impl{};
+   } // end namespace details
+   /*
+    * @brief Writes the positions of the set bits of a 16 bit value in ascending order, e.g. to turn a bitmap into row numbers.
+    * @details todo.
+    * @param bits Bits, only the lower 16 are used.
+    * @param base Added to every position.
+    * @param indices Destination, must have room for 16 values. Entries past the returned count are unspecified.
+    * @return Number of indices written (popcount of the lower 16 bits).
+    */
+   template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof = workaround >
+   [[nodiscard]] 
+   TVL_FORCE_INLINE int32_t bit_indices(
+      uint32_t  bits, 
+      int32_t  base, 
+      int32_t *  indices
+   ) {
+      return details::bit_indices_impl< Vec, Idof >::apply(
+         bits, base, indices
+      );
+   }
+   
+   namespace details {
+      template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof >
+      struct deposit_bits_impl{};
+   } // end namespace details
+   /*
+    * @brief Deposits the low bits of a value at the set bits of a mask, like pdep, e.g. to spread the values of a nullable boolean column over its non-null rows.
+    * @details todo.
+    * @param source Bits to deposit, the lowest popcount( mask ) are used.
+    * @param mask Positions to deposit the bits at.
+    * @return The i-th lowest bit of source at the position of the i-th lowest set bit of mask, 0 elsewhere.
+    */
+   template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof = workaround >
+   [[nodiscard]] 
+   TVL_FORCE_INLINE uint64_t deposit_bits(
+      uint64_t  source, 
+      uint64_t  mask
+   ) {
+      return details::deposit_bits_impl< Vec, Idof >::apply(
+         source, mask
+      );
+   }
+   
+} // end of namespace tvl
+
+#endif //TUD_D2RG_TVL_LIB_GENERATED_DECLARATIONS_BITS_HPP
\ No newline at end of file
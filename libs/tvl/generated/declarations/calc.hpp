@@ -24,7 +24,6 @@
 #ifndef TUD_D2RG_TVL_LIB_GENERATED_DECLARATIONS_CALC_HPP
 #define TUD_D2RG_TVL_LIB_GENERATED_DECLARATIONS_CALC_HPP
 
-#include "immintrin.h"
 
 namespace tvl {
    namespace details {
@@ -49,6 +48,246 @@ namespace tvl {
       );
    }
    
+   namespace details {
+      template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof >
+      struct sub_impl{};
+   } // end namespace details
+   /*
+    * @brief Subtracts two vector registers.
+    * @details todo.
+    * @param vec_a Minuend.
+    * @param vec_b Subtrahend.
+    * @return Vector containing vec_a[*] - vec_b[*] (wrapping).
+    */
+   template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof = workaround >
+   [[nodiscard]] 
+   TVL_FORCE_INLINE typename Vec::register_type sub(
+      typename Vec::register_type  vec_a, 
+      typename Vec::register_type  vec_b
+   ) {
+      return details::sub_impl< Vec, Idof >::apply(
+         vec_a, vec_b
+      );
+   }
+   
+   namespace details {
+      template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof >
+      struct mul_impl{};
+   } // end namespace details
+   /*
+    * @brief Multiplies two vector registers and keeps the low 64 bit of every product.
+    * @details todo.
+    * @param vec_a First vector.
+    * @param vec_b Second vector.
+    * @return Vector containing the wrapped products.
+    */
+   template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof = workaround >
+   [[nodiscard]] 
+   TVL_FORCE_INLINE typename Vec::register_type mul(
+      typename Vec::register_type  vec_a, 
+      typename Vec::register_type  vec_b
+   ) {
+      return details::mul_impl< Vec, Idof >::apply(
+         vec_a, vec_b
+      );
+   }
+   
+   namespace details {
+      template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof >
+      struct shift_right_impl{};
+   } // end namespace details
+   /*
+    * @brief Shifts every lane of a vector register logically to the right.
+    * @details todo.
+    * @param vec Vector which should be shifted.
+    * @param shift Number of bits to shift (0 <= shift < lane width).
+    * @return Vector containing the shifted values, filled with zeros from the left.
+    */
+   template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof = workaround >
+   [[nodiscard]] 
+   TVL_FORCE_INLINE typename Vec::register_type shift_right(
+      typename Vec::register_type  vec, 
+      int  shift
+   ) {
+      return details::shift_right_impl< Vec, Idof >::apply(
+         vec, shift
+      );
+   }
+   
+   namespace details {
+      template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof >
+      struct shift_left_impl{};
+   } // end namespace details
+   /*
+    * @brief Shifts every lane of a vector register to the left.
+    * @details todo.
+    * @param vec Vector which should be shifted.
+    * @param shift Number of bits to shift (0 <= shift < lane width).
+    * @return Vector containing the shifted values, filled with zeros from the right.
+    */
+   template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof = workaround >
+   [[nodiscard]] 
+   TVL_FORCE_INLINE typename Vec::register_type shift_left(
+      typename Vec::register_type  vec, 
+      int  shift
+   ) {
+      return details::shift_left_impl< Vec, Idof >::apply(
+         vec, shift
+      );
+   }
+   
+   namespace details {
+      template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof >
+      struct shift_left_variable_impl{};
+   } // end namespace details
+   /*
+    * @brief Shifts every lane of a vector register to the left by its own amount.
+    * @details todo.
+    * @param vec Vector which should be shifted.
+    * @param shift Number of bits to shift every lane (0 <= shift[*] < lane width).
+    * @return Vector containing vec[*] << shift[*], filled with zeros from the right.
+    */
+   template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof = workaround >
+   [[nodiscard]] 
+   TVL_FORCE_INLINE typename Vec::register_type shift_left_variable(
+      typename Vec::register_type  vec, 
+      typename Vec::register_type  shift
+   ) {
+      return details::shift_left_variable_impl< Vec, Idof >::apply(
+         vec, shift
+      );
+   }
+   
+   namespace details {
+      template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof >
+      struct bitwise_and_impl{};
+   } // end namespace details
+   /*
+    * @brief Computes the bitwise and of two vector registers.
+    * @details todo.
+    * @param vec_a First vector.
+    * @param vec_b Second vector.
+    * @return Vector containing vec_a[*] & vec_b[*].
+    */
+   template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof = workaround >
+   [[nodiscard]] 
+   TVL_FORCE_INLINE typename Vec::register_type bitwise_and(
+      typename Vec::register_type  vec_a, 
+      typename Vec::register_type  vec_b
+   ) {
+      return details::bitwise_and_impl< Vec, Idof >::apply(
+         vec_a, vec_b
+      );
+   }
+   
+   namespace details {
+      template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof >
+      struct bitwise_or_impl{};
+   } // end namespace details
+   /*
+    * @brief Computes the bitwise or of two vector registers.
+    * @details todo.
+    * @param vec_a First vector.
+    * @param vec_b Second vector.
+    * @return Vector containing vec_a[*] | vec_b[*].
+    */
+   template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof = workaround >
+   [[nodiscard]] 
+   TVL_FORCE_INLINE typename Vec::register_type bitwise_or(
+      typename Vec::register_type  vec_a, 
+      typename Vec::register_type  vec_b
+   ) {
+      return details::bitwise_or_impl< Vec, Idof >::apply(
+         vec_a, vec_b
+      );
+   }
+   
+   namespace details {
+      template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof >
+      struct bitwise_xor_impl{};
+   } // end namespace details
+   /*
+    * @brief Computes the bitwise exclusive or of two vector registers.
+    * @details todo.
+    * @param vec_a First vector.
+    * @param vec_b Second vector.
+    * @return Vector containing vec_a[*] ^ vec_b[*].
+    */
+   template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof = workaround >
+   [[nodiscard]] 
+   TVL_FORCE_INLINE typename Vec::register_type bitwise_xor(
+      typename Vec::register_type  vec_a, 
+      typename Vec::register_type  vec_b
+   ) {
+      return details::bitwise_xor_impl< Vec, Idof >::apply(
+         vec_a, vec_b
+      );
+   }
+   
+   namespace details {
+      template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof >
+      struct bitwise_andnot_impl{};
+   } // end namespace details
+   /*
+    * @brief Computes the bitwise and of a vector register with the complement of another one.
+    * @details todo.
+    * @param vec_a First vector.
+    * @param vec_b Second vector, complemented.
+    * @return Vector containing vec_a[*] & ~vec_b[*].
+    */
+   template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof = workaround >
+   [[nodiscard]] 
+   TVL_FORCE_INLINE typename Vec::register_type bitwise_andnot(
+      typename Vec::register_type  vec_a, 
+      typename Vec::register_type  vec_b
+   ) {
+      return details::bitwise_andnot_impl< Vec, Idof >::apply(
+         vec_a, vec_b
+      );
+   }
+   
+   namespace details {
+      template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof >
+      struct bitwise_ornot_impl{};
+   } // end namespace details
+   /*
+    * @brief Computes the bitwise or of a vector register with the complement of another one.
+    * @details todo.
+    * @param vec_a First vector.
+    * @param vec_b Second vector, complemented.
+    * @return Vector containing vec_a[*] | ~vec_b[*].
+    */
+   template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof = workaround >
+   [[nodiscard]] 
+   TVL_FORCE_INLINE typename Vec::register_type bitwise_ornot(
+      typename Vec::register_type  vec_a, 
+      typename Vec::register_type  vec_b
+   ) {
+      return details::bitwise_ornot_impl< Vec, Idof >::apply(
+         vec_a, vec_b
+      );
+   }
+   
+   namespace details {
+      template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof >
+      struct bitwise_not_impl{};
+   } // end namespace details
+   /*
+    * @brief Computes the bitwise complement of a vector register.
+    * @details todo.
+    * @param vec Vector.
+    * @return Vector containing ~vec[*].
+    */
+   template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof = workaround >
+   [[nodiscard]] 
+   TVL_FORCE_INLINE typename Vec::register_type bitwise_not(
+      typename Vec::register_type  vec
+   ) {
+      return details::bitwise_not_impl< Vec, Idof >::apply(
+         vec
+      );
+   }
+   
 } // end of namespace tvl
 
 #endif //TUD_D2RG_TVL_LIB_GENERATED_DECLARATIONS_CALC_HPP
\ No newline at end of file
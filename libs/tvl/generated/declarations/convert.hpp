@@ -0,0 +1,373 @@
+/**********************************************************************************************
+ * This file is part of the TVL Project.                                                      *
+ * Copyright (C) 2022 by TVL-Team                                                             *
+ *                                                                                            *
+ * This file is part of TVL - a template simd library.                                        *
+ *                                                                                            *
+ * This program is free software: you can redistribute it and/or modify it under the          *
+ * terms of the GNU General Public License as published by the Free Software Foundation,      *
+ * either version 3 of the License, or (at your option) any later version.                    *
+ *                                                                                            *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;  *
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  *
+ * See the GNU General Public License for more details.                                       *
+ *                                                                                            *
+ * You should have received a copy of the GNU General Public License along with this program. *
+ * If not, see <http://www.gnu.org/licenses/>.                                                *
+ **********************************************************************************************/
+ //todo: Apache2
+/*
+ * @file lib/generated/declarations/convert.hpp
+ * @date 17.02.2022
+ * @brief Conversion primitives.
+ */
+#ifndef TUD_D2RG_TVL_LIB_GENERATED_DECLARATIONS_CONVERT_HPP
+#define TUD_D2RG_TVL_LIB_GENERATED_DECLARATIONS_CONVERT_HPP
+
+
+namespace tvl {
+   namespace details {
+      template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof >
+      struct loadu_extend_int8_impl{};
+   } // end namespace details
+   /*
+    * @brief Loads vector_element_count() 8 bit values from unaligned memory and sign extends them to 64 bit.
+    * @details todo.
+    * @param memory Memory address containing the values.
+    * @return Vector containing the sign extended values.
+    */
+   template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof = workaround >
+   [[nodiscard]] 
+   TVL_FORCE_INLINE typename Vec::register_type loadu_extend_int8(
+      int8_t const *  memory
+   ) {
+      return details::loadu_extend_int8_impl< Vec, Idof >::apply(
+         memory
+      );
+   }
+   
+   namespace details {
+      template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof >
+      struct loadu_extend_int16_impl{};
+   } // end namespace details
+   /*
+    * @brief Loads vector_element_count() 16 bit values from unaligned memory and sign extends them to 64 bit.
+    * @details todo.
+    * @param memory Memory address containing the values.
+    * @return Vector containing the sign extended values.
+    */
+   template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof = workaround >
+   [[nodiscard]] 
+   TVL_FORCE_INLINE typename Vec::register_type loadu_extend_int16(
+      int16_t const *  memory
+   ) {
+      return details::loadu_extend_int16_impl< Vec, Idof >::apply(
+         memory
+      );
+   }
+   
+   namespace details {
+      template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof >
+      struct loadu_extend_int32_impl{};
+   } // end namespace details
+   /*
+    * @brief Loads vector_element_count() 32 bit values from unaligned memory and sign extends them to 64 bit.
+    * @details todo.
+    * @param memory Memory address containing the values.
+    * @return Vector containing the sign extended values.
+    */
+   template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof = workaround >
+   [[nodiscard]] 
+   TVL_FORCE_INLINE typename Vec::register_type loadu_extend_int32(
+      int32_t const *  memory
+   ) {
+      return details::loadu_extend_int32_impl< Vec, Idof >::apply(
+         memory
+      );
+   }
+   
+   namespace details {
+      template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof >
+      struct loadu_extend_uint8_impl{};
+   } // end namespace details
+   /*
+    * @brief Loads vector_element_count() 8 bit values from unaligned memory and zero extends them to 64 bit.
+    * @details todo.
+    * @param memory Memory address containing the values.
+    * @return Vector containing the zero extended values.
+    */
+   template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof = workaround >
+   [[nodiscard]] 
+   TVL_FORCE_INLINE typename Vec::register_type loadu_extend_uint8(
+      uint8_t const *  memory
+   ) {
+      return details::loadu_extend_uint8_impl< Vec, Idof >::apply(
+         memory
+      );
+   }
+   
+   namespace details {
+      template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof >
+      struct loadu_extend_uint16_impl{};
+   } // end namespace details
+   /*
+    * @brief Loads vector_element_count() 16 bit values from unaligned memory and zero extends them to 64 bit.
+    * @details todo.
+    * @param memory Memory address containing the values.
+    * @return Vector containing the zero extended values.
+    */
+   template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof = workaround >
+   [[nodiscard]] 
+   TVL_FORCE_INLINE typename Vec::register_type loadu_extend_uint16(
+      uint16_t const *  memory
+   ) {
+      return details::loadu_extend_uint16_impl< Vec, Idof >::apply(
+         memory
+      );
+   }
+   
+   namespace details {
+      template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof >
+      struct loadu_extend_uint32_impl{};
+   } // end namespace details
+   /*
+    * @brief Loads vector_element_count() 32 bit values from unaligned memory and zero extends them to 64 bit.
+    * @details todo.
+    * @param memory Memory address containing the values.
+    * @return Vector containing the zero extended values.
+    */
+   template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof = workaround >
+   [[nodiscard]] 
+   TVL_FORCE_INLINE typename Vec::register_type loadu_extend_uint32(
+      uint32_t const *  memory
+   ) {
+      return details::loadu_extend_uint32_impl< Vec, Idof >::apply(
+         memory
+      );
+   }
+   
+   namespace details {
+      template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof >
+      struct maskz_loadu_extend_int32_impl{};
+   } // end namespace details
+   /*
+    * @brief Loads the selected 32 bit values from unaligned memory, sign extends them to 64 bit and zeroes the other lanes.
+    * @details todo.
+    * @param memory Memory address containing the values, lanes which are not selected are not accessed.
+    * @param mask Vector mask register selecting the lanes to load.
+    * @return Vector containing the sign extended values and zero in all other lanes.
+    */
+   template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof = workaround >
+   [[nodiscard]] 
+   TVL_FORCE_INLINE typename Vec::register_type maskz_loadu_extend_int32(
+      int32_t const *  memory, 
+      typename Vec::mask_type  mask
+   ) {
+      return details::maskz_loadu_extend_int32_impl< Vec, Idof >::apply(
+         memory, mask
+      );
+   }
+   
+   namespace details {
+      template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof >
+      struct narrow_int32_impl{};
+   } // end namespace details
+   /*
+    * @brief Truncates every 64 bit lane to 32 bit and packs the results into the lower half of the register.
+    * @details todo.
+    * @param vec Vector containing the values.
+    * @return Register holding vector_element_count() int32_t values in its lower half and zeros in the upper half.
+    */
+   template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof = workaround >
+   [[nodiscard]] 
+   TVL_FORCE_INLINE typename Vec::register_type narrow_int32(
+      typename Vec::register_type  vec
+   ) {
+      return details::narrow_int32_impl< Vec, Idof >::apply(
+         vec
+      );
+   }
+   
+   namespace details {
+      template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof >
+      struct narrow_int32_saturate_impl{};
+   } // end namespace details
+   /*
+    * @brief Clamps every 64 bit lane to the int32_t range and packs the results into the lower half of the register.
+    * @details todo.
+    * @param vec Vector containing the values.
+    * @return Register holding vector_element_count() int32_t values in its lower half and zeros in the upper half.
+    */
+   template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof = workaround >
+   [[nodiscard]] 
+   TVL_FORCE_INLINE typename Vec::register_type narrow_int32_saturate(
+      typename Vec::register_type  vec
+   ) {
+      return details::narrow_int32_saturate_impl< Vec, Idof >::apply(
+         vec
+      );
+   }
+   
+   namespace details {
+      template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof >
+      struct to_double_impl{};
+   } // end namespace details
+   /*
+    * @brief Converts every 64 bit integer lane to double.
+    * @details todo.
+    * @param vec Vector containing the values.
+    * @return Vector containing the values rounded to the nearest double.
+    */
+   template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof = workaround >
+   [[nodiscard]] 
+   TVL_FORCE_INLINE typename simd< double, typename Vec::target_extension, Vec::vector_size_b() >::register_type to_double(
+      typename Vec::register_type  vec
+   ) {
+      return details::to_double_impl< Vec, Idof >::apply(
+         vec
+      );
+   }
+   
+   namespace details {
+      template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof >
+      struct from_double_impl{};
+   } // end namespace details
+   /*
+    * @brief Converts every double lane to a 64 bit integer, rounding towards zero.
+    * @details todo.
+    * @param vec Vector containing the values (must be representable as int64_t).
+    * @return Vector containing the truncated values.
+    */
+   template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof = workaround >
+   [[nodiscard]] 
+   TVL_FORCE_INLINE typename Vec::register_type from_double(
+      typename simd< double, typename Vec::target_extension, Vec::vector_size_b() >::register_type  vec
+   ) {
+      return details::from_double_impl< Vec, Idof >::apply(
+         vec
+      );
+   }
+   
+   namespace details {
+      template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof >
+      struct to_float_impl{};
+   } // end namespace details
+   /*
+    * @brief Converts every 32 bit integer lane of an integral register to float.
+    * @details todo.
+    * @param vec Register holding 2 * vector_element_count() int32_t values.
+    * @return Vector containing the values rounded to the nearest float.
+    */
+   template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof = workaround >
+   [[nodiscard]] 
+   TVL_FORCE_INLINE typename simd< float, typename Vec::target_extension, Vec::vector_size_b() >::register_type to_float(
+      typename Vec::register_type  vec
+   ) {
+      return details::to_float_impl< Vec, Idof >::apply(
+         vec
+      );
+   }
+   
+   namespace details {
+      template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof >
+      struct from_float_impl{};
+   } // end namespace details
+   /*
+    * @brief Converts every float lane to a 32 bit integer, rounding towards zero.
+    * @details todo.
+    * @param vec Vector containing the values (must be representable as int32_t).
+    * @return Register holding 2 * vector_element_count() int32_t values.
+    */
+   template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof = workaround >
+   [[nodiscard]] 
+   TVL_FORCE_INLINE typename Vec::register_type from_float(
+      typename simd< float, typename Vec::target_extension, Vec::vector_size_b() >::register_type  vec
+   ) {
+      return details::from_float_impl< Vec, Idof >::apply(
+         vec
+      );
+   }
+   
+   namespace details {
+      template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof >
+      struct reinterpret_as_double_impl{};
+   } // end namespace details
+   /*
+    * @brief Reinterprets the bits of an integral register as double lanes.
+    * @details todo.
+    * @param vec Vector containing the bits.
+    * @return The same bits as double register.
+    */
+   template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof = workaround >
+   [[nodiscard]] 
+   TVL_FORCE_INLINE typename simd< double, typename Vec::target_extension, Vec::vector_size_b() >::register_type reinterpret_as_double(
+      typename Vec::register_type  vec
+   ) {
+      return details::reinterpret_as_double_impl< Vec, Idof >::apply(
+         vec
+      );
+   }
+   
+   namespace details {
+      template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof >
+      struct reinterpret_from_double_impl{};
+   } // end namespace details
+   /*
+    * @brief Reinterprets the bits of a double register as integral lanes.
+    * @details todo.
+    * @param vec Vector containing the bits.
+    * @return The same bits as integral register.
+    */
+   template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof = workaround >
+   [[nodiscard]] 
+   TVL_FORCE_INLINE typename Vec::register_type reinterpret_from_double(
+      typename simd< double, typename Vec::target_extension, Vec::vector_size_b() >::register_type  vec
+   ) {
+      return details::reinterpret_from_double_impl< Vec, Idof >::apply(
+         vec
+      );
+   }
+   
+   namespace details {
+      template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof >
+      struct reinterpret_as_float_impl{};
+   } // end namespace details
+   /*
+    * @brief Reinterprets the bits of an integral register as float lanes.
+    * @details todo.
+    * @param vec Vector containing the bits.
+    * @return The same bits as float register.
+    */
+   template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof = workaround >
+   [[nodiscard]] 
+   TVL_FORCE_INLINE typename simd< float, typename Vec::target_extension, Vec::vector_size_b() >::register_type reinterpret_as_float(
+      typename Vec::register_type  vec
+   ) {
+      return details::reinterpret_as_float_impl< Vec, Idof >::apply(
+         vec
+      );
+   }
+   
+   namespace details {
+      template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof >
+      struct reinterpret_from_float_impl{};
+   } // end namespace details
+   /*
+    * @brief Reinterprets the bits of a float register as integral lanes.
+    * @details todo.
+    * @param vec Vector containing the bits.
+    * @return The same bits as integral register.
+    */
+   template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof = workaround >
+   [[nodiscard]] 
+   TVL_FORCE_INLINE typename Vec::register_type reinterpret_from_float(
+      typename simd< float, typename Vec::target_extension, Vec::vector_size_b() >::register_type  vec
+   ) {
+      return details::reinterpret_from_float_impl< Vec, Idof >::apply(
+         vec
+      );
+   }
+   
+} // end of namespace tvl
+
+#endif //TUD_D2RG_TVL_LIB_GENERATED_DECLARATIONS_CONVERT_HPP
\ No newline at end of file
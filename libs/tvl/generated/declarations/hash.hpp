@@ -0,0 +1,141 @@
+/**********************************************************************************************
+ * This file is part of the TVL Project.                                                      *
+ * Copyright (C) 2022 by TVL-Team                                                             *
+ *                                                                                            *
+ * This file is part of TVL - a template simd library.                                        *
+ *                                                                                            *
+ * This program is free software: you can redistribute it and/or modify it under the          *
+ * terms of the GNU General Public License as published by the Free Software Foundation,      *
+ * either version 3 of the License, or (at your option) any later version.                    *
+ *                                                                                            *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;  *
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  *
+ * See the GNU General Public License for more details.                                       *
+ *                                                                                            *
+ * You should have received a copy of the GNU General Public License along with this program. *
+ * If not, see <http://www.gnu.org/licenses/>.                                                *
+ **********************************************************************************************/
+ //todo: Apache2
+/*
+ * @file lib/generated/declarations/hash.hpp
+ * @date 17.02.2022
+ * @brief Hash primitives.
+ */
+#ifndef TUD_D2RG_TVL_LIB_GENERATED_DECLARATIONS_HASH_HPP
+#define TUD_D2RG_TVL_LIB_GENERATED_DECLARATIONS_HASH_HPP
+
+
+namespace tvl {
+   namespace details {
+      template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof >
+      struct hash_mix_impl{};
+   } // end namespace details
+   /*
+    * @brief Combines two 64 bit hashes per lane into one (Hash128to64 from cityhash, same as bits::hashMix).
+    * @details todo.
+    * @param upper First hash.
+    * @param lower Second hash.
+    * @return Vector containing hashMix( upper[*], lower[*] ).
+    */
+   template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof = workaround >
+   [[nodiscard]] 
+   TVL_FORCE_INLINE typename Vec::register_type hash_mix(
+      typename Vec::register_type  upper, 
+      typename Vec::register_type  lower
+   ) {
+      return details::hash_mix_impl< Vec, Idof >::apply(
+         upper, lower
+      );
+   }
+   
+   namespace details {
+      template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof >
+      struct commutative_hash_mix_impl{};
+   } // end namespace details
+   /*
+    * @brief Combines two 64 bit hashes per lane independent of their order (same as bits::commutativeHashMix).
+    * @details todo.
+    * @param upper First hash.
+    * @param lower Second hash.
+    * @return Vector containing commutativeHashMix( upper[*], lower[*] ).
+    */
+   template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof = workaround >
+   [[nodiscard]] 
+   TVL_FORCE_INLINE typename Vec::register_type commutative_hash_mix(
+      typename Vec::register_type  upper, 
+      typename Vec::register_type  lower
+   ) {
+      return details::commutative_hash_mix_impl< Vec, Idof >::apply(
+         upper, lower
+      );
+   }
+   
+   namespace details {
+      template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof >
+      struct hash_finalize_impl{};
+   } // end namespace details
+   /*
+    * @brief Applies the 64 bit murmur3 finalizer (fmix64) to every lane.
+    * @details todo.
+    * @param vec Keys or partial hashes.
+    * @return Vector containing the avalanched values.
+    */
+   template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof = workaround >
+   [[nodiscard]] 
+   TVL_FORCE_INLINE typename Vec::register_type hash_finalize(
+      typename Vec::register_type  vec
+   ) {
+      return details::hash_finalize_impl< Vec, Idof >::apply(
+         vec
+      );
+   }
+   
+   namespace details {
+      template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof >
+      struct multiply_shift_impl{};
+   } // end namespace details
+   /*
+    * @brief Multiply-shift hashing: keeps the upper bits of vec[*] * multiplier.
+    * @details todo.
+    * @param vec Keys which should be hashed.
+    * @param multiplier Odd multiplier.
+    * @param shift 64 - number of result bits.
+    * @return Vector containing ( vec[*] * multiplier ) >> shift.
+    */
+   template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof = workaround >
+   [[nodiscard]] 
+   TVL_FORCE_INLINE typename Vec::register_type multiply_shift(
+      typename Vec::register_type  vec, 
+      typename Vec::base_type  multiplier, 
+      int  shift
+   ) {
+      return details::multiply_shift_impl< Vec, Idof >::apply(
+         vec, multiplier, shift
+      );
+   }
+   
+   namespace details {
+      template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof >
+      struct crc32c_impl{};
+   } // end namespace details
+   /*
+    * @brief Accumulates 8 bytes per lane into a CRC32C (Castagnoli) checksum.
+    * @details todo.
+    * @param crc Running checksums (lower 32 bit of every lane).
+    * @param data Data which should be accumulated.
+    * @return Vector containing the updated checksums (zero extended).
+    */
+   template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof = workaround >
+   [[nodiscard]] 
+   TVL_FORCE_INLINE typename Vec::register_type crc32c(
+      typename Vec::register_type  crc, 
+      typename Vec::register_type  data
+   ) {
+      return details::crc32c_impl< Vec, Idof >::apply(
+         crc, data
+      );
+   }
+   
+} // end of namespace tvl
+
+#endif //TUD_D2RG_TVL_LIB_GENERATED_DECLARATIONS_HASH_HPP
\ No newline at end of file
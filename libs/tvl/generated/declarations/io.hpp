@@ -66,6 +66,154 @@ namespace tvl {
       );
    }
    
+   namespace details {
+      template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof >
+      struct store_impl{};
+   } // end namespace details
+   /*
+    * @brief Stores a vector register into aligned memory.
+    * @details todo.
+    * @param memory Aligned memory which should receive the vector register.
+    * @param vec Vector which should be stored.
+    * @return Nothing.
+    */
+   template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof = workaround >
+   TVL_FORCE_INLINE void store(
+      typename Vec::base_type *  memory, 
+      typename Vec::register_type  vec
+   ) {
+      return details::store_impl< Vec, Idof >::apply(
+         memory, vec
+      );
+   }
+   
+   namespace details {
+      template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof >
+      struct storeu_impl{};
+   } // end namespace details
+   /*
+    * @brief Stores a vector register into (un)aligned memory.
+    * @details todo.
+    * @param memory (Un)aligned memory which should receive the vector register.
+    * @param vec Vector which should be stored.
+    * @return Nothing.
+    */
+   template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof = workaround >
+   TVL_FORCE_INLINE void storeu(
+      typename Vec::base_type *  memory, 
+      typename Vec::register_type  vec
+   ) {
+      return details::storeu_impl< Vec, Idof >::apply(
+         memory, vec
+      );
+   }
+   
+   namespace details {
+      template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof >
+      struct maskz_loadu_impl{};
+   } // end namespace details
+   /*
+    * @brief Loads the selected lanes from (un)aligned memory and zeroes the others.
+    * @details todo.
+    * @param memory (Un)aligned memory, lanes which are not selected are not accessed.
+    * @param mask Vector mask register selecting the lanes to load.
+    * @return Vector containing the loaded lanes and zero in all other lanes.
+    */
+   template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof = workaround >
+   [[nodiscard]] 
+   TVL_FORCE_INLINE typename Vec::register_type maskz_loadu(
+      typename Vec::base_type const *  memory, 
+      typename Vec::mask_type  mask
+   ) {
+      return details::maskz_loadu_impl< Vec, Idof >::apply(
+         memory, mask
+      );
+   }
+   
+   namespace details {
+      template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof >
+      struct loadu_partial_impl{};
+   } // end namespace details
+   /*
+    * @brief Loads the first bytes of a vector register from (un)aligned memory and zeroes the rest.
+    * @details todo.
+    * @param memory (Un)aligned memory, only [memory, memory + bytes) is accessed.
+    * @param bytes Number of bytes to load, in [0, vector_size_B()].
+    * @return Vector containing the loaded bytes followed by zeroes.
+    */
+   template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof = workaround >
+   [[nodiscard]] 
+   TVL_FORCE_INLINE typename Vec::register_type loadu_partial(
+      typename Vec::base_type const *  memory, 
+      int32_t  bytes
+   ) {
+      return details::loadu_partial_impl< Vec, Idof >::apply(
+         memory, bytes
+      );
+   }
+   
+   namespace details {
+      template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof >
+      struct storeu_partial_impl{};
+   } // end namespace details
+   /*
+    * @brief Stores the first bytes of a vector register into (un)aligned memory.
+    * @details todo.
+    * @param memory (Un)aligned memory, only [memory, memory + bytes) is written.
+    * @param vec Vector which should be stored.
+    * @param bytes Number of bytes to store, in [0, vector_size_B()].
+    * @return Nothing.
+    */
+   template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof = workaround >
+   TVL_FORCE_INLINE void storeu_partial(
+      typename Vec::base_type *  memory, 
+      typename Vec::register_type  vec, 
+      int32_t  bytes
+   ) {
+      return details::storeu_partial_impl< Vec, Idof >::apply(
+         memory, vec, bytes
+      );
+   }
+   
+   namespace details {
+      template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof >
+      struct stream_impl{};
+   } // end namespace details
+   /*
+    * @brief Stores a vector register into aligned memory bypassing the caches (non-temporal store).
+    * @details todo.
+    * @param memory Aligned memory which should receive the vector register.
+    * @param vec Vector which should be stored.
+    * @return Nothing. Call stream_fence before the memory is handed to another thread.
+    */
+   template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof = workaround >
+   TVL_FORCE_INLINE void stream(
+      typename Vec::base_type *  memory, 
+      typename Vec::register_type  vec
+   ) {
+      return details::stream_impl< Vec, Idof >::apply(
+         memory, vec
+      );
+   }
+   
+   namespace details {
+      template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof >
+      struct stream_fence_impl{};
+   } // end namespace details
+   /*
+    * @brief Orders preceding stream stores before all following stores.
+    * @details todo.
+    * @return Nothing.
+    */
+   template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof = workaround >
+   TVL_FORCE_INLINE void stream_fence(
+
+   ) {
+      return details::stream_fence_impl< Vec, Idof >::apply(
+         
+      );
+   }
+   
    namespace details {
       template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof >
       struct set1_impl{};
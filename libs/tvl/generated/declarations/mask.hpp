@@ -46,6 +46,46 @@ namespace tvl {
       );
    }
    
+   namespace details {
+      template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof >
+      struct from_integral_impl{};
+   } // end namespace details
+   /*
+    * @brief Forms a vector mask register from the lower bits of an integral value (inverse of to_integral).
+    * @details todo.
+    * @param mask Integral value, bit i selects lane i.
+    * @return Vector mask register selecting the lanes whose bit is set.
+    */
+   template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof = workaround >
+   [[nodiscard]] 
+   TVL_FORCE_INLINE typename Vec::mask_type from_integral(
+      typename Vec::base_type  mask
+   ) {
+      return details::from_integral_impl< Vec, Idof >::apply(
+         mask
+      );
+   }
+   
+   namespace details {
+      template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof >
+      struct leading_mask_impl{};
+   } // end namespace details
+   /*
+    * @brief Forms a vector mask register selecting the first lanes, e.g. for the ragged tail of a batch.
+    * @details todo.
+    * @param count Number of selected lanes, in [0, vector_element_count()].
+    * @return Vector mask register selecting the lanes [0, count).
+    */
+   template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof = workaround >
+   [[nodiscard]] 
+   TVL_FORCE_INLINE typename Vec::mask_type leading_mask(
+      int32_t  count
+   ) {
+      return details::leading_mask_impl< Vec, Idof >::apply(
+         count
+      );
+   }
+   
    namespace details {
       template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof >
       struct get_msb_impl{};
@@ -106,6 +146,48 @@ namespace tvl {
       );
    }
    
+   namespace details {
+      template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof >
+      struct mask_popcount_impl{};
+   } // end namespace details
+   /*
+    * @brief Counts the relevant set bits of an integral mask.
+    * @details todo.
+    * @param mask Integral value containing n (set) bits (see to_integral and get_msb).
+    * @return Number of lanes selected by mask.
+    */
+   template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof = workaround >
+   [[nodiscard]] 
+   TVL_FORCE_INLINE typename Vec::base_type mask_popcount(
+      typename Vec::base_type  mask
+   ) {
+      return details::mask_popcount_impl< Vec, Idof >::apply(
+         mask
+      );
+   }
+   
+   namespace details {
+      template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof >
+      struct mask_lane_indices_impl{};
+   } // end namespace details
+   /*
+    * @brief Writes the indices of the lanes selected by an integral mask in ascending order.
+    * @details todo.
+    * @param mask Integral value containing n (set) bits (see to_integral and get_msb).
+    * @param indices Destination, must have room for Vec::vector_element_count() values. Entries past the returned count are unspecified.
+    * @return Number of indices written (same as mask_popcount).
+    */
+   template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof = workaround >
+   [[nodiscard]] 
+   TVL_FORCE_INLINE typename Vec::base_type mask_lane_indices(
+      typename Vec::base_type  mask, 
+      int32_t *  indices
+   ) {
+      return details::mask_lane_indices_impl< Vec, Idof >::apply(
+         mask, indices
+      );
+   }
+   
 } // end of namespace tvl
 
 #endif //TUD_D2RG_TVL_LIB_GENERATED_DECLARATIONS_MASK_HPP
\ No newline at end of file
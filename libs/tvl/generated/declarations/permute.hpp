@@ -0,0 +1,121 @@
+/**********************************************************************************************
+ * This file is part of the TVL Project.                                                      *
+ * Copyright (C) 2022 by TVL-Team                                                             *
+ *                                                                                            *
+ * This file is part of TVL - a template simd library.                                        *
+ *                                                                                            *
+ * This program is free software: you can redistribute it and/or modify it under the          *
+ * terms of the GNU General Public License as published by the Free Software Foundation,      *
+ * either version 3 of the License, or (at your option) any later version.                    *
+ *                                                                                            *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;  *
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  *
+ * See the GNU General Public License for more details.                                       *
+ *                                                                                            *
+ * You should have received a copy of the GNU General Public License along with this program. *
+ * If not, see <http://www.gnu.org/licenses/>.                                                *
+ **********************************************************************************************/
+ //todo: Apache2
+/*
+ * @file lib/generated/declarations/permute.hpp
+ * @date 17.02.2022
+ * @brief Permutation and lookup primitives.
+ */
+#ifndef TUD_D2RG_TVL_LIB_GENERATED_DECLARATIONS_PERMUTE_HPP
+#define TUD_D2RG_TVL_LIB_GENERATED_DECLARATIONS_PERMUTE_HPP
+
+
+namespace tvl {
+   namespace details {
+      template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof >
+      struct permute_impl{};
+   } // end namespace details
+   /*
+    * @brief Rearranges the lanes of a vector register.
+    * @details todo.
+    * @param vec Vector containing the values.
+    * @param indices Source lane for every result lane (only the lower log2( vector_element_count() ) bits are used).
+    * @return Vector containing vec[ indices[*] ].
+    */
+   template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof = workaround >
+   [[nodiscard]] 
+   TVL_FORCE_INLINE typename Vec::register_type permute(
+      typename Vec::register_type  vec, 
+      typename Vec::register_type  indices
+   ) {
+      return details::permute_impl< Vec, Idof >::apply(
+         vec, indices
+      );
+   }
+   
+   namespace details {
+      template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof >
+      struct permute2_impl{};
+   } // end namespace details
+   /*
+    * @brief Selects lanes from the concatenation of two vector registers.
+    * @details todo.
+    * @param vec_a Vector containing the lanes [0, vector_element_count()).
+    * @param vec_b Vector containing the lanes [vector_element_count(), 2 * vector_element_count()).
+    * @param indices Source lane for every result lane (only the lower log2( vector_element_count() ) + 1 bits are used).
+    * @return Vector containing { vec_a, vec_b }[ indices[*] ].
+    */
+   template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof = workaround >
+   [[nodiscard]] 
+   TVL_FORCE_INLINE typename Vec::register_type permute2(
+      typename Vec::register_type  vec_a, 
+      typename Vec::register_type  vec_b, 
+      typename Vec::register_type  indices
+   ) {
+      return details::permute2_impl< Vec, Idof >::apply(
+         vec_a, vec_b, indices
+      );
+   }
+   
+   namespace details {
+      template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof >
+      struct lookup_bytes_impl{};
+   } // end namespace details
+   /*
+    * @brief Looks up every byte of indices in a table held in one vector register.
+    * @details todo.
+    * @param table Table of vector_size_B() bytes.
+    * @param indices Byte indices into table (only the lower log2( vector_size_B() ) bits are used).
+    * @return Register containing the bytes table[ indices[*] ].
+    */
+   template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof = workaround >
+   [[nodiscard]] 
+   TVL_FORCE_INLINE typename Vec::register_type lookup_bytes(
+      typename Vec::register_type  table, 
+      typename Vec::register_type  indices
+   ) {
+      return details::lookup_bytes_impl< Vec, Idof >::apply(
+         table, indices
+      );
+   }
+   
+   namespace details {
+      template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof >
+      struct shuffle_bytes_impl{};
+   } // end namespace details
+   /*
+    * @brief Shuffles the bytes within every 128 bit lane of a vector register (pshufb semantics).
+    * @details todo.
+    * @param vec Vector containing the bytes.
+    * @param indices Byte index within the same 128 bit lane, the result byte is zero if bit 7 is set.
+    * @return Register containing the shuffled bytes.
+    */
+   template< VectorProcessingStyle Vec, ImplementationDegreeOfFreedom Idof = workaround >
+   [[nodiscard]] 
+   TVL_FORCE_INLINE typename Vec::register_type shuffle_bytes(
+      typename Vec::register_type  vec, 
+      typename Vec::register_type  indices
+   ) {
+      return details::shuffle_bytes_impl< Vec, Idof >::apply(
+         vec, indices
+      );
+   }
+   
+} // end of namespace tvl
+
+#endif //TUD_D2RG_TVL_LIB_GENERATED_DECLARATIONS_PERMUTE_HPP
\ No newline at end of file
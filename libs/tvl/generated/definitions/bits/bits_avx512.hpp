@@ -0,0 +1,293 @@
+/**********************************************************************************************
+ * This file is part of the TVL Project.                                                      *
+ * Copyright (C) 2022 by TVL-Team                                                             *
+ *                                                                                            *
+ * This file is part of TVL - a template simd library.                                        *
+ *                                                                                            *
+ * This program is free software: you can redistribute it and/or modify it under the          *
+ * terms of the GNU General Public License as published by the Free Software Foundation,      *
+ * either version 3 of the License, or (at your option) any later version.                    *
+ *                                                                                            *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;  *
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  *
+ * See the GNU General Public License for more details.                                       *
+ *                                                                                            *
+ * You should have received a copy of the GNU General Public License along with this program. *
+ * If not, see <http://www.gnu.org/licenses/>.                                                *
+ **********************************************************************************************/
+ //todo: Apache2
+/*
+ * @file lib/generated/definitions/bits/bits_avx512.hpp
+ * @date 17.02.2022
+ * @brief Bit counting and bit position primitives. Implementation for avx512
+ */
+#ifndef TUD_D2RG_TVL_LIB_GENERATED_DEFINITIONS_BITS_BITS_AVX512_HPP
+#define TUD_D2RG_TVL_LIB_GENERATED_DEFINITIONS_BITS_BITS_AVX512_HPP
+
+#include "../../declarations/bits.hpp"
+
+namespace tvl {
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct popcount_impl< simd< int64_t, avx512  >, Idof > {
+         using Vec = simd< int64_t, avx512  >;
+         static constexpr bool native_supported() {
+            return false;
+         }
+   /*
+    * @brief Counts the set bits of every lane.
+    * @details todo.
+    * @param vec Vector containing the values.
+    * @return Vector containing popcount( vec[*] ).
+    */
+         [[nodiscard]] TVL_NO_NATIVE_SUPPORT_WARNING
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec
+         ) {
+            static_assert( !std::is_same_v< Idof, native >, "The primitive popcount is not supported by your hardware natively while it is forced by using native" );
+            #ifdef __AVX512VPOPCNTDQ__
+            return _mm512_popcnt_epi64( vec );
+            #else
+            auto const lookup = _mm512_broadcast_i32x4( _mm_setr_epi8( 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4 ) );
+            auto const low_nibbles = _mm512_set1_epi8( 0x0F );
+            auto const counts = _mm512_add_epi8(
+               _mm512_shuffle_epi8( lookup, _mm512_and_si512( vec, low_nibbles ) ),
+               _mm512_shuffle_epi8( lookup, _mm512_and_si512( _mm512_srli_epi16( vec, 4 ), low_nibbles ) )
+            );
+            return _mm512_sad_epu8( counts, _mm512_setzero_si512( ) );
+            #endif
+         }
+      };
+   } // end of namespace details for template specialization of popcount_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct popcount_impl< simd< int64_t, avx512, 256 >, Idof > {
+         using Vec = simd< int64_t, avx512, 256 >;
+         static constexpr bool native_supported() {
+            return false;
+         }
+   /*
+    * @brief Counts the set bits of every lane.
+    * @details todo.
+    * @param vec Vector containing the values.
+    * @return Vector containing popcount( vec[*] ).
+    */
+         [[nodiscard]] TVL_NO_NATIVE_SUPPORT_WARNING
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec
+         ) {
+            static_assert( !std::is_same_v< Idof, native >, "The primitive popcount is not supported by your hardware natively while it is forced by using native" );
+            #ifdef __AVX512VPOPCNTDQ__
+            return _mm256_popcnt_epi64( vec );
+            #else
+            auto const lookup = _mm256_broadcastsi128_si256( _mm_setr_epi8( 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4 ) );
+            auto const low_nibbles = _mm256_set1_epi8( 0x0F );
+            auto const counts = _mm256_add_epi8(
+               _mm256_shuffle_epi8( lookup, _mm256_and_si256( vec, low_nibbles ) ),
+               _mm256_shuffle_epi8( lookup, _mm256_and_si256( _mm256_srli_epi16( vec, 4 ), low_nibbles ) )
+            );
+            return _mm256_sad_epu8( counts, _mm256_setzero_si256( ) );
+            #endif
+         }
+      };
+   } // end of namespace details for template specialization of popcount_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct lzcnt_impl< simd< int64_t, avx512  >, Idof > {
+         using Vec = simd< int64_t, avx512  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Counts the leading zero bits of every lane.
+    * @details todo.
+    * @param vec Vector containing the values.
+    * @return Vector containing the number of leading zeros of vec[*] (64 for 0).
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec
+         ) {return _mm512_lzcnt_epi64( vec );
+         }
+      };
+   } // end of namespace details for template specialization of lzcnt_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct lzcnt_impl< simd< int64_t, avx512, 256 >, Idof > {
+         using Vec = simd< int64_t, avx512, 256 >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Counts the leading zero bits of every lane.
+    * @details todo.
+    * @param vec Vector containing the values.
+    * @return Vector containing the number of leading zeros of vec[*] (64 for 0).
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec
+         ) {return _mm256_lzcnt_epi64( vec );
+         }
+      };
+   } // end of namespace details for template specialization of lzcnt_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct tzcnt_impl< simd< int64_t, avx512  >, Idof > {
+         using Vec = simd< int64_t, avx512  >;
+         static constexpr bool native_supported() {
+            return false;
+         }
+   /*
+    * @brief Counts the trailing zero bits of every lane.
+    * @details todo.
+    * @param vec Vector containing the values.
+    * @return Vector containing the number of trailing zeros of vec[*] (64 for 0).
+    */
+         [[nodiscard]] TVL_NO_NATIVE_SUPPORT_WARNING
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec
+         ) {
+            static_assert( !std::is_same_v< Idof, native >, "The primitive tzcnt is not supported by your hardware natively while it is forced by using native" );
+            return _mm512_sub_epi64( _mm512_set1_epi64( 64 ), _mm512_lzcnt_epi64( _mm512_andnot_si512( vec, _mm512_sub_epi64( vec, _mm512_set1_epi64( 1 ) ) ) ) );
+         }
+      };
+   } // end of namespace details for template specialization of tzcnt_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct tzcnt_impl< simd< int64_t, avx512, 256 >, Idof > {
+         using Vec = simd< int64_t, avx512, 256 >;
+         static constexpr bool native_supported() {
+            return false;
+         }
+   /*
+    * @brief Counts the trailing zero bits of every lane.
+    * @details todo.
+    * @param vec Vector containing the values.
+    * @return Vector containing the number of trailing zeros of vec[*] (64 for 0).
+    */
+         [[nodiscard]] TVL_NO_NATIVE_SUPPORT_WARNING
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec
+         ) {
+            static_assert( !std::is_same_v< Idof, native >, "The primitive tzcnt is not supported by your hardware natively while it is forced by using native" );
+            return _mm256_sub_epi64( _mm256_set1_epi64x( 64 ), _mm256_lzcnt_epi64( _mm256_andnot_si256( vec, _mm256_sub_epi64( vec, _mm256_set1_epi64x( 1 ) ) ) ) );
+         }
+      };
+   } // end of namespace details for template specialization of tzcnt_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct bit_indices_impl< simd< int64_t, avx512  >, Idof > {
+         using Vec = simd< int64_t, avx512  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Writes the positions of the set bits of a 16 bit value in ascending order, e.g. to turn a bitmap into row numbers.
+    * @details todo.
+    * @param bits Bits, only the lower 16 are used.
+    * @param base Added to every position.
+    * @param indices Destination, must have room for 16 values. Entries past the returned count are unspecified.
+    * @return Number of indices written (popcount of the lower 16 bits).
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static int32_t apply(
+            uint32_t  bits, 
+            int32_t  base, 
+            int32_t *  indices
+         ) {
+            auto const positions = _mm512_add_epi32( _mm512_setr_epi32( 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 ), _mm512_set1_epi32( base ) );
+            _mm512_storeu_si512( indices, _mm512_maskz_compress_epi32( static_cast< __mmask16 >( bits ), positions ) );
+            return __builtin_popcount( bits & 0xFFFF );
+         }
+      };
+   } // end of namespace details for template specialization of bit_indices_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct bit_indices_impl< simd< int64_t, avx512, 256 >, Idof > {
+         using Vec = simd< int64_t, avx512, 256 >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Writes the positions of the set bits of a 16 bit value in ascending order, e.g. to turn a bitmap into row numbers.
+    * @details todo.
+    * @param bits Bits, only the lower 16 are used.
+    * @param base Added to every position.
+    * @param indices Destination, must have room for 16 values. Entries past the returned count are unspecified.
+    * @return Number of indices written (popcount of the lower 16 bits).
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static int32_t apply(
+            uint32_t  bits, 
+            int32_t  base, 
+            int32_t *  indices
+         ) {
+            auto const positions = _mm256_add_epi32( _mm256_setr_epi32( 0, 1, 2, 3, 4, 5, 6, 7 ), _mm256_set1_epi32( base ) );
+            int32_t const low_count = __builtin_popcount( bits & 0xFF );
+            _mm256_storeu_si256( reinterpret_cast< __m256i * >( indices ), _mm256_maskz_compress_epi32( static_cast< __mmask8 >( bits ), positions ) );
+            _mm256_storeu_si256(
+               reinterpret_cast< __m256i * >( indices + low_count ),
+               _mm256_maskz_compress_epi32( static_cast< __mmask8 >( bits >> 8 ), _mm256_add_epi32( positions, _mm256_set1_epi32( 8 ) ) )
+            );
+            return low_count + __builtin_popcount( bits & 0xFF00 );
+         }
+      };
+   } // end of namespace details for template specialization of bit_indices_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct deposit_bits_impl< simd< int64_t, avx512  >, Idof > {
+         using Vec = simd< int64_t, avx512  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Deposits the low bits of a value at the set bits of a mask, like pdep, e.g. to spread the values of a nullable boolean column over its non-null rows.
+    * @details todo.
+    * @param source Bits to deposit, the lowest popcount( mask ) are used.
+    * @param mask Positions to deposit the bits at.
+    * @return The i-th lowest bit of source at the position of the i-th lowest set bit of mask, 0 elsewhere.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static uint64_t apply(
+            uint64_t  source, 
+            uint64_t  mask
+         ) {return _pdep_u64( source, mask );
+         }
+      };
+   } // end of namespace details for template specialization of deposit_bits_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct deposit_bits_impl< simd< int64_t, avx512, 256 >, Idof > {
+         using Vec = simd< int64_t, avx512, 256 >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Deposits the low bits of a value at the set bits of a mask, like pdep, e.g. to spread the values of a nullable boolean column over its non-null rows.
+    * @details todo.
+    * @param source Bits to deposit, the lowest popcount( mask ) are used.
+    * @param mask Positions to deposit the bits at.
+    * @return The i-th lowest bit of source at the position of the i-th lowest set bit of mask, 0 elsewhere.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static uint64_t apply(
+            uint64_t  source, 
+            uint64_t  mask
+         ) {return _pdep_u64( source, mask );
+         }
+      };
+   } // end of namespace details for template specialization of deposit_bits_impl for avx512 using int64_t.
+   
+} // end of namespace tvl
+
+#endif //TUD_D2RG_TVL_LIB_GENERATED_DEFINITIONS_BITS_BITS_AVX512_HPP
\ No newline at end of file
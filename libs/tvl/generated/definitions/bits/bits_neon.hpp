@@ -0,0 +1,204 @@
+/**********************************************************************************************
+ * This file is part of the TVL Project.                                                      *
+ * Copyright (C) 2022 by TVL-Team                                                             *
+ *                                                                                            *
+ * This file is part of TVL - a template simd library.                                        *
+ *                                                                                            *
+ * This program is free software: you can redistribute it and/or modify it under the          *
+ * terms of the GNU General Public License as published by the Free Software Foundation,      *
+ * either version 3 of the License, or (at your option) any later version.                    *
+ *                                                                                            *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;  *
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  *
+ * See the GNU General Public License for more details.                                       *
+ *                                                                                            *
+ * You should have received a copy of the GNU General Public License along with this program. *
+ * If not, see <http://www.gnu.org/licenses/>.                                                *
+ **********************************************************************************************/
+ //todo: Apache2
+/*
+ * @file lib/generated/definitions/bits/bits_neon.hpp
+ * @date 17.02.2022
+ * @brief Bit counting and bit position primitives. Implementation for neon
+ */
+#ifndef TUD_D2RG_TVL_LIB_GENERATED_DEFINITIONS_BITS_BITS_NEON_HPP
+#define TUD_D2RG_TVL_LIB_GENERATED_DEFINITIONS_BITS_BITS_NEON_HPP
+
+#include "../../declarations/bits.hpp"
+
+namespace tvl {
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct popcount_impl< simd< int64_t, neon  >, Idof > {
+         using Vec = simd< int64_t, neon  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Counts the set bits of every lane.
+    * @details todo.
+    * @param vec Vector containing the values.
+    * @return Vector containing popcount( vec[*] ).
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec
+         ) {return vreinterpretq_s64_u64( vpaddlq_u32( vpaddlq_u16( vpaddlq_u8( vcntq_u8( vreinterpretq_u8_s64( vec ) ) ) ) ) );
+         }
+      };
+   } // end of namespace details for template specialization of popcount_impl for neon using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct lzcnt_impl< simd< int64_t, neon  >, Idof > {
+         using Vec = simd< int64_t, neon  >;
+         static constexpr bool native_supported() {
+            return false;
+         }
+   /*
+    * @brief Counts the leading zero bits of every lane.
+    * @details todo.
+    * @param vec Vector containing the values.
+    * @return Vector containing the number of leading zeros of vec[*] (64 for 0).
+    */
+         [[nodiscard]] TVL_NO_NATIVE_SUPPORT_WARNING
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec
+         ) {
+            static_assert( !std::is_same_v< Idof, native >, "The primitive lzcnt is not supported by your hardware natively while it is forced by using native" );
+            auto smeared = vreinterpretq_u64_s64( vec );
+            smeared = vorrq_u64( smeared, vshrq_n_u64( smeared, 1 ) );
+            smeared = vorrq_u64( smeared, vshrq_n_u64( smeared, 2 ) );
+            smeared = vorrq_u64( smeared, vshrq_n_u64( smeared, 4 ) );
+            smeared = vorrq_u64( smeared, vshrq_n_u64( smeared, 8 ) );
+            smeared = vorrq_u64( smeared, vshrq_n_u64( smeared, 16 ) );
+            smeared = vorrq_u64( smeared, vshrq_n_u64( smeared, 32 ) );
+            return vsubq_s64( vdupq_n_s64( 64 ), tvl::popcount< Vec >( vreinterpretq_s64_u64( smeared ) ) );
+         }
+      };
+   } // end of namespace details for template specialization of lzcnt_impl for neon using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct tzcnt_impl< simd< int64_t, neon  >, Idof > {
+         using Vec = simd< int64_t, neon  >;
+         static constexpr bool native_supported() {
+            return false;
+         }
+   /*
+    * @brief Counts the trailing zero bits of every lane.
+    * @details todo.
+    * @param vec Vector containing the values.
+    * @return Vector containing the number of trailing zeros of vec[*] (64 for 0).
+    */
+         [[nodiscard]] TVL_NO_NATIVE_SUPPORT_WARNING
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec
+         ) {
+            static_assert( !std::is_same_v< Idof, native >, "The primitive tzcnt is not supported by your hardware natively while it is forced by using native" );
+            return tvl::popcount< Vec >( vbicq_s64( vsubq_s64( vec, vdupq_n_s64( 1 ) ), vec ) );
+         }
+      };
+   } // end of namespace details for template specialization of tzcnt_impl for neon using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct bit_indices_impl< simd< int64_t, neon  >, Idof > {
+         using Vec = simd< int64_t, neon  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Writes the positions of the set bits of a 16 bit value in ascending order, e.g. to turn a bitmap into row numbers.
+    * @details todo.
+    * @param bits Bits, only the lower 16 are used.
+    * @param base Added to every position.
+    * @param indices Destination, must have room for 16 values. Entries past the returned count are unspecified.
+    * @return Number of indices written (popcount of the lower 16 bits).
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static int32_t apply(
+            uint32_t  bits, 
+            int32_t  base, 
+            int32_t *  indices
+         ) {
+            struct Positions {
+               int32_t rows[ 256 ][ 8 ];
+            };
+            alignas( 64 ) static constexpr Positions kPositions = [ ]( ) {
+               Positions table{ };
+               for( int byte = 0; byte < 256; ++byte ) {
+                  int count = 0;
+                  for( int bit = 0; bit < 8; ++bit ) {
+                     if( byte & ( 1 << bit ) ) {
+                        table.rows[ byte ][ count++ ] = bit;
+                     }
+                  }
+               }
+               return table;
+            }( );
+            int32_t const low_count = __builtin_popcount( bits & 0xFF );
+            auto const store = [ & ]( uint32_t byte, int32_t offset, int32_t * out ) {
+               auto const add = vdupq_n_s32( offset );
+               vst1q_s32( out, vaddq_s32( vld1q_s32( kPositions.rows[ byte ] ), add ) );
+               vst1q_s32( out + 4, vaddq_s32( vld1q_s32( kPositions.rows[ byte ] + 4 ), add ) );
+            };
+            store( bits & 0xFF, base, indices );
+            store( ( bits >> 8 ) & 0xFF, base + 8, indices + low_count );
+            return low_count + __builtin_popcount( bits & 0xFF00 );
+         }
+      };
+   } // end of namespace details for template specialization of bit_indices_impl for neon using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct deposit_bits_impl< simd< int64_t, neon  >, Idof > {
+         using Vec = simd< int64_t, neon  >;
+         static constexpr bool native_supported() {
+            return false;
+         }
+   /*
+    * @brief Deposits the low bits of a value at the set bits of a mask, like pdep, e.g. to spread the values of a nullable boolean column over its non-null rows.
+    * @details todo.
+    * @param source Bits to deposit, the lowest popcount( mask ) are used.
+    * @param mask Positions to deposit the bits at.
+    * @return The i-th lowest bit of source at the position of the i-th lowest set bit of mask, 0 elsewhere.
+    */
+         [[nodiscard]] TVL_NO_NATIVE_SUPPORT_WARNING
+         TVL_FORCE_INLINE static uint64_t apply(
+            uint64_t  source, 
+            uint64_t  mask
+         ) {
+            static_assert( !std::is_same_v< Idof, native >, "The primitive deposit_bits is not supported by your hardware natively while it is forced by using native" );
+            struct Deposits {
+               uint8_t rows[ 256 ][ 8 ];
+            };
+            alignas( 64 ) static constexpr Deposits kDeposits = [ ]( ) {
+               Deposits table{ };
+               for( int byte = 0; byte < 256; ++byte ) {
+                  int count = 0;
+                  for( int bit = 0; bit < 8; ++bit ) {
+                     if( byte & ( 1 << bit ) ) {
+                        table.rows[ byte ][ count++ ] = 1 << bit;
+                     }
+                  }
+               }
+               return table;
+            }( );
+            uint64_t result = 0;
+            uint64_t remaining = source;
+            for( int shift = 0; shift < 64; shift += 8 ) {
+               auto const byte = ( mask >> shift ) & 0xFF;
+               auto const selected = vtst_u8( vdup_n_u8( static_cast< uint8_t >( remaining ) ), vcreate_u8( 0x8040201008040201ULL ) );
+               auto const deposited = vaddv_u8( vand_u8( vld1_u8( kDeposits.rows[ byte ] ), selected ) );
+               result |= static_cast< uint64_t >( deposited ) << shift;
+               remaining >>= __builtin_popcountll( byte );
+            }
+            return result;
+         }
+      };
+   } // end of namespace details for template specialization of deposit_bits_impl for neon using int64_t.
+   
+} // end of namespace tvl
+
+#endif //TUD_D2RG_TVL_LIB_GENERATED_DEFINITIONS_BITS_BITS_NEON_HPP
\ No newline at end of file
@@ -0,0 +1,170 @@
+/**********************************************************************************************
+ * This file is part of the TVL Project.                                                      *
+ * Copyright (C) 2022 by TVL-Team                                                             *
+ *                                                                                            *
+ * This file is part of TVL - a template simd library.                                        *
+ *                                                                                            *
+ * This program is free software: you can redistribute it and/or modify it under the          *
+ * terms of the GNU General Public License as published by the Free Software Foundation,      *
+ * either version 3 of the License, or (at your option) any later version.                    *
+ *                                                                                            *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;  *
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  *
+ * See the GNU General Public License for more details.                                       *
+ *                                                                                            *
+ * You should have received a copy of the GNU General Public License along with this program. *
+ * If not, see <http://www.gnu.org/licenses/>.                                                *
+ **********************************************************************************************/
+ //todo: Apache2
+/*
+ * @file lib/generated/definitions/bits/bits_scalar.hpp
+ * @date 17.02.2022
+ * @brief Bit counting and bit position primitives. Implementation for scalar
+ */
+#ifndef TUD_D2RG_TVL_LIB_GENERATED_DEFINITIONS_BITS_BITS_SCALAR_HPP
+#define TUD_D2RG_TVL_LIB_GENERATED_DEFINITIONS_BITS_BITS_SCALAR_HPP
+
+#include "../../declarations/bits.hpp"
+
+namespace tvl {
+   namespace details {
+      template< std::size_t VectorSizeInBits, ImplementationDegreeOfFreedom Idof >
+      struct popcount_impl< simd< int64_t, scalar, VectorSizeInBits >, Idof > {
+         using Vec = simd< int64_t, scalar, VectorSizeInBits >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Counts the set bits of every lane.
+    * @details todo.
+    * @param vec Vector containing the values.
+    * @return Vector containing popcount( vec[*] ).
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec
+         ) {
+            typename Vec::register_type result{ };
+            for( std::size_t i = 0; i < Vec::vector_element_count(); ++i ) {
+               result[ i ] = __builtin_popcountll( vec[ i ] );
+            }
+            return result;
+         }
+      };
+   } // end of namespace details for template specialization of popcount_impl for scalar using int64_t.
+   
+   namespace details {
+      template< std::size_t VectorSizeInBits, ImplementationDegreeOfFreedom Idof >
+      struct lzcnt_impl< simd< int64_t, scalar, VectorSizeInBits >, Idof > {
+         using Vec = simd< int64_t, scalar, VectorSizeInBits >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Counts the leading zero bits of every lane.
+    * @details todo.
+    * @param vec Vector containing the values.
+    * @return Vector containing the number of leading zeros of vec[*] (64 for 0).
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec
+         ) {
+            typename Vec::register_type result{ };
+            for( std::size_t i = 0; i < Vec::vector_element_count(); ++i ) {
+               result[ i ] = vec[ i ] == 0 ? 64 : __builtin_clzll( vec[ i ] );
+            }
+            return result;
+         }
+      };
+   } // end of namespace details for template specialization of lzcnt_impl for scalar using int64_t.
+   
+   namespace details {
+      template< std::size_t VectorSizeInBits, ImplementationDegreeOfFreedom Idof >
+      struct tzcnt_impl< simd< int64_t, scalar, VectorSizeInBits >, Idof > {
+         using Vec = simd< int64_t, scalar, VectorSizeInBits >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Counts the trailing zero bits of every lane.
+    * @details todo.
+    * @param vec Vector containing the values.
+    * @return Vector containing the number of trailing zeros of vec[*] (64 for 0).
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec
+         ) {
+            typename Vec::register_type result{ };
+            for( std::size_t i = 0; i < Vec::vector_element_count(); ++i ) {
+               result[ i ] = vec[ i ] == 0 ? 64 : __builtin_ctzll( vec[ i ] );
+            }
+            return result;
+         }
+      };
+   } // end of namespace details for template specialization of tzcnt_impl for scalar using int64_t.
+   
+   namespace details {
+      template< std::size_t VectorSizeInBits, ImplementationDegreeOfFreedom Idof >
+      struct bit_indices_impl< simd< int64_t, scalar, VectorSizeInBits >, Idof > {
+         using Vec = simd< int64_t, scalar, VectorSizeInBits >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Writes the positions of the set bits of a 16 bit value in ascending order, e.g. to turn a bitmap into row numbers.
+    * @details todo.
+    * @param bits Bits, only the lower 16 are used.
+    * @param base Added to every position.
+    * @param indices Destination, must have room for 16 values. Entries past the returned count are unspecified.
+    * @return Number of indices written (popcount of the lower 16 bits).
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static int32_t apply(
+            uint32_t  bits, 
+            int32_t  base, 
+            int32_t *  indices
+         ) {
+            int32_t count = 0;
+            for( uint32_t remaining = bits & 0xFFFF; remaining != 0; remaining &= remaining - 1 ) {
+               indices[ count++ ] = base + __builtin_ctz( remaining );
+            }
+            return count;
+         }
+      };
+   } // end of namespace details for template specialization of bit_indices_impl for scalar using int64_t.
+   
+   namespace details {
+      template< std::size_t VectorSizeInBits, ImplementationDegreeOfFreedom Idof >
+      struct deposit_bits_impl< simd< int64_t, scalar, VectorSizeInBits >, Idof > {
+         using Vec = simd< int64_t, scalar, VectorSizeInBits >;
+         static constexpr bool native_supported() {
+            return false;
+         }
+   /*
+    * @brief Deposits the low bits of a value at the set bits of a mask, like pdep, e.g. to spread the values of a nullable boolean column over its non-null rows.
+    * @details todo.
+    * @param source Bits to deposit, the lowest popcount( mask ) are used.
+    * @param mask Positions to deposit the bits at.
+    * @return The i-th lowest bit of source at the position of the i-th lowest set bit of mask, 0 elsewhere.
+    */
+         [[nodiscard]] TVL_NO_NATIVE_SUPPORT_WARNING
+         TVL_FORCE_INLINE static uint64_t apply(
+            uint64_t  source, 
+            uint64_t  mask
+         ) {
+            static_assert( !std::is_same_v< Idof, native >, "The primitive deposit_bits is not supported by your hardware natively while it is forced by using native" );
+            uint64_t result = 0;
+            uint64_t remaining = source;
+            for( uint64_t positions = mask; positions != 0; positions &= positions - 1, remaining >>= 1 ) {
+               result |= ( remaining & 1 ) ? positions & -positions : 0;
+            }
+            return result;
+         }
+      };
+   } // end of namespace details for template specialization of deposit_bits_impl for scalar using int64_t.
+   
+} // end of namespace tvl
+
+#endif //TUD_D2RG_TVL_LIB_GENERATED_DEFINITIONS_BITS_BITS_SCALAR_HPP
\ No newline at end of file
@@ -0,0 +1,212 @@
+/**********************************************************************************************
+ * This file is part of the TVL Project.                                                      *
+ * Copyright (C) 2022 by TVL-Team                                                             *
+ *                                                                                            *
+ * This file is part of TVL - a template simd library.                                        *
+ *                                                                                            *
+ * This program is free software: you can redistribute it and/or modify it under the          *
+ * terms of the GNU General Public License as published by the Free Software Foundation,      *
+ * either version 3 of the License, or (at your option) any later version.                    *
+ *                                                                                            *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;  *
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  *
+ * See the GNU General Public License for more details.                                       *
+ *                                                                                            *
+ * You should have received a copy of the GNU General Public License along with this program. *
+ * If not, see <http://www.gnu.org/licenses/>.                                                *
+ **********************************************************************************************/
+ //todo: Apache2
+/*
+ * @file lib/generated/definitions/bits/bits_sse.hpp
+ * @date 17.02.2022
+ * @brief Bit counting and bit position primitives. Implementation for sse
+ */
+#ifndef TUD_D2RG_TVL_LIB_GENERATED_DEFINITIONS_BITS_BITS_SSE_HPP
+#define TUD_D2RG_TVL_LIB_GENERATED_DEFINITIONS_BITS_BITS_SSE_HPP
+
+#include "../../declarations/bits.hpp"
+
+namespace tvl {
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct popcount_impl< simd< int64_t, sse  >, Idof > {
+         using Vec = simd< int64_t, sse  >;
+         static constexpr bool native_supported() {
+            return false;
+         }
+   /*
+    * @brief Counts the set bits of every lane.
+    * @details todo.
+    * @param vec Vector containing the values.
+    * @return Vector containing popcount( vec[*] ).
+    */
+         [[nodiscard]] TVL_NO_NATIVE_SUPPORT_WARNING
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec
+         ) {
+            static_assert( !std::is_same_v< Idof, native >, "The primitive popcount is not supported by your hardware natively while it is forced by using native" );
+            auto const lookup = _mm_setr_epi8( 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4 );
+            auto const low_nibbles = _mm_set1_epi8( 0x0F );
+            auto const counts = _mm_add_epi8(
+               _mm_shuffle_epi8( lookup, _mm_and_si128( vec, low_nibbles ) ),
+               _mm_shuffle_epi8( lookup, _mm_and_si128( _mm_srli_epi16( vec, 4 ), low_nibbles ) )
+            );
+            return _mm_sad_epu8( counts, _mm_setzero_si128( ) );
+         }
+      };
+   } // end of namespace details for template specialization of popcount_impl for sse using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct lzcnt_impl< simd< int64_t, sse  >, Idof > {
+         using Vec = simd< int64_t, sse  >;
+         static constexpr bool native_supported() {
+            return false;
+         }
+   /*
+    * @brief Counts the leading zero bits of every lane.
+    * @details todo.
+    * @param vec Vector containing the values.
+    * @return Vector containing the number of leading zeros of vec[*] (64 for 0).
+    */
+         [[nodiscard]] TVL_NO_NATIVE_SUPPORT_WARNING
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec
+         ) {
+            static_assert( !std::is_same_v< Idof, native >, "The primitive lzcnt is not supported by your hardware natively while it is forced by using native" );
+            auto smeared = vec;
+            for( int shift = 1; shift < 64; shift <<= 1 ) {
+               smeared = _mm_or_si128( smeared, _mm_srli_epi64( smeared, shift ) );
+            }
+            return _mm_sub_epi64( _mm_set1_epi64x( 64 ), tvl::popcount< Vec >( smeared ) );
+         }
+      };
+   } // end of namespace details for template specialization of lzcnt_impl for sse using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct tzcnt_impl< simd< int64_t, sse  >, Idof > {
+         using Vec = simd< int64_t, sse  >;
+         static constexpr bool native_supported() {
+            return false;
+         }
+   /*
+    * @brief Counts the trailing zero bits of every lane.
+    * @details todo.
+    * @param vec Vector containing the values.
+    * @return Vector containing the number of trailing zeros of vec[*] (64 for 0).
+    */
+         [[nodiscard]] TVL_NO_NATIVE_SUPPORT_WARNING
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec
+         ) {
+            static_assert( !std::is_same_v< Idof, native >, "The primitive tzcnt is not supported by your hardware natively while it is forced by using native" );
+            return tvl::popcount< Vec >( _mm_andnot_si128( vec, _mm_sub_epi64( vec, _mm_set1_epi64x( 1 ) ) ) );
+         }
+      };
+   } // end of namespace details for template specialization of tzcnt_impl for sse using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct bit_indices_impl< simd< int64_t, sse  >, Idof > {
+         using Vec = simd< int64_t, sse  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Writes the positions of the set bits of a 16 bit value in ascending order, e.g. to turn a bitmap into row numbers.
+    * @details todo.
+    * @param bits Bits, only the lower 16 are used.
+    * @param base Added to every position.
+    * @param indices Destination, must have room for 16 values. Entries past the returned count are unspecified.
+    * @return Number of indices written (popcount of the lower 16 bits).
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static int32_t apply(
+            uint32_t  bits, 
+            int32_t  base, 
+            int32_t *  indices
+         ) {
+            struct Positions {
+               int32_t rows[ 256 ][ 8 ];
+            };
+            alignas( 64 ) static constexpr Positions kPositions = [ ]( ) {
+               Positions table{ };
+               for( int byte = 0; byte < 256; ++byte ) {
+                  int count = 0;
+                  for( int bit = 0; bit < 8; ++bit ) {
+                     if( byte & ( 1 << bit ) ) {
+                        table.rows[ byte ][ count++ ] = bit;
+                     }
+                  }
+               }
+               return table;
+            }( );
+            int32_t const low_count = __builtin_popcount( bits & 0xFF );
+            auto const store = [ & ]( uint32_t byte, int32_t offset, int32_t * out ) {
+               auto const add = _mm_set1_epi32( offset );
+               auto const * row = reinterpret_cast< __m128i const * >( kPositions.rows[ byte ] );
+               _mm_storeu_si128( reinterpret_cast< __m128i * >( out ), _mm_add_epi32( _mm_load_si128( row ), add ) );
+               _mm_storeu_si128( reinterpret_cast< __m128i * >( out + 4 ), _mm_add_epi32( _mm_load_si128( row + 1 ), add ) );
+            };
+            store( bits & 0xFF, base, indices );
+            store( ( bits >> 8 ) & 0xFF, base + 8, indices + low_count );
+            return low_count + __builtin_popcount( bits & 0xFF00 );
+         }
+      };
+   } // end of namespace details for template specialization of bit_indices_impl for sse using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct deposit_bits_impl< simd< int64_t, sse  >, Idof > {
+         using Vec = simd< int64_t, sse  >;
+         static constexpr bool native_supported() {
+            return false;
+         }
+   /*
+    * @brief Deposits the low bits of a value at the set bits of a mask, like pdep, e.g. to spread the values of a nullable boolean column over its non-null rows.
+    * @details todo.
+    * @param source Bits to deposit, the lowest popcount( mask ) are used.
+    * @param mask Positions to deposit the bits at.
+    * @return The i-th lowest bit of source at the position of the i-th lowest set bit of mask, 0 elsewhere.
+    */
+         [[nodiscard]] TVL_NO_NATIVE_SUPPORT_WARNING
+         TVL_FORCE_INLINE static uint64_t apply(
+            uint64_t  source, 
+            uint64_t  mask
+         ) {
+            static_assert( !std::is_same_v< Idof, native >, "The primitive deposit_bits is not supported by your hardware natively while it is forced by using native" );
+            struct Deposits {
+               uint8_t rows[ 256 ][ 8 ];
+            };
+            alignas( 64 ) static constexpr Deposits kDeposits = [ ]( ) {
+               Deposits table{ };
+               for( int byte = 0; byte < 256; ++byte ) {
+                  int count = 0;
+                  for( int bit = 0; bit < 8; ++bit ) {
+                     if( byte & ( 1 << bit ) ) {
+                        table.rows[ byte ][ count++ ] = 1 << bit;
+                     }
+                  }
+               }
+               return table;
+            }( );
+            uint64_t result = 0;
+            uint64_t remaining = source;
+            for( int shift = 0; shift < 64; shift += 8 ) {
+               auto const byte = ( mask >> shift ) & 0xFF;
+               auto const lanes = _mm_set1_epi64x( 0x8040201008040201LL );
+               auto const selected = _mm_cmpeq_epi8( _mm_and_si128( _mm_set1_epi8( static_cast< char >( remaining ) ), lanes ), lanes );
+               auto const row = _mm_loadl_epi64( reinterpret_cast< __m128i const * >( kDeposits.rows[ byte ] ) );
+               auto const deposited = _mm_cvtsi128_si32( _mm_sad_epu8( _mm_and_si128( row, selected ), _mm_setzero_si128( ) ) );
+               result |= static_cast< uint64_t >( deposited ) << shift;
+               remaining >>= __builtin_popcountll( byte );
+            }
+            return result;
+         }
+      };
+   } // end of namespace details for template specialization of deposit_bits_impl for sse using int64_t.
+   
+} // end of namespace tvl
+
+#endif //TUD_D2RG_TVL_LIB_GENERATED_DEFINITIONS_BITS_BITS_SSE_HPP
\ No newline at end of file
@@ -27,12 +27,35 @@
 #include "../../declarations/calc.hpp"
 
 namespace tvl {
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct add_impl< simd< int64_t, avx512  >, Idof > {
+         using Vec = simd< int64_t, avx512  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Adds two vector registers.
+    * @details todo.
+    * @param vec_a First vector.
+    * @param vec_b Second vector.
+    * @return Vector containing result of the addition.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec_a, 
+            typename Vec::register_type  vec_b
+         ) {return _mm512_add_epi64(vec_a, vec_b);
+         }
+      };
+   } // end of namespace details for template specialization of add_impl for avx512 using int64_t.
+   
    namespace details {
       template< ImplementationDegreeOfFreedom Idof >
       struct add_impl< simd< uint64_t, avx512  >, Idof > {
          using Vec = simd< uint64_t, avx512  >;
          static constexpr bool native_supported() {
-            return false;
+            return true;
          }
    /*
     * @brief Adds two vector registers.
@@ -41,13 +64,11 @@ namespace tvl {
     * @param vec_b Second vector.
     * @return Vector containing result of the addition.
     */
-         [[nodiscard]] TVL_NO_NATIVE_SUPPORT_WARNING
+         [[nodiscard]] 
          TVL_FORCE_INLINE static typename Vec::register_type apply(
             typename Vec::register_type  vec_a, 
             typename Vec::register_type  vec_b
-         ) {
-            static_assert( !std::is_same_v< Idof, native >, "The primitive add is not supported by your hardware natively while it is forced by using native" );
-            return _mm512_add_epi64(vec_a, vec_b);
+         ) {return _mm512_add_epi64(vec_a, vec_b);
          }
       };
    } // end of namespace details for template specialization of add_impl for avx512 using uint64_t.
@@ -75,6 +96,577 @@ namespace tvl {
       };
    } // end of namespace details for template specialization of add_impl for avx512 using uint32_t.
    
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct add_impl< simd< int64_t, avx512, 256 >, Idof > {
+         using Vec = simd< int64_t, avx512, 256 >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Adds two vector registers.
+    * @details todo.
+    * @param vec_a First vector.
+    * @param vec_b Second vector.
+    * @return Vector containing result of the addition.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec_a, 
+            typename Vec::register_type  vec_b
+         ) {return _mm256_add_epi64(vec_a, vec_b);
+         }
+      };
+   } // end of namespace details for template specialization of add_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct add_impl< simd< uint64_t, avx512, 256 >, Idof > {
+         using Vec = simd< uint64_t, avx512, 256 >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Adds two vector registers.
+    * @details todo.
+    * @param vec_a First vector.
+    * @param vec_b Second vector.
+    * @return Vector containing result of the addition.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec_a, 
+            typename Vec::register_type  vec_b
+         ) {return _mm256_add_epi64(vec_a, vec_b);
+         }
+      };
+   } // end of namespace details for template specialization of add_impl for avx512 using uint64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct add_impl< simd< uint32_t, avx512, 256 >, Idof > {
+         using Vec = simd< uint32_t, avx512, 256 >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Adds two vector registers.
+    * @details todo.
+    * @param vec_a First vector.
+    * @param vec_b Second vector.
+    * @return Vector containing result of the addition.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec_a, 
+            typename Vec::register_type  vec_b
+         ) {return _mm256_add_epi32(vec_a, vec_b);
+         }
+      };
+   } // end of namespace details for template specialization of add_impl for avx512 using uint32_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct sub_impl< simd< int64_t, avx512  >, Idof > {
+         using Vec = simd< int64_t, avx512  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Subtracts two vector registers.
+    * @details todo.
+    * @param vec_a Minuend.
+    * @param vec_b Subtrahend.
+    * @return Vector containing vec_a[*] - vec_b[*] (wrapping).
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec_a, 
+            typename Vec::register_type  vec_b
+         ) {return _mm512_sub_epi64( vec_a, vec_b );
+         }
+      };
+   } // end of namespace details for template specialization of sub_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct sub_impl< simd< int64_t, avx512, 256 >, Idof > {
+         using Vec = simd< int64_t, avx512, 256 >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Subtracts two vector registers.
+    * @details todo.
+    * @param vec_a Minuend.
+    * @param vec_b Subtrahend.
+    * @return Vector containing vec_a[*] - vec_b[*] (wrapping).
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec_a, 
+            typename Vec::register_type  vec_b
+         ) {return _mm256_sub_epi64( vec_a, vec_b );
+         }
+      };
+   } // end of namespace details for template specialization of sub_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct mul_impl< simd< int64_t, avx512  >, Idof > {
+         using Vec = simd< int64_t, avx512  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Multiplies two vector registers and keeps the low 64 bit of every product.
+    * @details todo.
+    * @param vec_a First vector.
+    * @param vec_b Second vector.
+    * @return Vector containing the wrapped products.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec_a, 
+            typename Vec::register_type  vec_b
+         ) {return _mm512_mullo_epi64( vec_a, vec_b );
+         }
+      };
+   } // end of namespace details for template specialization of mul_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct mul_impl< simd< int64_t, avx512, 256 >, Idof > {
+         using Vec = simd< int64_t, avx512, 256 >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Multiplies two vector registers and keeps the low 64 bit of every product.
+    * @details todo.
+    * @param vec_a First vector.
+    * @param vec_b Second vector.
+    * @return Vector containing the wrapped products.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec_a, 
+            typename Vec::register_type  vec_b
+         ) {return _mm256_mullo_epi64( vec_a, vec_b );
+         }
+      };
+   } // end of namespace details for template specialization of mul_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct shift_right_impl< simd< int64_t, avx512  >, Idof > {
+         using Vec = simd< int64_t, avx512  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Shifts every lane of a vector register logically to the right.
+    * @details todo.
+    * @param vec Vector which should be shifted.
+    * @param shift Number of bits to shift (0 <= shift < lane width).
+    * @return Vector containing the shifted values, filled with zeros from the left.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec, 
+            int  shift
+         ) {return _mm512_srli_epi64( vec, shift );
+         }
+      };
+   } // end of namespace details for template specialization of shift_right_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct shift_right_impl< simd< int64_t, avx512, 256 >, Idof > {
+         using Vec = simd< int64_t, avx512, 256 >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Shifts every lane of a vector register logically to the right.
+    * @details todo.
+    * @param vec Vector which should be shifted.
+    * @param shift Number of bits to shift (0 <= shift < lane width).
+    * @return Vector containing the shifted values, filled with zeros from the left.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec, 
+            int  shift
+         ) {return _mm256_srli_epi64( vec, shift );
+         }
+      };
+   } // end of namespace details for template specialization of shift_right_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct shift_left_impl< simd< int64_t, avx512  >, Idof > {
+         using Vec = simd< int64_t, avx512  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Shifts every lane of a vector register to the left.
+    * @details todo.
+    * @param vec Vector which should be shifted.
+    * @param shift Number of bits to shift (0 <= shift < lane width).
+    * @return Vector containing the shifted values, filled with zeros from the right.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec, 
+            int  shift
+         ) {return _mm512_slli_epi64( vec, shift );
+         }
+      };
+   } // end of namespace details for template specialization of shift_left_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct shift_left_impl< simd< int64_t, avx512, 256 >, Idof > {
+         using Vec = simd< int64_t, avx512, 256 >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Shifts every lane of a vector register to the left.
+    * @details todo.
+    * @param vec Vector which should be shifted.
+    * @param shift Number of bits to shift (0 <= shift < lane width).
+    * @return Vector containing the shifted values, filled with zeros from the right.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec, 
+            int  shift
+         ) {return _mm256_slli_epi64( vec, shift );
+         }
+      };
+   } // end of namespace details for template specialization of shift_left_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct shift_left_variable_impl< simd< int64_t, avx512  >, Idof > {
+         using Vec = simd< int64_t, avx512  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Shifts every lane of a vector register to the left by its own amount.
+    * @details todo.
+    * @param vec Vector which should be shifted.
+    * @param shift Number of bits to shift every lane (0 <= shift[*] < lane width).
+    * @return Vector containing vec[*] << shift[*], filled with zeros from the right.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec, 
+            typename Vec::register_type  shift
+         ) {return _mm512_sllv_epi64( vec, shift );
+         }
+      };
+   } // end of namespace details for template specialization of shift_left_variable_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct shift_left_variable_impl< simd< int64_t, avx512, 256 >, Idof > {
+         using Vec = simd< int64_t, avx512, 256 >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Shifts every lane of a vector register to the left by its own amount.
+    * @details todo.
+    * @param vec Vector which should be shifted.
+    * @param shift Number of bits to shift every lane (0 <= shift[*] < lane width).
+    * @return Vector containing vec[*] << shift[*], filled with zeros from the right.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec, 
+            typename Vec::register_type  shift
+         ) {return _mm256_sllv_epi64( vec, shift );
+         }
+      };
+   } // end of namespace details for template specialization of shift_left_variable_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct bitwise_and_impl< simd< int64_t, avx512  >, Idof > {
+         using Vec = simd< int64_t, avx512  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Computes the bitwise and of two vector registers.
+    * @details todo.
+    * @param vec_a First vector.
+    * @param vec_b Second vector.
+    * @return Vector containing vec_a[*] & vec_b[*].
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec_a, 
+            typename Vec::register_type  vec_b
+         ) {return _mm512_and_si512( vec_a, vec_b );
+         }
+      };
+   } // end of namespace details for template specialization of bitwise_and_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct bitwise_and_impl< simd< int64_t, avx512, 256 >, Idof > {
+         using Vec = simd< int64_t, avx512, 256 >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Computes the bitwise and of two vector registers.
+    * @details todo.
+    * @param vec_a First vector.
+    * @param vec_b Second vector.
+    * @return Vector containing vec_a[*] & vec_b[*].
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec_a, 
+            typename Vec::register_type  vec_b
+         ) {return _mm256_and_si256( vec_a, vec_b );
+         }
+      };
+   } // end of namespace details for template specialization of bitwise_and_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct bitwise_or_impl< simd< int64_t, avx512  >, Idof > {
+         using Vec = simd< int64_t, avx512  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Computes the bitwise or of two vector registers.
+    * @details todo.
+    * @param vec_a First vector.
+    * @param vec_b Second vector.
+    * @return Vector containing vec_a[*] | vec_b[*].
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec_a, 
+            typename Vec::register_type  vec_b
+         ) {return _mm512_or_si512( vec_a, vec_b );
+         }
+      };
+   } // end of namespace details for template specialization of bitwise_or_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct bitwise_or_impl< simd< int64_t, avx512, 256 >, Idof > {
+         using Vec = simd< int64_t, avx512, 256 >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Computes the bitwise or of two vector registers.
+    * @details todo.
+    * @param vec_a First vector.
+    * @param vec_b Second vector.
+    * @return Vector containing vec_a[*] | vec_b[*].
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec_a, 
+            typename Vec::register_type  vec_b
+         ) {return _mm256_or_si256( vec_a, vec_b );
+         }
+      };
+   } // end of namespace details for template specialization of bitwise_or_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct bitwise_xor_impl< simd< int64_t, avx512  >, Idof > {
+         using Vec = simd< int64_t, avx512  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Computes the bitwise exclusive or of two vector registers.
+    * @details todo.
+    * @param vec_a First vector.
+    * @param vec_b Second vector.
+    * @return Vector containing vec_a[*] ^ vec_b[*].
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec_a, 
+            typename Vec::register_type  vec_b
+         ) {return _mm512_xor_si512( vec_a, vec_b );
+         }
+      };
+   } // end of namespace details for template specialization of bitwise_xor_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct bitwise_xor_impl< simd< int64_t, avx512, 256 >, Idof > {
+         using Vec = simd< int64_t, avx512, 256 >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Computes the bitwise exclusive or of two vector registers.
+    * @details todo.
+    * @param vec_a First vector.
+    * @param vec_b Second vector.
+    * @return Vector containing vec_a[*] ^ vec_b[*].
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec_a, 
+            typename Vec::register_type  vec_b
+         ) {return _mm256_xor_si256( vec_a, vec_b );
+         }
+      };
+   } // end of namespace details for template specialization of bitwise_xor_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct bitwise_andnot_impl< simd< int64_t, avx512  >, Idof > {
+         using Vec = simd< int64_t, avx512  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Computes the bitwise and of a vector register with the complement of another one.
+    * @details todo.
+    * @param vec_a First vector.
+    * @param vec_b Second vector, complemented.
+    * @return Vector containing vec_a[*] & ~vec_b[*].
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec_a, 
+            typename Vec::register_type  vec_b
+         ) {return _mm512_andnot_si512( vec_b, vec_a );
+         }
+      };
+   } // end of namespace details for template specialization of bitwise_andnot_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct bitwise_andnot_impl< simd< int64_t, avx512, 256 >, Idof > {
+         using Vec = simd< int64_t, avx512, 256 >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Computes the bitwise and of a vector register with the complement of another one.
+    * @details todo.
+    * @param vec_a First vector.
+    * @param vec_b Second vector, complemented.
+    * @return Vector containing vec_a[*] & ~vec_b[*].
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec_a, 
+            typename Vec::register_type  vec_b
+         ) {return _mm256_andnot_si256( vec_b, vec_a );
+         }
+      };
+   } // end of namespace details for template specialization of bitwise_andnot_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct bitwise_ornot_impl< simd< int64_t, avx512  >, Idof > {
+         using Vec = simd< int64_t, avx512  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Computes the bitwise or of a vector register with the complement of another one.
+    * @details todo.
+    * @param vec_a First vector.
+    * @param vec_b Second vector, complemented.
+    * @return Vector containing vec_a[*] | ~vec_b[*].
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec_a, 
+            typename Vec::register_type  vec_b
+         ) {return _mm512_ternarylogic_epi64( vec_a, vec_b, vec_b, 0xF3 );
+         }
+      };
+   } // end of namespace details for template specialization of bitwise_ornot_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct bitwise_ornot_impl< simd< int64_t, avx512, 256 >, Idof > {
+         using Vec = simd< int64_t, avx512, 256 >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Computes the bitwise or of a vector register with the complement of another one.
+    * @details todo.
+    * @param vec_a First vector.
+    * @param vec_b Second vector, complemented.
+    * @return Vector containing vec_a[*] | ~vec_b[*].
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec_a, 
+            typename Vec::register_type  vec_b
+         ) {return _mm256_ternarylogic_epi64( vec_a, vec_b, vec_b, 0xF3 );
+         }
+      };
+   } // end of namespace details for template specialization of bitwise_ornot_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct bitwise_not_impl< simd< int64_t, avx512  >, Idof > {
+         using Vec = simd< int64_t, avx512  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Computes the bitwise complement of a vector register.
+    * @details todo.
+    * @param vec Vector.
+    * @return Vector containing ~vec[*].
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec
+         ) {return _mm512_ternarylogic_epi64( vec, vec, vec, 0x55 );
+         }
+      };
+   } // end of namespace details for template specialization of bitwise_not_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct bitwise_not_impl< simd< int64_t, avx512, 256 >, Idof > {
+         using Vec = simd< int64_t, avx512, 256 >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Computes the bitwise complement of a vector register.
+    * @details todo.
+    * @param vec Vector.
+    * @return Vector containing ~vec[*].
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec
+         ) {return _mm256_ternarylogic_epi64( vec, vec, vec, 0x55 );
+         }
+      };
+   } // end of namespace details for template specialization of bitwise_not_impl for avx512 using int64_t.
+   
 } // end of namespace tvl
 
 #endif //TUD_D2RG_TVL_LIB_GENERATED_DEFINITIONS_CALC_CALC_AVX512_HPP
\ No newline at end of file
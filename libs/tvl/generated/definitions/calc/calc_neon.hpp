@@ -0,0 +1,354 @@
+/**********************************************************************************************
+ * This file is part of the TVL Project.                                                      *
+ * Copyright (C) 2022 by TVL-Team                                                             *
+ *                                                                                            *
+ * This file is part of TVL - a template simd library.                                        *
+ *                                                                                            *
+ * This program is free software: you can redistribute it and/or modify it under the          *
+ * terms of the GNU General Public License as published by the Free Software Foundation,      *
+ * either version 3 of the License, or (at your option) any later version.                    *
+ *                                                                                            *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;  *
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  *
+ * See the GNU General Public License for more details.                                       *
+ *                                                                                            *
+ * You should have received a copy of the GNU General Public License along with this program. *
+ * If not, see <http://www.gnu.org/licenses/>.                                                *
+ **********************************************************************************************/
+ //todo: Apache2
+/*
+ * @file lib/generated/definitions/calc/calc_neon.hpp
+ * @date 17.02.2022
+ * @brief Arithmetic primitives. Implementation for neon
+ */
+#ifndef TUD_D2RG_TVL_LIB_GENERATED_DEFINITIONS_CALC_CALC_NEON_HPP
+#define TUD_D2RG_TVL_LIB_GENERATED_DEFINITIONS_CALC_CALC_NEON_HPP
+
+#include "../../declarations/calc.hpp"
+
+namespace tvl {
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct add_impl< simd< int64_t, neon  >, Idof > {
+         using Vec = simd< int64_t, neon  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Adds two vector registers.
+    * @details todo.
+    * @param vec_a First vector.
+    * @param vec_b Second vector.
+    * @return Vector containing result of the addition.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec_a, 
+            typename Vec::register_type  vec_b
+         ) {return vaddq_s64( vec_a, vec_b );
+         }
+      };
+   } // end of namespace details for template specialization of add_impl for neon using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct add_impl< simd< uint64_t, neon  >, Idof > {
+         using Vec = simd< uint64_t, neon  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Adds two vector registers.
+    * @details todo.
+    * @param vec_a First vector.
+    * @param vec_b Second vector.
+    * @return Vector containing result of the addition.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec_a, 
+            typename Vec::register_type  vec_b
+         ) {return vaddq_s64( vec_a, vec_b );
+         }
+      };
+   } // end of namespace details for template specialization of add_impl for neon using uint64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct add_impl< simd< uint32_t, neon  >, Idof > {
+         using Vec = simd< uint32_t, neon  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Adds two vector registers.
+    * @details todo.
+    * @param vec_a First vector.
+    * @param vec_b Second vector.
+    * @return Vector containing result of the addition.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec_a, 
+            typename Vec::register_type  vec_b
+         ) {return vreinterpretq_s64_u32( vaddq_u32( vreinterpretq_u32_s64( vec_a ), vreinterpretq_u32_s64( vec_b ) ) );
+         }
+      };
+   } // end of namespace details for template specialization of add_impl for neon using uint32_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct sub_impl< simd< int64_t, neon  >, Idof > {
+         using Vec = simd< int64_t, neon  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Subtracts two vector registers.
+    * @details todo.
+    * @param vec_a Minuend.
+    * @param vec_b Subtrahend.
+    * @return Vector containing vec_a[*] - vec_b[*] (wrapping).
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec_a, 
+            typename Vec::register_type  vec_b
+         ) {return vsubq_s64( vec_a, vec_b );
+         }
+      };
+   } // end of namespace details for template specialization of sub_impl for neon using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct mul_impl< simd< int64_t, neon  >, Idof > {
+         using Vec = simd< int64_t, neon  >;
+         static constexpr bool native_supported() {
+            return false;
+         }
+   /*
+    * @brief Multiplies two vector registers and keeps the low 64 bit of every product.
+    * @details todo.
+    * @param vec_a First vector.
+    * @param vec_b Second vector.
+    * @return Vector containing the wrapped products.
+    */
+         [[nodiscard]] TVL_NO_NATIVE_SUPPORT_WARNING
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec_a, 
+            typename Vec::register_type  vec_b
+         ) {
+            static_assert( !std::is_same_v< Idof, native >, "The primitive mul is not supported by your hardware natively while it is forced by using native" );
+            return vreinterpretq_s64_u64( vreinterpretq_u64_s64( vec_a ) * vreinterpretq_u64_s64( vec_b ) );
+         }
+      };
+   } // end of namespace details for template specialization of mul_impl for neon using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct shift_right_impl< simd< int64_t, neon  >, Idof > {
+         using Vec = simd< int64_t, neon  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Shifts every lane of a vector register logically to the right.
+    * @details todo.
+    * @param vec Vector which should be shifted.
+    * @param shift Number of bits to shift (0 <= shift < lane width).
+    * @return Vector containing the shifted values, filled with zeros from the left.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec, 
+            int  shift
+         ) {return vreinterpretq_s64_u64( vshlq_u64( vreinterpretq_u64_s64( vec ), vdupq_n_s64( -shift ) ) );
+         }
+      };
+   } // end of namespace details for template specialization of shift_right_impl for neon using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct shift_left_impl< simd< int64_t, neon  >, Idof > {
+         using Vec = simd< int64_t, neon  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Shifts every lane of a vector register to the left.
+    * @details todo.
+    * @param vec Vector which should be shifted.
+    * @param shift Number of bits to shift (0 <= shift < lane width).
+    * @return Vector containing the shifted values, filled with zeros from the right.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec, 
+            int  shift
+         ) {return vreinterpretq_s64_u64( vshlq_u64( vreinterpretq_u64_s64( vec ), vdupq_n_s64( shift ) ) );
+         }
+      };
+   } // end of namespace details for template specialization of shift_left_impl for neon using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct shift_left_variable_impl< simd< int64_t, neon  >, Idof > {
+         using Vec = simd< int64_t, neon  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Shifts every lane of a vector register to the left by its own amount.
+    * @details todo.
+    * @param vec Vector which should be shifted.
+    * @param shift Number of bits to shift every lane (0 <= shift[*] < lane width).
+    * @return Vector containing vec[*] << shift[*], filled with zeros from the right.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec, 
+            typename Vec::register_type  shift
+         ) {return vreinterpretq_s64_u64( vshlq_u64( vreinterpretq_u64_s64( vec ), shift ) );
+         }
+      };
+   } // end of namespace details for template specialization of shift_left_variable_impl for neon using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct bitwise_and_impl< simd< int64_t, neon  >, Idof > {
+         using Vec = simd< int64_t, neon  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Computes the bitwise and of two vector registers.
+    * @details todo.
+    * @param vec_a First vector.
+    * @param vec_b Second vector.
+    * @return Vector containing vec_a[*] & vec_b[*].
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec_a, 
+            typename Vec::register_type  vec_b
+         ) {return vandq_s64( vec_a, vec_b );
+         }
+      };
+   } // end of namespace details for template specialization of bitwise_and_impl for neon using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct bitwise_or_impl< simd< int64_t, neon  >, Idof > {
+         using Vec = simd< int64_t, neon  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Computes the bitwise or of two vector registers.
+    * @details todo.
+    * @param vec_a First vector.
+    * @param vec_b Second vector.
+    * @return Vector containing vec_a[*] | vec_b[*].
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec_a, 
+            typename Vec::register_type  vec_b
+         ) {return vorrq_s64( vec_a, vec_b );
+         }
+      };
+   } // end of namespace details for template specialization of bitwise_or_impl for neon using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct bitwise_xor_impl< simd< int64_t, neon  >, Idof > {
+         using Vec = simd< int64_t, neon  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Computes the bitwise exclusive or of two vector registers.
+    * @details todo.
+    * @param vec_a First vector.
+    * @param vec_b Second vector.
+    * @return Vector containing vec_a[*] ^ vec_b[*].
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec_a, 
+            typename Vec::register_type  vec_b
+         ) {return veorq_s64( vec_a, vec_b );
+         }
+      };
+   } // end of namespace details for template specialization of bitwise_xor_impl for neon using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct bitwise_andnot_impl< simd< int64_t, neon  >, Idof > {
+         using Vec = simd< int64_t, neon  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Computes the bitwise and of a vector register with the complement of another one.
+    * @details todo.
+    * @param vec_a First vector.
+    * @param vec_b Second vector, complemented.
+    * @return Vector containing vec_a[*] & ~vec_b[*].
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec_a, 
+            typename Vec::register_type  vec_b
+         ) {return vbicq_s64( vec_a, vec_b );
+         }
+      };
+   } // end of namespace details for template specialization of bitwise_andnot_impl for neon using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct bitwise_ornot_impl< simd< int64_t, neon  >, Idof > {
+         using Vec = simd< int64_t, neon  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Computes the bitwise or of a vector register with the complement of another one.
+    * @details todo.
+    * @param vec_a First vector.
+    * @param vec_b Second vector, complemented.
+    * @return Vector containing vec_a[*] | ~vec_b[*].
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec_a, 
+            typename Vec::register_type  vec_b
+         ) {return vornq_s64( vec_a, vec_b );
+         }
+      };
+   } // end of namespace details for template specialization of bitwise_ornot_impl for neon using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct bitwise_not_impl< simd< int64_t, neon  >, Idof > {
+         using Vec = simd< int64_t, neon  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Computes the bitwise complement of a vector register.
+    * @details todo.
+    * @param vec Vector.
+    * @return Vector containing ~vec[*].
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec
+         ) {return vreinterpretq_s64_s32( vmvnq_s32( vreinterpretq_s32_s64( vec ) ) );
+         }
+      };
+   } // end of namespace details for template specialization of bitwise_not_impl for neon using int64_t.
+   
+} // end of namespace tvl
+
+#endif //TUD_D2RG_TVL_LIB_GENERATED_DEFINITIONS_CALC_CALC_NEON_HPP
\ No newline at end of file
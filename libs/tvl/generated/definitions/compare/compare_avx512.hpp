@@ -50,6 +50,29 @@ namespace tvl {
       };
    } // end of namespace details for template specialization of equal_impl for avx512 using int64_t.
    
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct equal_impl< simd< int64_t, avx512, 256 >, Idof > {
+         using Vec = simd< int64_t, avx512, 256 >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Compares two vector registers for equality.
+    * @details todo.
+    * @param vec_a Left vector.
+    * @param vec_b Right vector.
+    * @return Vector mask type indicating whether vec_a[*]==vec_b[*].
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::mask_type apply(
+            typename Vec::register_type  vec_a, 
+            typename Vec::register_type  vec_b
+         ) {return _mm256_cmpeq_epi64_mask( vec_a, vec_b );
+         }
+      };
+   } // end of namespace details for template specialization of equal_impl for avx512 using int64_t.
+   
    namespace details {
       template< ImplementationDegreeOfFreedom Idof >
       struct between_inclusive_impl< simd< int64_t, avx512  >, Idof > {
@@ -70,7 +93,32 @@ namespace tvl {
             typename Vec::register_type  vec_data, 
             typename Vec::register_type  vec_min, 
             typename Vec::register_type  vec_max
-         ) {return _mm512_cmple_epu64_mask( vec_min, vec_data ) & _mm512_cmpge_epu64_mask( vec_max, vec_data );
+         ) {return _mm512_cmple_epi64_mask( vec_min, vec_data ) & _mm512_cmpge_epi64_mask( vec_max, vec_data );
+         }
+      };
+   } // end of namespace details for template specialization of between_inclusive_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct between_inclusive_impl< simd< int64_t, avx512, 256 >, Idof > {
+         using Vec = simd< int64_t, avx512, 256 >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Checks if the values of a vector are in a specific range (min[*] <= d[*] <= max[*]).
+    * @details todo.
+    * @param vec_data Data vector.
+    * @param vec_min Minimum vector.
+    * @param vec_max Maximum vector.
+    * @return Vector mask type indicating whether the data is in the given range.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::mask_type apply(
+            typename Vec::register_type  vec_data, 
+            typename Vec::register_type  vec_min, 
+            typename Vec::register_type  vec_max
+         ) {return _mm256_cmple_epi64_mask( vec_min, vec_data ) & _mm256_cmpge_epi64_mask( vec_max, vec_data );
          }
       };
    } // end of namespace details for template specialization of between_inclusive_impl for avx512 using int64_t.
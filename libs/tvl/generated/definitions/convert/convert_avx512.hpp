@@ -0,0 +1,750 @@
+/**********************************************************************************************
+ * This file is part of the TVL Project.                                                      *
+ * Copyright (C) 2022 by TVL-Team                                                             *
+ *                                                                                            *
+ * This file is part of TVL - a template simd library.                                        *
+ *                                                                                            *
+ * This program is free software: you can redistribute it and/or modify it under the          *
+ * terms of the GNU General Public License as published by the Free Software Foundation,      *
+ * either version 3 of the License, or (at your option) any later version.                    *
+ *                                                                                            *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;  *
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  *
+ * See the GNU General Public License for more details.                                       *
+ *                                                                                            *
+ * You should have received a copy of the GNU General Public License along with this program. *
+ * If not, see <http://www.gnu.org/licenses/>.                                                *
+ **********************************************************************************************/
+ //todo: Apache2
+/*
+ * @file lib/generated/definitions/convert/convert_avx512.hpp
+ * @date 17.02.2022
+ * @brief Conversion primitives. Implementation for avx512
+ */
+#ifndef TUD_D2RG_TVL_LIB_GENERATED_DEFINITIONS_CONVERT_CONVERT_AVX512_HPP
+#define TUD_D2RG_TVL_LIB_GENERATED_DEFINITIONS_CONVERT_CONVERT_AVX512_HPP
+
+#include "../../declarations/convert.hpp"
+
+namespace tvl {
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct loadu_extend_int8_impl< simd< int64_t, avx512  >, Idof > {
+         using Vec = simd< int64_t, avx512  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Loads vector_element_count() 8 bit values from unaligned memory and sign extends them to 64 bit.
+    * @details todo.
+    * @param memory Memory address containing the values.
+    * @return Vector containing the sign extended values.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            int8_t const *  memory
+         ) {return _mm512_cvtepi8_epi64( _mm_loadl_epi64( reinterpret_cast< __m128i const * >( memory ) ) );
+         }
+      };
+   } // end of namespace details for template specialization of loadu_extend_int8_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct loadu_extend_int8_impl< simd< int64_t, avx512, 256 >, Idof > {
+         using Vec = simd< int64_t, avx512, 256 >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Loads vector_element_count() 8 bit values from unaligned memory and sign extends them to 64 bit.
+    * @details todo.
+    * @param memory Memory address containing the values.
+    * @return Vector containing the sign extended values.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            int8_t const *  memory
+         ) {return _mm256_cvtepi8_epi64( _mm_loadu_si32( memory ) );
+         }
+      };
+   } // end of namespace details for template specialization of loadu_extend_int8_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct loadu_extend_int16_impl< simd< int64_t, avx512  >, Idof > {
+         using Vec = simd< int64_t, avx512  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Loads vector_element_count() 16 bit values from unaligned memory and sign extends them to 64 bit.
+    * @details todo.
+    * @param memory Memory address containing the values.
+    * @return Vector containing the sign extended values.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            int16_t const *  memory
+         ) {return _mm512_cvtepi16_epi64( _mm_loadu_si128( reinterpret_cast< __m128i const * >( memory ) ) );
+         }
+      };
+   } // end of namespace details for template specialization of loadu_extend_int16_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct loadu_extend_int16_impl< simd< int64_t, avx512, 256 >, Idof > {
+         using Vec = simd< int64_t, avx512, 256 >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Loads vector_element_count() 16 bit values from unaligned memory and sign extends them to 64 bit.
+    * @details todo.
+    * @param memory Memory address containing the values.
+    * @return Vector containing the sign extended values.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            int16_t const *  memory
+         ) {return _mm256_cvtepi16_epi64( _mm_loadl_epi64( reinterpret_cast< __m128i const * >( memory ) ) );
+         }
+      };
+   } // end of namespace details for template specialization of loadu_extend_int16_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct loadu_extend_int32_impl< simd< int64_t, avx512  >, Idof > {
+         using Vec = simd< int64_t, avx512  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Loads vector_element_count() 32 bit values from unaligned memory and sign extends them to 64 bit.
+    * @details todo.
+    * @param memory Memory address containing the values.
+    * @return Vector containing the sign extended values.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            int32_t const *  memory
+         ) {return _mm512_cvtepi32_epi64( _mm256_loadu_si256( reinterpret_cast< __m256i const * >( memory ) ) );
+         }
+      };
+   } // end of namespace details for template specialization of loadu_extend_int32_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct loadu_extend_int32_impl< simd< int64_t, avx512, 256 >, Idof > {
+         using Vec = simd< int64_t, avx512, 256 >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Loads vector_element_count() 32 bit values from unaligned memory and sign extends them to 64 bit.
+    * @details todo.
+    * @param memory Memory address containing the values.
+    * @return Vector containing the sign extended values.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            int32_t const *  memory
+         ) {return _mm256_cvtepi32_epi64( _mm_loadu_si128( reinterpret_cast< __m128i const * >( memory ) ) );
+         }
+      };
+   } // end of namespace details for template specialization of loadu_extend_int32_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct loadu_extend_uint8_impl< simd< int64_t, avx512  >, Idof > {
+         using Vec = simd< int64_t, avx512  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Loads vector_element_count() 8 bit values from unaligned memory and zero extends them to 64 bit.
+    * @details todo.
+    * @param memory Memory address containing the values.
+    * @return Vector containing the zero extended values.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            uint8_t const *  memory
+         ) {return _mm512_cvtepu8_epi64( _mm_loadl_epi64( reinterpret_cast< __m128i const * >( memory ) ) );
+         }
+      };
+   } // end of namespace details for template specialization of loadu_extend_uint8_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct loadu_extend_uint8_impl< simd< int64_t, avx512, 256 >, Idof > {
+         using Vec = simd< int64_t, avx512, 256 >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Loads vector_element_count() 8 bit values from unaligned memory and zero extends them to 64 bit.
+    * @details todo.
+    * @param memory Memory address containing the values.
+    * @return Vector containing the zero extended values.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            uint8_t const *  memory
+         ) {return _mm256_cvtepu8_epi64( _mm_loadu_si32( memory ) );
+         }
+      };
+   } // end of namespace details for template specialization of loadu_extend_uint8_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct loadu_extend_uint16_impl< simd< int64_t, avx512  >, Idof > {
+         using Vec = simd< int64_t, avx512  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Loads vector_element_count() 16 bit values from unaligned memory and zero extends them to 64 bit.
+    * @details todo.
+    * @param memory Memory address containing the values.
+    * @return Vector containing the zero extended values.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            uint16_t const *  memory
+         ) {return _mm512_cvtepu16_epi64( _mm_loadu_si128( reinterpret_cast< __m128i const * >( memory ) ) );
+         }
+      };
+   } // end of namespace details for template specialization of loadu_extend_uint16_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct loadu_extend_uint16_impl< simd< int64_t, avx512, 256 >, Idof > {
+         using Vec = simd< int64_t, avx512, 256 >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Loads vector_element_count() 16 bit values from unaligned memory and zero extends them to 64 bit.
+    * @details todo.
+    * @param memory Memory address containing the values.
+    * @return Vector containing the zero extended values.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            uint16_t const *  memory
+         ) {return _mm256_cvtepu16_epi64( _mm_loadl_epi64( reinterpret_cast< __m128i const * >( memory ) ) );
+         }
+      };
+   } // end of namespace details for template specialization of loadu_extend_uint16_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct loadu_extend_uint32_impl< simd< int64_t, avx512  >, Idof > {
+         using Vec = simd< int64_t, avx512  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Loads vector_element_count() 32 bit values from unaligned memory and zero extends them to 64 bit.
+    * @details todo.
+    * @param memory Memory address containing the values.
+    * @return Vector containing the zero extended values.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            uint32_t const *  memory
+         ) {return _mm512_cvtepu32_epi64( _mm256_loadu_si256( reinterpret_cast< __m256i const * >( memory ) ) );
+         }
+      };
+   } // end of namespace details for template specialization of loadu_extend_uint32_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct loadu_extend_uint32_impl< simd< int64_t, avx512, 256 >, Idof > {
+         using Vec = simd< int64_t, avx512, 256 >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Loads vector_element_count() 32 bit values from unaligned memory and zero extends them to 64 bit.
+    * @details todo.
+    * @param memory Memory address containing the values.
+    * @return Vector containing the zero extended values.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            uint32_t const *  memory
+         ) {return _mm256_cvtepu32_epi64( _mm_loadu_si128( reinterpret_cast< __m128i const * >( memory ) ) );
+         }
+      };
+   } // end of namespace details for template specialization of loadu_extend_uint32_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct maskz_loadu_extend_int32_impl< simd< int64_t, avx512  >, Idof > {
+         using Vec = simd< int64_t, avx512  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Loads the selected 32 bit values from unaligned memory, sign extends them to 64 bit and zeroes the other lanes.
+    * @details todo.
+    * @param memory Memory address containing the values, lanes which are not selected are not accessed.
+    * @param mask Vector mask register selecting the lanes to load.
+    * @return Vector containing the sign extended values and zero in all other lanes.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            int32_t const *  memory, 
+            typename Vec::mask_type  mask
+         ) {return _mm512_cvtepi32_epi64( _mm256_maskz_loadu_epi32( mask, memory ) );
+         }
+      };
+   } // end of namespace details for template specialization of maskz_loadu_extend_int32_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct maskz_loadu_extend_int32_impl< simd< int64_t, avx512, 256 >, Idof > {
+         using Vec = simd< int64_t, avx512, 256 >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Loads the selected 32 bit values from unaligned memory, sign extends them to 64 bit and zeroes the other lanes.
+    * @details todo.
+    * @param memory Memory address containing the values, lanes which are not selected are not accessed.
+    * @param mask Vector mask register selecting the lanes to load.
+    * @return Vector containing the sign extended values and zero in all other lanes.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            int32_t const *  memory, 
+            typename Vec::mask_type  mask
+         ) {return _mm256_cvtepi32_epi64( _mm_maskz_loadu_epi32( mask, memory ) );
+         }
+      };
+   } // end of namespace details for template specialization of maskz_loadu_extend_int32_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct narrow_int32_impl< simd< int64_t, avx512  >, Idof > {
+         using Vec = simd< int64_t, avx512  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Truncates every 64 bit lane to 32 bit and packs the results into the lower half of the register.
+    * @details todo.
+    * @param vec Vector containing the values.
+    * @return Register holding vector_element_count() int32_t values in its lower half and zeros in the upper half.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec
+         ) {return _mm512_zextsi256_si512( _mm512_cvtepi64_epi32( vec ) );
+         }
+      };
+   } // end of namespace details for template specialization of narrow_int32_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct narrow_int32_impl< simd< int64_t, avx512, 256 >, Idof > {
+         using Vec = simd< int64_t, avx512, 256 >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Truncates every 64 bit lane to 32 bit and packs the results into the lower half of the register.
+    * @details todo.
+    * @param vec Vector containing the values.
+    * @return Register holding vector_element_count() int32_t values in its lower half and zeros in the upper half.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec
+         ) {return _mm256_zextsi128_si256( _mm256_cvtepi64_epi32( vec ) );
+         }
+      };
+   } // end of namespace details for template specialization of narrow_int32_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct narrow_int32_saturate_impl< simd< int64_t, avx512  >, Idof > {
+         using Vec = simd< int64_t, avx512  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Clamps every 64 bit lane to the int32_t range and packs the results into the lower half of the register.
+    * @details todo.
+    * @param vec Vector containing the values.
+    * @return Register holding vector_element_count() int32_t values in its lower half and zeros in the upper half.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec
+         ) {return _mm512_zextsi256_si512( _mm512_cvtsepi64_epi32( vec ) );
+         }
+      };
+   } // end of namespace details for template specialization of narrow_int32_saturate_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct narrow_int32_saturate_impl< simd< int64_t, avx512, 256 >, Idof > {
+         using Vec = simd< int64_t, avx512, 256 >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Clamps every 64 bit lane to the int32_t range and packs the results into the lower half of the register.
+    * @details todo.
+    * @param vec Vector containing the values.
+    * @return Register holding vector_element_count() int32_t values in its lower half and zeros in the upper half.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec
+         ) {return _mm256_zextsi128_si256( _mm256_cvtsepi64_epi32( vec ) );
+         }
+      };
+   } // end of namespace details for template specialization of narrow_int32_saturate_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct to_double_impl< simd< int64_t, avx512  >, Idof > {
+         using Vec = simd< int64_t, avx512  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Converts every 64 bit integer lane to double.
+    * @details todo.
+    * @param vec Vector containing the values.
+    * @return Vector containing the values rounded to the nearest double.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename simd< double, typename Vec::target_extension, Vec::vector_size_b() >::register_type apply(
+            typename Vec::register_type  vec
+         ) {return _mm512_cvtepi64_pd( vec );
+         }
+      };
+   } // end of namespace details for template specialization of to_double_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct to_double_impl< simd< int64_t, avx512, 256 >, Idof > {
+         using Vec = simd< int64_t, avx512, 256 >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Converts every 64 bit integer lane to double.
+    * @details todo.
+    * @param vec Vector containing the values.
+    * @return Vector containing the values rounded to the nearest double.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename simd< double, typename Vec::target_extension, Vec::vector_size_b() >::register_type apply(
+            typename Vec::register_type  vec
+         ) {return _mm256_cvtepi64_pd( vec );
+         }
+      };
+   } // end of namespace details for template specialization of to_double_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct from_double_impl< simd< int64_t, avx512  >, Idof > {
+         using Vec = simd< int64_t, avx512  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Converts every double lane to a 64 bit integer, rounding towards zero.
+    * @details todo.
+    * @param vec Vector containing the values (must be representable as int64_t).
+    * @return Vector containing the truncated values.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename simd< double, typename Vec::target_extension, Vec::vector_size_b() >::register_type  vec
+         ) {return _mm512_cvttpd_epi64( vec );
+         }
+      };
+   } // end of namespace details for template specialization of from_double_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct from_double_impl< simd< int64_t, avx512, 256 >, Idof > {
+         using Vec = simd< int64_t, avx512, 256 >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Converts every double lane to a 64 bit integer, rounding towards zero.
+    * @details todo.
+    * @param vec Vector containing the values (must be representable as int64_t).
+    * @return Vector containing the truncated values.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename simd< double, typename Vec::target_extension, Vec::vector_size_b() >::register_type  vec
+         ) {return _mm256_cvttpd_epi64( vec );
+         }
+      };
+   } // end of namespace details for template specialization of from_double_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct to_float_impl< simd< int64_t, avx512  >, Idof > {
+         using Vec = simd< int64_t, avx512  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Converts every 32 bit integer lane of an integral register to float.
+    * @details todo.
+    * @param vec Register holding 2 * vector_element_count() int32_t values.
+    * @return Vector containing the values rounded to the nearest float.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename simd< float, typename Vec::target_extension, Vec::vector_size_b() >::register_type apply(
+            typename Vec::register_type  vec
+         ) {return _mm512_cvtepi32_ps( vec );
+         }
+      };
+   } // end of namespace details for template specialization of to_float_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct to_float_impl< simd< int64_t, avx512, 256 >, Idof > {
+         using Vec = simd< int64_t, avx512, 256 >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Converts every 32 bit integer lane of an integral register to float.
+    * @details todo.
+    * @param vec Register holding 2 * vector_element_count() int32_t values.
+    * @return Vector containing the values rounded to the nearest float.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename simd< float, typename Vec::target_extension, Vec::vector_size_b() >::register_type apply(
+            typename Vec::register_type  vec
+         ) {return _mm256_cvtepi32_ps( vec );
+         }
+      };
+   } // end of namespace details for template specialization of to_float_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct from_float_impl< simd< int64_t, avx512  >, Idof > {
+         using Vec = simd< int64_t, avx512  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Converts every float lane to a 32 bit integer, rounding towards zero.
+    * @details todo.
+    * @param vec Vector containing the values (must be representable as int32_t).
+    * @return Register holding 2 * vector_element_count() int32_t values.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename simd< float, typename Vec::target_extension, Vec::vector_size_b() >::register_type  vec
+         ) {return _mm512_cvttps_epi32( vec );
+         }
+      };
+   } // end of namespace details for template specialization of from_float_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct from_float_impl< simd< int64_t, avx512, 256 >, Idof > {
+         using Vec = simd< int64_t, avx512, 256 >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Converts every float lane to a 32 bit integer, rounding towards zero.
+    * @details todo.
+    * @param vec Vector containing the values (must be representable as int32_t).
+    * @return Register holding 2 * vector_element_count() int32_t values.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename simd< float, typename Vec::target_extension, Vec::vector_size_b() >::register_type  vec
+         ) {return _mm256_cvttps_epi32( vec );
+         }
+      };
+   } // end of namespace details for template specialization of from_float_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct reinterpret_as_double_impl< simd< int64_t, avx512  >, Idof > {
+         using Vec = simd< int64_t, avx512  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Reinterprets the bits of an integral register as double lanes.
+    * @details todo.
+    * @param vec Vector containing the bits.
+    * @return The same bits as double register.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename simd< double, typename Vec::target_extension, Vec::vector_size_b() >::register_type apply(
+            typename Vec::register_type  vec
+         ) {return _mm512_castsi512_pd( vec );
+         }
+      };
+   } // end of namespace details for template specialization of reinterpret_as_double_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct reinterpret_as_double_impl< simd< int64_t, avx512, 256 >, Idof > {
+         using Vec = simd< int64_t, avx512, 256 >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Reinterprets the bits of an integral register as double lanes.
+    * @details todo.
+    * @param vec Vector containing the bits.
+    * @return The same bits as double register.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename simd< double, typename Vec::target_extension, Vec::vector_size_b() >::register_type apply(
+            typename Vec::register_type  vec
+         ) {return _mm256_castsi256_pd( vec );
+         }
+      };
+   } // end of namespace details for template specialization of reinterpret_as_double_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct reinterpret_from_double_impl< simd< int64_t, avx512  >, Idof > {
+         using Vec = simd< int64_t, avx512  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Reinterprets the bits of a double register as integral lanes.
+    * @details todo.
+    * @param vec Vector containing the bits.
+    * @return The same bits as integral register.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename simd< double, typename Vec::target_extension, Vec::vector_size_b() >::register_type  vec
+         ) {return _mm512_castpd_si512( vec );
+         }
+      };
+   } // end of namespace details for template specialization of reinterpret_from_double_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct reinterpret_from_double_impl< simd< int64_t, avx512, 256 >, Idof > {
+         using Vec = simd< int64_t, avx512, 256 >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Reinterprets the bits of a double register as integral lanes.
+    * @details todo.
+    * @param vec Vector containing the bits.
+    * @return The same bits as integral register.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename simd< double, typename Vec::target_extension, Vec::vector_size_b() >::register_type  vec
+         ) {return _mm256_castpd_si256( vec );
+         }
+      };
+   } // end of namespace details for template specialization of reinterpret_from_double_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct reinterpret_as_float_impl< simd< int64_t, avx512  >, Idof > {
+         using Vec = simd< int64_t, avx512  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Reinterprets the bits of an integral register as float lanes.
+    * @details todo.
+    * @param vec Vector containing the bits.
+    * @return The same bits as float register.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename simd< float, typename Vec::target_extension, Vec::vector_size_b() >::register_type apply(
+            typename Vec::register_type  vec
+         ) {return _mm512_castsi512_ps( vec );
+         }
+      };
+   } // end of namespace details for template specialization of reinterpret_as_float_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct reinterpret_as_float_impl< simd< int64_t, avx512, 256 >, Idof > {
+         using Vec = simd< int64_t, avx512, 256 >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Reinterprets the bits of an integral register as float lanes.
+    * @details todo.
+    * @param vec Vector containing the bits.
+    * @return The same bits as float register.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename simd< float, typename Vec::target_extension, Vec::vector_size_b() >::register_type apply(
+            typename Vec::register_type  vec
+         ) {return _mm256_castsi256_ps( vec );
+         }
+      };
+   } // end of namespace details for template specialization of reinterpret_as_float_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct reinterpret_from_float_impl< simd< int64_t, avx512  >, Idof > {
+         using Vec = simd< int64_t, avx512  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Reinterprets the bits of a float register as integral lanes.
+    * @details todo.
+    * @param vec Vector containing the bits.
+    * @return The same bits as integral register.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename simd< float, typename Vec::target_extension, Vec::vector_size_b() >::register_type  vec
+         ) {return _mm512_castps_si512( vec );
+         }
+      };
+   } // end of namespace details for template specialization of reinterpret_from_float_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct reinterpret_from_float_impl< simd< int64_t, avx512, 256 >, Idof > {
+         using Vec = simd< int64_t, avx512, 256 >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Reinterprets the bits of a float register as integral lanes.
+    * @details todo.
+    * @param vec Vector containing the bits.
+    * @return The same bits as integral register.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename simd< float, typename Vec::target_extension, Vec::vector_size_b() >::register_type  vec
+         ) {return _mm256_castps_si256( vec );
+         }
+      };
+   } // end of namespace details for template specialization of reinterpret_from_float_impl for avx512 using int64_t.
+   
+} // end of namespace tvl
+
+#endif //TUD_D2RG_TVL_LIB_GENERATED_DEFINITIONS_CONVERT_CONVERT_AVX512_HPP
\ No newline at end of file
@@ -0,0 +1,172 @@
+/**********************************************************************************************
+ * This file is part of the TVL Project.                                                      *
+ * Copyright (C) 2022 by TVL-Team                                                             *
+ *                                                                                            *
+ * This file is part of TVL - a template simd library.                                        *
+ *                                                                                            *
+ * This program is free software: you can redistribute it and/or modify it under the          *
+ * terms of the GNU General Public License as published by the Free Software Foundation,      *
+ * either version 3 of the License, or (at your option) any later version.                    *
+ *                                                                                            *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;  *
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  *
+ * See the GNU General Public License for more details.                                       *
+ *                                                                                            *
+ * You should have received a copy of the GNU General Public License along with this program. *
+ * If not, see <http://www.gnu.org/licenses/>.                                                *
+ **********************************************************************************************/
+ //todo: Apache2
+/*
+ * @file lib/generated/definitions/hash/hash_neon.hpp
+ * @date 17.02.2022
+ * @brief Hash primitives. Implementation for neon
+ */
+#ifndef TUD_D2RG_TVL_LIB_GENERATED_DEFINITIONS_HASH_HASH_NEON_HPP
+#define TUD_D2RG_TVL_LIB_GENERATED_DEFINITIONS_HASH_HASH_NEON_HPP
+
+#include "../../declarations/hash.hpp"
+
+namespace tvl {
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct hash_mix_impl< simd< int64_t, neon  >, Idof > {
+         using Vec = simd< int64_t, neon  >;
+         static constexpr bool native_supported() {
+            return false;
+         }
+   /*
+    * @brief Combines two 64 bit hashes per lane into one (Hash128to64 from cityhash, same as bits::hashMix).
+    * @details todo.
+    * @param upper First hash.
+    * @param lower Second hash.
+    * @return Vector containing hashMix( upper[*], lower[*] ).
+    */
+         [[nodiscard]] TVL_NO_NATIVE_SUPPORT_WARNING
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  upper, 
+            typename Vec::register_type  lower
+         ) {
+            static_assert( !std::is_same_v< Idof, native >, "The primitive hash_mix is not supported by your hardware natively while it is forced by using native" );
+            auto const kMul = tvl::set1< Vec >( 0x9ddfea08eb382d69ULL );
+            auto a = tvl::mul< Vec >( tvl::bitwise_xor< Vec >( lower, upper ), kMul );
+            a = tvl::bitwise_xor< Vec >( a, tvl::shift_right< Vec >( a, 47 ) );
+            auto b = tvl::mul< Vec >( tvl::bitwise_xor< Vec >( upper, a ), kMul );
+            b = tvl::bitwise_xor< Vec >( b, tvl::shift_right< Vec >( b, 47 ) );
+            return tvl::mul< Vec >( b, kMul );
+         }
+      };
+   } // end of namespace details for template specialization of hash_mix_impl for neon using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct commutative_hash_mix_impl< simd< int64_t, neon  >, Idof > {
+         using Vec = simd< int64_t, neon  >;
+         static constexpr bool native_supported() {
+            return false;
+         }
+   /*
+    * @brief Combines two 64 bit hashes per lane independent of their order (same as bits::commutativeHashMix).
+    * @details todo.
+    * @param upper First hash.
+    * @param lower Second hash.
+    * @return Vector containing commutativeHashMix( upper[*], lower[*] ).
+    */
+         [[nodiscard]] TVL_NO_NATIVE_SUPPORT_WARNING
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  upper, 
+            typename Vec::register_type  lower
+         ) {
+            static_assert( !std::is_same_v< Idof, native >, "The primitive commutative_hash_mix is not supported by your hardware natively while it is forced by using native" );
+            auto sum = tvl::mul< Vec >( tvl::add< Vec >( upper, lower ), tvl::set1< Vec >( 2779 ) );
+            auto product = tvl::mul< Vec >( upper, lower );
+            return tvl::add< Vec >( tvl::add< Vec >( tvl::set1< Vec >( 3860031 ), sum ), tvl::add< Vec >( product, product ) );
+         }
+      };
+   } // end of namespace details for template specialization of commutative_hash_mix_impl for neon using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct hash_finalize_impl< simd< int64_t, neon  >, Idof > {
+         using Vec = simd< int64_t, neon  >;
+         static constexpr bool native_supported() {
+            return false;
+         }
+   /*
+    * @brief Applies the 64 bit murmur3 finalizer (fmix64) to every lane.
+    * @details todo.
+    * @param vec Keys or partial hashes.
+    * @return Vector containing the avalanched values.
+    */
+         [[nodiscard]] TVL_NO_NATIVE_SUPPORT_WARNING
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec
+         ) {
+            static_assert( !std::is_same_v< Idof, native >, "The primitive hash_finalize is not supported by your hardware natively while it is forced by using native" );
+            auto h = tvl::bitwise_xor< Vec >( vec, tvl::shift_right< Vec >( vec, 33 ) );
+            h = tvl::mul< Vec >( h, tvl::set1< Vec >( 0xff51afd7ed558ccdULL ) );
+            h = tvl::bitwise_xor< Vec >( h, tvl::shift_right< Vec >( h, 33 ) );
+            h = tvl::mul< Vec >( h, tvl::set1< Vec >( 0xc4ceb9fe1a85ec53ULL ) );
+            return tvl::bitwise_xor< Vec >( h, tvl::shift_right< Vec >( h, 33 ) );
+         }
+      };
+   } // end of namespace details for template specialization of hash_finalize_impl for neon using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct multiply_shift_impl< simd< int64_t, neon  >, Idof > {
+         using Vec = simd< int64_t, neon  >;
+         static constexpr bool native_supported() {
+            return false;
+         }
+   /*
+    * @brief Multiply-shift hashing: keeps the upper bits of vec[*] * multiplier.
+    * @details todo.
+    * @param vec Keys which should be hashed.
+    * @param multiplier Odd multiplier.
+    * @param shift 64 - number of result bits.
+    * @return Vector containing ( vec[*] * multiplier ) >> shift.
+    */
+         [[nodiscard]] TVL_NO_NATIVE_SUPPORT_WARNING
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec, 
+            typename Vec::base_type  multiplier, 
+            int  shift
+         ) {
+            static_assert( !std::is_same_v< Idof, native >, "The primitive multiply_shift is not supported by your hardware natively while it is forced by using native" );
+            return tvl::shift_right< Vec >( tvl::mul< Vec >( vec, tvl::set1< Vec >( multiplier ) ), shift );
+         }
+      };
+   } // end of namespace details for template specialization of multiply_shift_impl for neon using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct crc32c_impl< simd< int64_t, neon  >, Idof > {
+         using Vec = simd< int64_t, neon  >;
+         static constexpr bool native_supported() {
+            return false;
+         }
+   /*
+    * @brief Accumulates 8 bytes per lane into a CRC32C (Castagnoli) checksum.
+    * @details todo.
+    * @param crc Running checksums (lower 32 bit of every lane).
+    * @param data Data which should be accumulated.
+    * @return Vector containing the updated checksums (zero extended).
+    */
+         [[nodiscard]] TVL_NO_NATIVE_SUPPORT_WARNING
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  crc, 
+            typename Vec::register_type  data
+         ) {
+            static_assert( !std::is_same_v< Idof, native >, "The primitive crc32c is not supported by your hardware natively while it is forced by using native" );
+            typename Vec::register_type result{ };
+            for( std::size_t i = 0; i < Vec::vector_element_count(); ++i ) {
+               result[ i ] = __crc32cd( static_cast< uint32_t >( crc[ i ] ), data[ i ] );
+            }
+            return result;
+         }
+      };
+   } // end of namespace details for template specialization of crc32c_impl for neon using int64_t.
+   
+} // end of namespace tvl
+
+#endif //TUD_D2RG_TVL_LIB_GENERATED_DEFINITIONS_HASH_HASH_NEON_HPP
\ No newline at end of file
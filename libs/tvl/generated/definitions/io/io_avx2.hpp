@@ -69,6 +69,170 @@ namespace tvl {
       };
    } // end of namespace details for template specialization of loadu_impl for avx2 using int64_t.
    
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct store_impl< simd< int64_t, avx2  >, Idof > {
+         using Vec = simd< int64_t, avx2  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Stores a vector register into aligned memory.
+    * @details todo.
+    * @param memory Aligned memory which should receive the vector register.
+    * @param vec Vector which should be stored.
+    * @return Nothing.
+    */
+         TVL_FORCE_INLINE static void apply(
+            typename Vec::base_type *  memory, 
+            typename Vec::register_type  vec
+         ) {_mm256_store_si256( reinterpret_cast< __m256i * >( memory ), vec );
+         }
+      };
+   } // end of namespace details for template specialization of store_impl for avx2 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct storeu_impl< simd< int64_t, avx2  >, Idof > {
+         using Vec = simd< int64_t, avx2  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Stores a vector register into (un)aligned memory.
+    * @details todo.
+    * @param memory (Un)aligned memory which should receive the vector register.
+    * @param vec Vector which should be stored.
+    * @return Nothing.
+    */
+         TVL_FORCE_INLINE static void apply(
+            typename Vec::base_type *  memory, 
+            typename Vec::register_type  vec
+         ) {_mm256_storeu_si256( reinterpret_cast< __m256i * >( memory ), vec );
+         }
+      };
+   } // end of namespace details for template specialization of storeu_impl for avx2 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct maskz_loadu_impl< simd< int64_t, avx2  >, Idof > {
+         using Vec = simd< int64_t, avx2  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Loads the selected lanes from (un)aligned memory and zeroes the others.
+    * @details todo.
+    * @param memory (Un)aligned memory, lanes which are not selected are not accessed.
+    * @param mask Vector mask register selecting the lanes to load.
+    * @return Vector containing the loaded lanes and zero in all other lanes.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::base_type const *  memory, 
+            typename Vec::mask_type  mask
+         ) {return _mm256_maskload_epi64( reinterpret_cast< long long const * >( memory ), mask );
+         }
+      };
+   } // end of namespace details for template specialization of maskz_loadu_impl for avx2 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct loadu_partial_impl< simd< int64_t, avx2  >, Idof > {
+         using Vec = simd< int64_t, avx2  >;
+         static constexpr bool native_supported() {
+            return false;
+         }
+   /*
+    * @brief Loads the first bytes of a vector register from (un)aligned memory and zeroes the rest.
+    * @details todo.
+    * @param memory (Un)aligned memory, only [memory, memory + bytes) is accessed.
+    * @param bytes Number of bytes to load, in [0, vector_size_B()].
+    * @return Vector containing the loaded bytes followed by zeroes.
+    */
+         [[nodiscard]] TVL_NO_NATIVE_SUPPORT_WARNING
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::base_type const *  memory, 
+            int32_t  bytes
+         ) {
+            static_assert( !std::is_same_v< Idof, native >, "The primitive loadu_partial is not supported by your hardware natively while it is forced by using native" );
+            alignas( Vec::vector_alignment() ) typename Vec::base_type buffer[ Vec::vector_element_count() ]{ };
+            __builtin_memcpy( buffer, memory, bytes );
+            return tvl::load< Vec >( buffer );
+         }
+      };
+   } // end of namespace details for template specialization of loadu_partial_impl for avx2 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct storeu_partial_impl< simd< int64_t, avx2  >, Idof > {
+         using Vec = simd< int64_t, avx2  >;
+         static constexpr bool native_supported() {
+            return false;
+         }
+   /*
+    * @brief Stores the first bytes of a vector register into (un)aligned memory.
+    * @details todo.
+    * @param memory (Un)aligned memory, only [memory, memory + bytes) is written.
+    * @param vec Vector which should be stored.
+    * @param bytes Number of bytes to store, in [0, vector_size_B()].
+    * @return Nothing.
+    */
+         TVL_NO_NATIVE_SUPPORT_WARNING
+         TVL_FORCE_INLINE static void apply(
+            typename Vec::base_type *  memory, 
+            typename Vec::register_type  vec, 
+            int32_t  bytes
+         ) {
+            static_assert( !std::is_same_v< Idof, native >, "The primitive storeu_partial is not supported by your hardware natively while it is forced by using native" );
+            alignas( Vec::vector_alignment() ) typename Vec::base_type buffer[ Vec::vector_element_count() ];
+            tvl::store< Vec >( buffer, vec );
+            __builtin_memcpy( memory, buffer, bytes );
+         }
+      };
+   } // end of namespace details for template specialization of storeu_partial_impl for avx2 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct stream_impl< simd< int64_t, avx2  >, Idof > {
+         using Vec = simd< int64_t, avx2  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Stores a vector register into aligned memory bypassing the caches (non-temporal store).
+    * @details todo.
+    * @param memory Aligned memory which should receive the vector register.
+    * @param vec Vector which should be stored.
+    * @return Nothing. Call stream_fence before the memory is handed to another thread.
+    */
+         TVL_FORCE_INLINE static void apply(
+            typename Vec::base_type *  memory, 
+            typename Vec::register_type  vec
+         ) {_mm256_stream_si256( reinterpret_cast< __m256i * >( memory ), vec );
+         }
+      };
+   } // end of namespace details for template specialization of stream_impl for avx2 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct stream_fence_impl< simd< int64_t, avx2  >, Idof > {
+         using Vec = simd< int64_t, avx2  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Orders preceding stream stores before all following stores.
+    * @details todo.
+    * @return Nothing.
+    */
+         TVL_FORCE_INLINE static void apply(
+
+         ) {_mm_sfence( );
+         }
+      };
+   } // end of namespace details for template specialization of stream_fence_impl for avx2 using int64_t.
+   
    namespace details {
       template< ImplementationDegreeOfFreedom Idof >
       struct set1_impl< simd< int64_t, avx2  >, Idof > {
@@ -48,6 +48,27 @@ namespace tvl {
       };
    } // end of namespace details for template specialization of load_impl for avx512 using int64_t.
    
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct load_impl< simd< int64_t, avx512, 256 >, Idof > {
+         using Vec = simd< int64_t, avx512, 256 >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Loads data from aligned memory into a vector register.
+    * @details todo.
+    * @param memory Aligned memory which should be transferred into a vector register.
+    * @return Vector containing the loaded data.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::base_type const *  memory
+         ) {return _mm256_load_si256( reinterpret_cast< __m256i const * >( memory ) );
+         }
+      };
+   } // end of namespace details for template specialization of load_impl for avx512 using int64_t.
+   
    namespace details {
       template< ImplementationDegreeOfFreedom Idof >
       struct loadu_impl< simd< int64_t, avx512  >, Idof > {
@@ -69,6 +90,345 @@ namespace tvl {
       };
    } // end of namespace details for template specialization of loadu_impl for avx512 using int64_t.
    
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct loadu_impl< simd< int64_t, avx512, 256 >, Idof > {
+         using Vec = simd< int64_t, avx512, 256 >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Loads data from (un)aligned memory into a vector register.
+    * @details todo.
+    * @param memory (Un)aligned memory which should be transferred into a vector register.
+    * @return Vector containing the loaded data.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::base_type const *  memory
+         ) {return _mm256_loadu_si256( reinterpret_cast< __m256i const * >( memory ) );
+         }
+      };
+   } // end of namespace details for template specialization of loadu_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct store_impl< simd< int64_t, avx512  >, Idof > {
+         using Vec = simd< int64_t, avx512  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Stores a vector register into aligned memory.
+    * @details todo.
+    * @param memory Aligned memory which should receive the vector register.
+    * @param vec Vector which should be stored.
+    * @return Nothing.
+    */
+         TVL_FORCE_INLINE static void apply(
+            typename Vec::base_type *  memory, 
+            typename Vec::register_type  vec
+         ) {_mm512_store_si512( reinterpret_cast< void * >( memory ), vec );
+         }
+      };
+   } // end of namespace details for template specialization of store_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct store_impl< simd< int64_t, avx512, 256 >, Idof > {
+         using Vec = simd< int64_t, avx512, 256 >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Stores a vector register into aligned memory.
+    * @details todo.
+    * @param memory Aligned memory which should receive the vector register.
+    * @param vec Vector which should be stored.
+    * @return Nothing.
+    */
+         TVL_FORCE_INLINE static void apply(
+            typename Vec::base_type *  memory, 
+            typename Vec::register_type  vec
+         ) {_mm256_store_si256( reinterpret_cast< __m256i * >( memory ), vec );
+         }
+      };
+   } // end of namespace details for template specialization of store_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct storeu_impl< simd< int64_t, avx512  >, Idof > {
+         using Vec = simd< int64_t, avx512  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Stores a vector register into (un)aligned memory.
+    * @details todo.
+    * @param memory (Un)aligned memory which should receive the vector register.
+    * @param vec Vector which should be stored.
+    * @return Nothing.
+    */
+         TVL_FORCE_INLINE static void apply(
+            typename Vec::base_type *  memory, 
+            typename Vec::register_type  vec
+         ) {_mm512_storeu_si512( reinterpret_cast< void * >( memory ), vec );
+         }
+      };
+   } // end of namespace details for template specialization of storeu_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct storeu_impl< simd< int64_t, avx512, 256 >, Idof > {
+         using Vec = simd< int64_t, avx512, 256 >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Stores a vector register into (un)aligned memory.
+    * @details todo.
+    * @param memory (Un)aligned memory which should receive the vector register.
+    * @param vec Vector which should be stored.
+    * @return Nothing.
+    */
+         TVL_FORCE_INLINE static void apply(
+            typename Vec::base_type *  memory, 
+            typename Vec::register_type  vec
+         ) {_mm256_storeu_si256( reinterpret_cast< __m256i * >( memory ), vec );
+         }
+      };
+   } // end of namespace details for template specialization of storeu_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct maskz_loadu_impl< simd< int64_t, avx512  >, Idof > {
+         using Vec = simd< int64_t, avx512  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Loads the selected lanes from (un)aligned memory and zeroes the others.
+    * @details todo.
+    * @param memory (Un)aligned memory, lanes which are not selected are not accessed.
+    * @param mask Vector mask register selecting the lanes to load.
+    * @return Vector containing the loaded lanes and zero in all other lanes.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::base_type const *  memory, 
+            typename Vec::mask_type  mask
+         ) {return _mm512_maskz_loadu_epi64( mask, memory );
+         }
+      };
+   } // end of namespace details for template specialization of maskz_loadu_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct maskz_loadu_impl< simd< int64_t, avx512, 256 >, Idof > {
+         using Vec = simd< int64_t, avx512, 256 >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Loads the selected lanes from (un)aligned memory and zeroes the others.
+    * @details todo.
+    * @param memory (Un)aligned memory, lanes which are not selected are not accessed.
+    * @param mask Vector mask register selecting the lanes to load.
+    * @return Vector containing the loaded lanes and zero in all other lanes.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::base_type const *  memory, 
+            typename Vec::mask_type  mask
+         ) {return _mm256_maskz_loadu_epi64( mask, memory );
+         }
+      };
+   } // end of namespace details for template specialization of maskz_loadu_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct loadu_partial_impl< simd< int64_t, avx512  >, Idof > {
+         using Vec = simd< int64_t, avx512  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Loads the first bytes of a vector register from (un)aligned memory and zeroes the rest.
+    * @details todo.
+    * @param memory (Un)aligned memory, only [memory, memory + bytes) is accessed.
+    * @param bytes Number of bytes to load, in [0, vector_size_B()].
+    * @return Vector containing the loaded bytes followed by zeroes.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::base_type const *  memory, 
+            int32_t  bytes
+         ) {
+            auto const mask = bytes >= 64 ? ~__mmask64{ 0 } : ( __mmask64{ 1 } << bytes ) - 1;
+            return _mm512_maskz_loadu_epi8( mask, memory );
+         }
+      };
+   } // end of namespace details for template specialization of loadu_partial_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct loadu_partial_impl< simd< int64_t, avx512, 256 >, Idof > {
+         using Vec = simd< int64_t, avx512, 256 >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Loads the first bytes of a vector register from (un)aligned memory and zeroes the rest.
+    * @details todo.
+    * @param memory (Un)aligned memory, only [memory, memory + bytes) is accessed.
+    * @param bytes Number of bytes to load, in [0, vector_size_B()].
+    * @return Vector containing the loaded bytes followed by zeroes.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::base_type const *  memory, 
+            int32_t  bytes
+         ) {
+            auto const mask = static_cast< __mmask32 >( ( uint64_t{ 1 } << bytes ) - 1 );
+            return _mm256_maskz_loadu_epi8( mask, memory );
+         }
+      };
+   } // end of namespace details for template specialization of loadu_partial_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct storeu_partial_impl< simd< int64_t, avx512  >, Idof > {
+         using Vec = simd< int64_t, avx512  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Stores the first bytes of a vector register into (un)aligned memory.
+    * @details todo.
+    * @param memory (Un)aligned memory, only [memory, memory + bytes) is written.
+    * @param vec Vector which should be stored.
+    * @param bytes Number of bytes to store, in [0, vector_size_B()].
+    * @return Nothing.
+    */
+         TVL_FORCE_INLINE static void apply(
+            typename Vec::base_type *  memory, 
+            typename Vec::register_type  vec, 
+            int32_t  bytes
+         ) {
+            auto const mask = bytes >= 64 ? ~__mmask64{ 0 } : ( __mmask64{ 1 } << bytes ) - 1;
+            _mm512_mask_storeu_epi8( memory, mask, vec );
+         }
+      };
+   } // end of namespace details for template specialization of storeu_partial_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct storeu_partial_impl< simd< int64_t, avx512, 256 >, Idof > {
+         using Vec = simd< int64_t, avx512, 256 >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Stores the first bytes of a vector register into (un)aligned memory.
+    * @details todo.
+    * @param memory (Un)aligned memory, only [memory, memory + bytes) is written.
+    * @param vec Vector which should be stored.
+    * @param bytes Number of bytes to store, in [0, vector_size_B()].
+    * @return Nothing.
+    */
+         TVL_FORCE_INLINE static void apply(
+            typename Vec::base_type *  memory, 
+            typename Vec::register_type  vec, 
+            int32_t  bytes
+         ) {
+            auto const mask = static_cast< __mmask32 >( ( uint64_t{ 1 } << bytes ) - 1 );
+            _mm256_mask_storeu_epi8( memory, mask, vec );
+         }
+      };
+   } // end of namespace details for template specialization of storeu_partial_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct stream_impl< simd< int64_t, avx512  >, Idof > {
+         using Vec = simd< int64_t, avx512  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Stores a vector register into aligned memory bypassing the caches (non-temporal store).
+    * @details todo.
+    * @param memory Aligned memory which should receive the vector register.
+    * @param vec Vector which should be stored.
+    * @return Nothing. Call stream_fence before the memory is handed to another thread.
+    */
+         TVL_FORCE_INLINE static void apply(
+            typename Vec::base_type *  memory, 
+            typename Vec::register_type  vec
+         ) {_mm512_stream_si512( reinterpret_cast< __m512i * >( memory ), vec );
+         }
+      };
+   } // end of namespace details for template specialization of stream_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct stream_impl< simd< int64_t, avx512, 256 >, Idof > {
+         using Vec = simd< int64_t, avx512, 256 >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Stores a vector register into aligned memory bypassing the caches (non-temporal store).
+    * @details todo.
+    * @param memory Aligned memory which should receive the vector register.
+    * @param vec Vector which should be stored.
+    * @return Nothing. Call stream_fence before the memory is handed to another thread.
+    */
+         TVL_FORCE_INLINE static void apply(
+            typename Vec::base_type *  memory, 
+            typename Vec::register_type  vec
+         ) {_mm256_stream_si256( reinterpret_cast< __m256i * >( memory ), vec );
+         }
+      };
+   } // end of namespace details for template specialization of stream_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct stream_fence_impl< simd< int64_t, avx512  >, Idof > {
+         using Vec = simd< int64_t, avx512  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Orders preceding stream stores before all following stores.
+    * @details todo.
+    * @return Nothing.
+    */
+         TVL_FORCE_INLINE static void apply(
+
+         ) {_mm_sfence( );
+         }
+      };
+   } // end of namespace details for template specialization of stream_fence_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct stream_fence_impl< simd< int64_t, avx512, 256 >, Idof > {
+         using Vec = simd< int64_t, avx512, 256 >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Orders preceding stream stores before all following stores.
+    * @details todo.
+    * @return Nothing.
+    */
+         TVL_FORCE_INLINE static void apply(
+
+         ) {_mm_sfence( );
+         }
+      };
+   } // end of namespace details for template specialization of stream_fence_impl for avx512 using int64_t.
+   
    namespace details {
       template< ImplementationDegreeOfFreedom Idof >
       struct set1_impl< simd< int64_t, avx512  >, Idof > {
@@ -90,6 +450,27 @@ namespace tvl {
       };
    } // end of namespace details for template specialization of set1_impl for avx512 using int64_t.
    
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct set1_impl< simd< int64_t, avx512, 256 >, Idof > {
+         using Vec = simd< int64_t, avx512, 256 >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Broadcasts a single value into all lanes of a vector register.
+    * @details todo.
+    * @param value Value which should be broadcasted.
+    * @return Vector containing the same value in all lanes.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::base_type  value
+         ) {return _mm256_set1_epi64x( value );
+         }
+      };
+   } // end of namespace details for template specialization of set1_impl for avx512 using int64_t.
+   
    namespace details {
       template< ImplementationDegreeOfFreedom Idof >
       struct gather_impl< simd< int64_t, avx512  >, Idof > {
@@ -117,6 +498,33 @@ namespace tvl {
       };
    } // end of namespace details for template specialization of gather_impl for avx512 using int64_t.
    
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct gather_impl< simd< int64_t, avx512, 256 >, Idof > {
+         using Vec = simd< int64_t, avx512, 256 >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Transfers data from arbitrary locations into a vector register.
+    * @details todo.
+    * @param source Vector register containing values which should be preserved depending on the mask (if mask[i] == 0).
+    * @param memory (Start)pointer of the memory (which is used as base for address calculation).
+    * @param index Offsets (in base_type granularity) relative to the start pointer.
+    * @param mask Mask indicating which lanes should be gathered.
+    * @return Vector containing gathered data.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  source, 
+            typename Vec::base_type const *  memory, 
+            typename Vec::register_type  index, 
+            typename Vec::mask_type  mask
+         ) {return _mm256_mmask_i64gather_epi64( source, mask, index, reinterpret_cast< void const * >( memory ), 8 );
+         }
+      };
+   } // end of namespace details for template specialization of gather_impl for avx512 using int64_t.
+   
 } // end of namespace tvl
 
 #endif //TUD_D2RG_TVL_LIB_GENERATED_DEFINITIONS_IO_IO_AVX512_HPP
\ No newline at end of file
@@ -0,0 +1,314 @@
+/**********************************************************************************************
+ * This file is part of the TVL Project.                                                      *
+ * Copyright (C) 2022 by TVL-Team                                                             *
+ *                                                                                            *
+ * This file is part of TVL - a template simd library.                                        *
+ *                                                                                            *
+ * This program is free software: you can redistribute it and/or modify it under the          *
+ * terms of the GNU General Public License as published by the Free Software Foundation,      *
+ * either version 3 of the License, or (at your option) any later version.                    *
+ *                                                                                            *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;  *
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  *
+ * See the GNU General Public License for more details.                                       *
+ *                                                                                            *
+ * You should have received a copy of the GNU General Public License along with this program. *
+ * If not, see <http://www.gnu.org/licenses/>.                                                *
+ **********************************************************************************************/
+ //todo: Apache2
+/*
+ * @file lib/generated/definitions/io/io_scalar.hpp
+ * @date 17.02.2022
+ * @brief I/O primitives. Implementation for scalar
+ */
+#ifndef TUD_D2RG_TVL_LIB_GENERATED_DEFINITIONS_IO_IO_SCALAR_HPP
+#define TUD_D2RG_TVL_LIB_GENERATED_DEFINITIONS_IO_IO_SCALAR_HPP
+
+#include "../../declarations/io.hpp"
+
+namespace tvl {
+   namespace details {
+      template< std::size_t VectorSizeInBits, ImplementationDegreeOfFreedom Idof >
+      struct load_impl< simd< int64_t, scalar, VectorSizeInBits >, Idof > {
+         using Vec = simd< int64_t, scalar, VectorSizeInBits >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Loads data from aligned memory into a vector register.
+    * @details todo.
+    * @param memory Aligned memory which should be transferred into a vector register.
+    * @return Vector containing the loaded data.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::base_type const *  memory
+         ) {
+            typename Vec::register_type result{ };
+            for( std::size_t i = 0; i < Vec::vector_element_count(); ++i ) {
+               result[ i ] = memory[ i ];
+            }
+            return result;
+         }
+      };
+   } // end of namespace details for template specialization of load_impl for scalar using int64_t.
+   
+   namespace details {
+      template< std::size_t VectorSizeInBits, ImplementationDegreeOfFreedom Idof >
+      struct loadu_impl< simd< int64_t, scalar, VectorSizeInBits >, Idof > {
+         using Vec = simd< int64_t, scalar, VectorSizeInBits >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Loads data from (un)aligned memory into a vector register.
+    * @details todo.
+    * @param memory (Un)aligned memory which should be transferred into a vector register.
+    * @return Vector containing the loaded data.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::base_type const *  memory
+         ) {
+            typename Vec::register_type result{ };
+            for( std::size_t i = 0; i < Vec::vector_element_count(); ++i ) {
+               result[ i ] = memory[ i ];
+            }
+            return result;
+         }
+      };
+   } // end of namespace details for template specialization of loadu_impl for scalar using int64_t.
+   
+   namespace details {
+      template< std::size_t VectorSizeInBits, ImplementationDegreeOfFreedom Idof >
+      struct store_impl< simd< int64_t, scalar, VectorSizeInBits >, Idof > {
+         using Vec = simd< int64_t, scalar, VectorSizeInBits >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Stores a vector register into aligned memory.
+    * @details todo.
+    * @param memory Aligned memory which should receive the vector register.
+    * @param vec Vector which should be stored.
+    * @return Nothing.
+    */
+         TVL_FORCE_INLINE static void apply(
+            typename Vec::base_type *  memory, 
+            typename Vec::register_type  vec
+         ) {
+            for( std::size_t i = 0; i < Vec::vector_element_count(); ++i ) {
+               memory[ i ] = vec[ i ];
+            }
+         }
+      };
+   } // end of namespace details for template specialization of store_impl for scalar using int64_t.
+   
+   namespace details {
+      template< std::size_t VectorSizeInBits, ImplementationDegreeOfFreedom Idof >
+      struct storeu_impl< simd< int64_t, scalar, VectorSizeInBits >, Idof > {
+         using Vec = simd< int64_t, scalar, VectorSizeInBits >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Stores a vector register into (un)aligned memory.
+    * @details todo.
+    * @param memory (Un)aligned memory which should receive the vector register.
+    * @param vec Vector which should be stored.
+    * @return Nothing.
+    */
+         TVL_FORCE_INLINE static void apply(
+            typename Vec::base_type *  memory, 
+            typename Vec::register_type  vec
+         ) {
+            for( std::size_t i = 0; i < Vec::vector_element_count(); ++i ) {
+               memory[ i ] = vec[ i ];
+            }
+         }
+      };
+   } // end of namespace details for template specialization of storeu_impl for scalar using int64_t.
+   
+   namespace details {
+      template< std::size_t VectorSizeInBits, ImplementationDegreeOfFreedom Idof >
+      struct maskz_loadu_impl< simd< int64_t, scalar, VectorSizeInBits >, Idof > {
+         using Vec = simd< int64_t, scalar, VectorSizeInBits >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Loads the selected lanes from (un)aligned memory and zeroes the others.
+    * @details todo.
+    * @param memory (Un)aligned memory, lanes which are not selected are not accessed.
+    * @param mask Vector mask register selecting the lanes to load.
+    * @return Vector containing the loaded lanes and zero in all other lanes.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::base_type const *  memory, 
+            typename Vec::mask_type  mask
+         ) {
+            typename Vec::register_type result{ };
+            for( std::size_t i = 0; i < Vec::vector_element_count(); ++i ) {
+               result[ i ] = mask[ i ] ? memory[ i ] : 0;
+            }
+            return result;
+         }
+      };
+   } // end of namespace details for template specialization of maskz_loadu_impl for scalar using int64_t.
+   
+   namespace details {
+      template< std::size_t VectorSizeInBits, ImplementationDegreeOfFreedom Idof >
+      struct loadu_partial_impl< simd< int64_t, scalar, VectorSizeInBits >, Idof > {
+         using Vec = simd< int64_t, scalar, VectorSizeInBits >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Loads the first bytes of a vector register from (un)aligned memory and zeroes the rest.
+    * @details todo.
+    * @param memory (Un)aligned memory, only [memory, memory + bytes) is accessed.
+    * @param bytes Number of bytes to load, in [0, vector_size_B()].
+    * @return Vector containing the loaded bytes followed by zeroes.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::base_type const *  memory, 
+            int32_t  bytes
+         ) {
+            typename Vec::register_type result{ };
+            __builtin_memcpy( &result, memory, bytes );
+            return result;
+         }
+      };
+   } // end of namespace details for template specialization of loadu_partial_impl for scalar using int64_t.
+   
+   namespace details {
+      template< std::size_t VectorSizeInBits, ImplementationDegreeOfFreedom Idof >
+      struct storeu_partial_impl< simd< int64_t, scalar, VectorSizeInBits >, Idof > {
+         using Vec = simd< int64_t, scalar, VectorSizeInBits >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Stores the first bytes of a vector register into (un)aligned memory.
+    * @details todo.
+    * @param memory (Un)aligned memory, only [memory, memory + bytes) is written.
+    * @param vec Vector which should be stored.
+    * @param bytes Number of bytes to store, in [0, vector_size_B()].
+    * @return Nothing.
+    */
+         TVL_FORCE_INLINE static void apply(
+            typename Vec::base_type *  memory, 
+            typename Vec::register_type  vec, 
+            int32_t  bytes
+         ) {__builtin_memcpy( memory, &vec, bytes );
+         }
+      };
+   } // end of namespace details for template specialization of storeu_partial_impl for scalar using int64_t.
+   
+   namespace details {
+      template< std::size_t VectorSizeInBits, ImplementationDegreeOfFreedom Idof >
+      struct stream_impl< simd< int64_t, scalar, VectorSizeInBits >, Idof > {
+         using Vec = simd< int64_t, scalar, VectorSizeInBits >;
+         static constexpr bool native_supported() {
+            return false;
+         }
+   /*
+    * @brief Stores a vector register into aligned memory bypassing the caches (non-temporal store).
+    * @details todo.
+    * @param memory Aligned memory which should receive the vector register.
+    * @param vec Vector which should be stored.
+    * @return Nothing. Call stream_fence before the memory is handed to another thread.
+    */
+         TVL_NO_NATIVE_SUPPORT_WARNING
+         TVL_FORCE_INLINE static void apply(
+            typename Vec::base_type *  memory, 
+            typename Vec::register_type  vec
+         ) {
+            static_assert( !std::is_same_v< Idof, native >, "The primitive stream is not supported by your hardware natively while it is forced by using native" );
+            tvl::store< Vec >( memory, vec );
+         }
+      };
+   } // end of namespace details for template specialization of stream_impl for scalar using int64_t.
+   
+   namespace details {
+      template< std::size_t VectorSizeInBits, ImplementationDegreeOfFreedom Idof >
+      struct stream_fence_impl< simd< int64_t, scalar, VectorSizeInBits >, Idof > {
+         using Vec = simd< int64_t, scalar, VectorSizeInBits >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Orders preceding stream stores before all following stores.
+    * @details todo.
+    * @return Nothing.
+    */
+         TVL_FORCE_INLINE static void apply(
+
+         ) {// stream is a regular store.
+         }
+      };
+   } // end of namespace details for template specialization of stream_fence_impl for scalar using int64_t.
+   
+   namespace details {
+      template< std::size_t VectorSizeInBits, ImplementationDegreeOfFreedom Idof >
+      struct set1_impl< simd< int64_t, scalar, VectorSizeInBits >, Idof > {
+         using Vec = simd< int64_t, scalar, VectorSizeInBits >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Broadcasts a single value into all lanes of a vector register.
+    * @details todo.
+    * @param value Value which should be broadcasted.
+    * @return Vector containing the same value in all lanes.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::base_type  value
+         ) {
+            typename Vec::register_type result{ };
+            for( std::size_t i = 0; i < Vec::vector_element_count(); ++i ) {
+               result[ i ] = value;
+            }
+            return result;
+         }
+      };
+   } // end of namespace details for template specialization of set1_impl for scalar using int64_t.
+   
+   namespace details {
+      template< std::size_t VectorSizeInBits, ImplementationDegreeOfFreedom Idof >
+      struct gather_impl< simd< int64_t, scalar, VectorSizeInBits >, Idof > {
+         using Vec = simd< int64_t, scalar, VectorSizeInBits >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Transfers data from arbitrary locations into a vector register.
+    * @details todo.
+    * @param source Vector register containing values which should be preserved depending on the mask (if mask[i] == 0).
+    * @param memory (Start)pointer of the memory (which is used as base for address calculation).
+    * @param index Offsets (in base_type granularity) relative to the start pointer.
+    * @param mask Mask indicating which lanes should be gathered.
+    * @return Vector containing gathered data.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  source, 
+            typename Vec::base_type const *  memory, 
+            typename Vec::register_type  index, 
+            typename Vec::mask_type  mask
+         ) {
+            typename Vec::register_type result{ };
+            for( std::size_t i = 0; i < Vec::vector_element_count(); ++i ) {
+               result[ i ] = ( mask[ i ] == 0 ) ? source[ i ] : memory[ index[ i ] ];
+            }
+            return result;
+         }
+      };
+   } // end of namespace details for template specialization of gather_impl for scalar using int64_t.
+   
+} // end of namespace tvl
+
+#endif //TUD_D2RG_TVL_LIB_GENERATED_DEFINITIONS_IO_IO_SCALAR_HPP
\ No newline at end of file
@@ -48,6 +48,52 @@ namespace tvl {
       };
    } // end of namespace details for template specialization of to_integral_impl for avx2 using int64_t.
    
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct from_integral_impl< simd< int64_t, avx2  >, Idof > {
+         using Vec = simd< int64_t, avx2  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Forms a vector mask register from the lower bits of an integral value (inverse of to_integral).
+    * @details todo.
+    * @param mask Integral value, bit i selects lane i.
+    * @return Vector mask register selecting the lanes whose bit is set.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::mask_type apply(
+            typename Vec::base_type  mask
+         ) {
+            auto const lane_bits = _mm256_setr_epi64x( 1, 2, 4, 8 );
+            return _mm256_cmpeq_epi64( _mm256_and_si256( _mm256_set1_epi64x( mask ), lane_bits ), lane_bits );
+         }
+      };
+   } // end of namespace details for template specialization of from_integral_impl for avx2 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct leading_mask_impl< simd< int64_t, avx2  >, Idof > {
+         using Vec = simd< int64_t, avx2  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Forms a vector mask register selecting the first lanes, e.g. for the ragged tail of a batch.
+    * @details todo.
+    * @param count Number of selected lanes, in [0, vector_element_count()].
+    * @return Vector mask register selecting the lanes [0, count).
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::mask_type apply(
+            int32_t  count
+         ) {
+            static constexpr int64_t kLeading[ 8 ] = { -1, -1, -1, -1, 0, 0, 0, 0 };
+            return _mm256_loadu_si256( reinterpret_cast< __m256i const * >( kLeading + 4 - count ) );
+         }
+      };
+   } // end of namespace details for template specialization of leading_mask_impl for avx2 using int64_t.
+   
    namespace details {
       template< ImplementationDegreeOfFreedom Idof >
       struct get_msb_impl< simd< int64_t, avx2  >, Idof > {
@@ -111,6 +157,70 @@ namespace tvl {
       };
    } // end of namespace details for template specialization of mask_reduce_impl for avx2 using int64_t.
    
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct mask_popcount_impl< simd< int64_t, avx2  >, Idof > {
+         using Vec = simd< int64_t, avx2  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Counts the relevant set bits of an integral mask.
+    * @details todo.
+    * @param mask Integral value containing n (set) bits (see to_integral and get_msb).
+    * @return Number of lanes selected by mask.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::base_type apply(
+            typename Vec::base_type  mask
+         ) {return _mm_popcnt_u32( mask & 0xF );
+         }
+      };
+   } // end of namespace details for template specialization of mask_popcount_impl for avx2 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct mask_lane_indices_impl< simd< int64_t, avx2  >, Idof > {
+         using Vec = simd< int64_t, avx2  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Writes the indices of the lanes selected by an integral mask in ascending order.
+    * @details todo.
+    * @param mask Integral value containing n (set) bits (see to_integral and get_msb).
+    * @param indices Destination, must have room for Vec::vector_element_count() values. Entries past the returned count are unspecified.
+    * @return Number of indices written (same as mask_popcount).
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::base_type apply(
+            typename Vec::base_type  mask, 
+            int32_t *  indices
+         ) {
+            alignas( 16 ) static constexpr int32_t kLanes[ 16 ][ 4 ] = {
+               { 0, 0, 0, 0 },
+               { 0, 0, 0, 0 },
+               { 1, 0, 0, 0 },
+               { 0, 1, 0, 0 },
+               { 2, 0, 0, 0 },
+               { 0, 2, 0, 0 },
+               { 1, 2, 0, 0 },
+               { 0, 1, 2, 0 },
+               { 3, 0, 0, 0 },
+               { 0, 3, 0, 0 },
+               { 1, 3, 0, 0 },
+               { 0, 1, 3, 0 },
+               { 2, 3, 0, 0 },
+               { 0, 2, 3, 0 },
+               { 1, 2, 3, 0 },
+               { 0, 1, 2, 3 }
+            };
+            _mm_storeu_si128( reinterpret_cast< __m128i * >( indices ), _mm_load_si128( reinterpret_cast< __m128i const * >( kLanes[ mask & 0xF ] ) ) );
+            return _mm_popcnt_u32( mask & 0xF );
+         }
+      };
+   } // end of namespace details for template specialization of mask_lane_indices_impl for avx2 using int64_t.
+   
 } // end of namespace tvl
 
 #endif //TUD_D2RG_TVL_LIB_GENERATED_DEFINITIONS_MASK_MASK_AVX2_HPP
\ No newline at end of file
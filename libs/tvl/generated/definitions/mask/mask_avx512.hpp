@@ -48,6 +48,111 @@ namespace tvl {
       };
    } // end of namespace details for template specialization of to_integral_impl for avx512 using int64_t.
    
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct to_integral_impl< simd< int64_t, avx512, 256 >, Idof > {
+         using Vec = simd< int64_t, avx512, 256 >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Forms an integral value from the most significant bits of every lane in a vector mask register.
+    * @details todo.
+    * @param vec_mask Vector mask register containing mask style data.
+    * @return Integral value representing the vector mask register.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::base_type apply(
+            typename Vec::mask_type  vec_mask
+         ) {return vec_mask; //mask is integral already.
+         }
+      };
+   } // end of namespace details for template specialization of to_integral_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct from_integral_impl< simd< int64_t, avx512  >, Idof > {
+         using Vec = simd< int64_t, avx512  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Forms a vector mask register from the lower bits of an integral value (inverse of to_integral).
+    * @details todo.
+    * @param mask Integral value, bit i selects lane i.
+    * @return Vector mask register selecting the lanes whose bit is set.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::mask_type apply(
+            typename Vec::base_type  mask
+         ) {return mask; //mask is integral already.
+         }
+      };
+   } // end of namespace details for template specialization of from_integral_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct from_integral_impl< simd< int64_t, avx512, 256 >, Idof > {
+         using Vec = simd< int64_t, avx512, 256 >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Forms a vector mask register from the lower bits of an integral value (inverse of to_integral).
+    * @details todo.
+    * @param mask Integral value, bit i selects lane i.
+    * @return Vector mask register selecting the lanes whose bit is set.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::mask_type apply(
+            typename Vec::base_type  mask
+         ) {return mask & 0xF; //mask is integral already.
+         }
+      };
+   } // end of namespace details for template specialization of from_integral_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct leading_mask_impl< simd< int64_t, avx512  >, Idof > {
+         using Vec = simd< int64_t, avx512  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Forms a vector mask register selecting the first lanes, e.g. for the ragged tail of a batch.
+    * @details todo.
+    * @param count Number of selected lanes, in [0, vector_element_count()].
+    * @return Vector mask register selecting the lanes [0, count).
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::mask_type apply(
+            int32_t  count
+         ) {return static_cast< __mmask8 >( ( 1U << count ) - 1 );
+         }
+      };
+   } // end of namespace details for template specialization of leading_mask_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct leading_mask_impl< simd< int64_t, avx512, 256 >, Idof > {
+         using Vec = simd< int64_t, avx512, 256 >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Forms a vector mask register selecting the first lanes, e.g. for the ragged tail of a batch.
+    * @details todo.
+    * @param count Number of selected lanes, in [0, vector_element_count()].
+    * @return Vector mask register selecting the lanes [0, count).
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::mask_type apply(
+            int32_t  count
+         ) {return static_cast< __mmask8 >( ( 1U << count ) - 1 );
+         }
+      };
+   } // end of namespace details for template specialization of leading_mask_impl for avx512 using int64_t.
+   
    namespace details {
       template< ImplementationDegreeOfFreedom Idof >
       struct get_msb_impl< simd< int64_t, avx512  >, Idof > {
@@ -69,6 +174,27 @@ namespace tvl {
       };
    } // end of namespace details for template specialization of get_msb_impl for avx512 using int64_t.
    
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct get_msb_impl< simd< int64_t, avx512, 256 >, Idof > {
+         using Vec = simd< int64_t, avx512, 256 >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Retrieves the most significant bit of every element in a vector register and sets the corresponding bit in a base type.
+    * @details todo.
+    * @param vec Vector mask register containing mask style data.
+    * @return Integral value representing the vector mask register.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::base_type apply(
+            typename Vec::register_type  vec
+         ) {return _mm256_movepi64_mask( vec );
+         }
+      };
+   } // end of namespace details for template specialization of get_msb_impl for avx512 using int64_t.
+   
    namespace details {
       template< ImplementationDegreeOfFreedom Idof >
       struct to_vector_impl< simd< int64_t, avx512  >, Idof > {
@@ -90,6 +216,27 @@ namespace tvl {
       };
    } // end of namespace details for template specialization of to_vector_impl for avx512 using int64_t.
    
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct to_vector_impl< simd< int64_t, avx512, 256 >, Idof > {
+         using Vec = simd< int64_t, avx512, 256 >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Forms an vector register from an integral where all bits are set in a lane if the corresponding mask bit is set to 1.
+    * @details todo.
+    * @param mask Vector mask register containing mask style data.
+    * @return Integral value representing the vector mask register.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::mask_type  mask
+         ) {return _mm256_maskz_set1_epi64( mask, -1 );
+         }
+      };
+   } // end of namespace details for template specialization of to_vector_impl for avx512 using int64_t.
+   
    namespace details {
       template< ImplementationDegreeOfFreedom Idof >
       struct mask_reduce_impl< simd< int64_t, avx512  >, Idof > {
@@ -111,6 +258,121 @@ namespace tvl {
       };
    } // end of namespace details for template specialization of mask_reduce_impl for avx512 using int64_t.
    
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct mask_reduce_impl< simd< int64_t, avx512, 256 >, Idof > {
+         using Vec = simd< int64_t, avx512, 256 >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Masks out every non relevant bit.
+    * @details todo.
+    * @param mask Integral value containing n (set) bits.
+    * @return Integral value with only relevant bits set (or not).
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::base_type apply(
+            typename Vec::base_type  mask
+         ) {return mask & 0xF; //mask is integral already.
+         }
+      };
+   } // end of namespace details for template specialization of mask_reduce_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct mask_popcount_impl< simd< int64_t, avx512  >, Idof > {
+         using Vec = simd< int64_t, avx512  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Counts the relevant set bits of an integral mask.
+    * @details todo.
+    * @param mask Integral value containing n (set) bits (see to_integral and get_msb).
+    * @return Number of lanes selected by mask.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::base_type apply(
+            typename Vec::base_type  mask
+         ) {return _mm_popcnt_u32( mask & 0xFF );
+         }
+      };
+   } // end of namespace details for template specialization of mask_popcount_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct mask_popcount_impl< simd< int64_t, avx512, 256 >, Idof > {
+         using Vec = simd< int64_t, avx512, 256 >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Counts the relevant set bits of an integral mask.
+    * @details todo.
+    * @param mask Integral value containing n (set) bits (see to_integral and get_msb).
+    * @return Number of lanes selected by mask.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::base_type apply(
+            typename Vec::base_type  mask
+         ) {return _mm_popcnt_u32( mask & 0xF );
+         }
+      };
+   } // end of namespace details for template specialization of mask_popcount_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct mask_lane_indices_impl< simd< int64_t, avx512  >, Idof > {
+         using Vec = simd< int64_t, avx512  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Writes the indices of the lanes selected by an integral mask in ascending order.
+    * @details todo.
+    * @param mask Integral value containing n (set) bits (see to_integral and get_msb).
+    * @param indices Destination, must have room for Vec::vector_element_count() values. Entries past the returned count are unspecified.
+    * @return Number of indices written (same as mask_popcount).
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::base_type apply(
+            typename Vec::base_type  mask, 
+            int32_t *  indices
+         ) {
+            auto const lanes = _mm256_setr_epi32( 0, 1, 2, 3, 4, 5, 6, 7 );
+            _mm256_storeu_si256( reinterpret_cast< __m256i * >( indices ), _mm256_maskz_compress_epi32( static_cast< __mmask8 >( mask ), lanes ) );
+            return _mm_popcnt_u32( mask & 0xFF );
+         }
+      };
+   } // end of namespace details for template specialization of mask_lane_indices_impl for avx512 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct mask_lane_indices_impl< simd< int64_t, avx512, 256 >, Idof > {
+         using Vec = simd< int64_t, avx512, 256 >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Writes the indices of the lanes selected by an integral mask in ascending order.
+    * @details todo.
+    * @param mask Integral value containing n (set) bits (see to_integral and get_msb).
+    * @param indices Destination, must have room for Vec::vector_element_count() values. Entries past the returned count are unspecified.
+    * @return Number of indices written (same as mask_popcount).
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::base_type apply(
+            typename Vec::base_type  mask, 
+            int32_t *  indices
+         ) {
+            auto const lanes = _mm_setr_epi32( 0, 1, 2, 3 );
+            _mm_storeu_si128( reinterpret_cast< __m128i * >( indices ), _mm_maskz_compress_epi32( static_cast< __mmask8 >( mask & 0xF ), lanes ) );
+            return _mm_popcnt_u32( mask & 0xF );
+         }
+      };
+   } // end of namespace details for template specialization of mask_lane_indices_impl for avx512 using int64_t.
+   
 } // end of namespace tvl
 
 #endif //TUD_D2RG_TVL_LIB_GENERATED_DEFINITIONS_MASK_MASK_AVX512_HPP
\ No newline at end of file
@@ -50,6 +50,52 @@ namespace tvl {
       };
    } // end of namespace details for template specialization of to_integral_impl for neon using int64_t.
    
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct from_integral_impl< simd< int64_t, neon  >, Idof > {
+         using Vec = simd< int64_t, neon  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Forms a vector mask register from the lower bits of an integral value (inverse of to_integral).
+    * @details todo.
+    * @param mask Integral value, bit i selects lane i.
+    * @return Vector mask register selecting the lanes whose bit is set.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::mask_type apply(
+            typename Vec::base_type  mask
+         ) {
+            int64_t const lane_bits[ 2 ] = { 1, 2 };
+            return vtstq_s64( vdupq_n_s64( mask ), vld1q_s64( lane_bits ) );
+         }
+      };
+   } // end of namespace details for template specialization of from_integral_impl for neon using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct leading_mask_impl< simd< int64_t, neon  >, Idof > {
+         using Vec = simd< int64_t, neon  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Forms a vector mask register selecting the first lanes, e.g. for the ragged tail of a batch.
+    * @details todo.
+    * @param count Number of selected lanes, in [0, vector_element_count()].
+    * @return Vector mask register selecting the lanes [0, count).
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::mask_type apply(
+            int32_t  count
+         ) {
+            static constexpr uint64_t kLeading[ 4 ] = { ~0ULL, ~0ULL, 0, 0 };
+            return vld1q_u64( kLeading + 2 - count );
+         }
+      };
+   } // end of namespace details for template specialization of leading_mask_impl for neon using int64_t.
+   
    namespace details {
       template< ImplementationDegreeOfFreedom Idof >
       struct get_msb_impl< simd< int64_t, neon  >, Idof > {
@@ -115,6 +161,58 @@ namespace tvl {
       };
    } // end of namespace details for template specialization of mask_reduce_impl for neon using int64_t.
    
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct mask_popcount_impl< simd< int64_t, neon  >, Idof > {
+         using Vec = simd< int64_t, neon  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Counts the relevant set bits of an integral mask.
+    * @details todo.
+    * @param mask Integral value containing n (set) bits (see to_integral and get_msb).
+    * @return Number of lanes selected by mask.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::base_type apply(
+            typename Vec::base_type  mask
+         ) {return __builtin_popcount( mask & 0x3 );
+         }
+      };
+   } // end of namespace details for template specialization of mask_popcount_impl for neon using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct mask_lane_indices_impl< simd< int64_t, neon  >, Idof > {
+         using Vec = simd< int64_t, neon  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Writes the indices of the lanes selected by an integral mask in ascending order.
+    * @details todo.
+    * @param mask Integral value containing n (set) bits (see to_integral and get_msb).
+    * @param indices Destination, must have room for Vec::vector_element_count() values. Entries past the returned count are unspecified.
+    * @return Number of indices written (same as mask_popcount).
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::base_type apply(
+            typename Vec::base_type  mask, 
+            int32_t *  indices
+         ) {
+            alignas( 8 ) static constexpr int32_t kLanes[ 4 ][ 2 ] = {
+               { 0, 0 },
+               { 0, 0 },
+               { 1, 0 },
+               { 0, 1 }
+            };
+            vst1_s32( indices, vld1_s32( kLanes[ mask & 0x3 ] ) );
+            return __builtin_popcount( mask & 0x3 );
+         }
+      };
+   } // end of namespace details for template specialization of mask_lane_indices_impl for neon using int64_t.
+   
 } // end of namespace tvl
 
 #endif //TUD_D2RG_TVL_LIB_GENERATED_DEFINITIONS_MASK_MASK_NEON_HPP
\ No newline at end of file
@@ -0,0 +1,227 @@
+/**********************************************************************************************
+ * This file is part of the TVL Project.                                                      *
+ * Copyright (C) 2022 by TVL-Team                                                             *
+ *                                                                                            *
+ * This file is part of TVL - a template simd library.                                        *
+ *                                                                                            *
+ * This program is free software: you can redistribute it and/or modify it under the          *
+ * terms of the GNU General Public License as published by the Free Software Foundation,      *
+ * either version 3 of the License, or (at your option) any later version.                    *
+ *                                                                                            *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;  *
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  *
+ * See the GNU General Public License for more details.                                       *
+ *                                                                                            *
+ * You should have received a copy of the GNU General Public License along with this program. *
+ * If not, see <http://www.gnu.org/licenses/>.                                                *
+ **********************************************************************************************/
+ //todo: Apache2
+/*
+ * @file lib/generated/definitions/mask/mask_scalar.hpp
+ * @date 17.02.2022
+ * @brief Mask related primitives. Implementation for scalar
+ */
+#ifndef TUD_D2RG_TVL_LIB_GENERATED_DEFINITIONS_MASK_MASK_SCALAR_HPP
+#define TUD_D2RG_TVL_LIB_GENERATED_DEFINITIONS_MASK_MASK_SCALAR_HPP
+
+#include "../../declarations/mask.hpp"
+
+namespace tvl {
+   namespace details {
+      template< std::size_t VectorSizeInBits, ImplementationDegreeOfFreedom Idof >
+      struct to_integral_impl< simd< int64_t, scalar, VectorSizeInBits >, Idof > {
+         using Vec = simd< int64_t, scalar, VectorSizeInBits >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Forms an integral value from the most significant bits of every lane in a vector mask register.
+    * @details todo.
+    * @param vec_mask Vector mask register containing mask style data.
+    * @return Integral value representing the vector mask register.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::base_type apply(
+            typename Vec::mask_type  vec_mask
+         ) {
+            typename Vec::base_type result = 0;
+            for( std::size_t i = 0; i < Vec::vector_element_count(); ++i ) {
+               result |= ( ( static_cast< uint64_t >( vec_mask[ i ] ) >> 63 ) << i );
+            }
+            return result;
+         }
+      };
+   } // end of namespace details for template specialization of to_integral_impl for scalar using int64_t.
+   
+   namespace details {
+      template< std::size_t VectorSizeInBits, ImplementationDegreeOfFreedom Idof >
+      struct from_integral_impl< simd< int64_t, scalar, VectorSizeInBits >, Idof > {
+         using Vec = simd< int64_t, scalar, VectorSizeInBits >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Forms a vector mask register from the lower bits of an integral value (inverse of to_integral).
+    * @details todo.
+    * @param mask Integral value, bit i selects lane i.
+    * @return Vector mask register selecting the lanes whose bit is set.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::mask_type apply(
+            typename Vec::base_type  mask
+         ) {
+            typename Vec::mask_type result{ };
+            for( std::size_t i = 0; i < Vec::vector_element_count(); ++i ) {
+               result[ i ] = ( ( mask >> i ) & 1 ) ? -1 : 0;
+            }
+            return result;
+         }
+      };
+   } // end of namespace details for template specialization of from_integral_impl for scalar using int64_t.
+   
+   namespace details {
+      template< std::size_t VectorSizeInBits, ImplementationDegreeOfFreedom Idof >
+      struct leading_mask_impl< simd< int64_t, scalar, VectorSizeInBits >, Idof > {
+         using Vec = simd< int64_t, scalar, VectorSizeInBits >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Forms a vector mask register selecting the first lanes, e.g. for the ragged tail of a batch.
+    * @details todo.
+    * @param count Number of selected lanes, in [0, vector_element_count()].
+    * @return Vector mask register selecting the lanes [0, count).
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::mask_type apply(
+            int32_t  count
+         ) {
+            typename Vec::mask_type result{ };
+            for( std::size_t i = 0; i < Vec::vector_element_count(); ++i ) {
+               result[ i ] = static_cast< int32_t >( i ) < count ? -1 : 0;
+            }
+            return result;
+         }
+      };
+   } // end of namespace details for template specialization of leading_mask_impl for scalar using int64_t.
+   
+   namespace details {
+      template< std::size_t VectorSizeInBits, ImplementationDegreeOfFreedom Idof >
+      struct get_msb_impl< simd< int64_t, scalar, VectorSizeInBits >, Idof > {
+         using Vec = simd< int64_t, scalar, VectorSizeInBits >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Retrieves the most significant bit of every element in a vector register and sets the corresponding bit in a base type.
+    * @details todo.
+    * @param vec Vector mask register containing mask style data.
+    * @return Integral value representing the vector mask register.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::base_type apply(
+            typename Vec::register_type  vec
+         ) {
+            typename Vec::base_type result = 0;
+            for( std::size_t i = 0; i < Vec::vector_element_count(); ++i ) {
+               result |= ( ( static_cast< uint64_t >( vec[ i ] ) >> 63 ) << i );
+            }
+            return result;
+         }
+      };
+   } // end of namespace details for template specialization of get_msb_impl for scalar using int64_t.
+   
+   namespace details {
+      template< std::size_t VectorSizeInBits, ImplementationDegreeOfFreedom Idof >
+      struct to_vector_impl< simd< int64_t, scalar, VectorSizeInBits >, Idof > {
+         using Vec = simd< int64_t, scalar, VectorSizeInBits >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Forms an vector register from an integral where all bits are set in a lane if the corresponding mask bit is set to 1.
+    * @details todo.
+    * @param mask Vector mask register containing mask style data.
+    * @return Integral value representing the vector mask register.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::mask_type  mask
+         ) {return mask; //mask is a vector already.
+         }
+      };
+   } // end of namespace details for template specialization of to_vector_impl for scalar using int64_t.
+   
+   namespace details {
+      template< std::size_t VectorSizeInBits, ImplementationDegreeOfFreedom Idof >
+      struct mask_reduce_impl< simd< int64_t, scalar, VectorSizeInBits >, Idof > {
+         using Vec = simd< int64_t, scalar, VectorSizeInBits >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Masks out every non relevant bit.
+    * @details todo.
+    * @param mask Integral value containing n (set) bits.
+    * @return Integral value with only relevant bits set (or not).
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::base_type apply(
+            typename Vec::base_type  mask
+         ) {return mask & ( ( 1ULL << Vec::vector_element_count() ) - 1 );
+         }
+      };
+   } // end of namespace details for template specialization of mask_reduce_impl for scalar using int64_t.
+   
+   namespace details {
+      template< std::size_t VectorSizeInBits, ImplementationDegreeOfFreedom Idof >
+      struct mask_popcount_impl< simd< int64_t, scalar, VectorSizeInBits >, Idof > {
+         using Vec = simd< int64_t, scalar, VectorSizeInBits >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Counts the relevant set bits of an integral mask.
+    * @details todo.
+    * @param mask Integral value containing n (set) bits (see to_integral and get_msb).
+    * @return Number of lanes selected by mask.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::base_type apply(
+            typename Vec::base_type  mask
+         ) {return __builtin_popcountll( mask & ( ( 1ULL << Vec::vector_element_count() ) - 1 ) );
+         }
+      };
+   } // end of namespace details for template specialization of mask_popcount_impl for scalar using int64_t.
+   
+   namespace details {
+      template< std::size_t VectorSizeInBits, ImplementationDegreeOfFreedom Idof >
+      struct mask_lane_indices_impl< simd< int64_t, scalar, VectorSizeInBits >, Idof > {
+         using Vec = simd< int64_t, scalar, VectorSizeInBits >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Writes the indices of the lanes selected by an integral mask in ascending order.
+    * @details todo.
+    * @param mask Integral value containing n (set) bits (see to_integral and get_msb).
+    * @param indices Destination, must have room for Vec::vector_element_count() values. Entries past the returned count are unspecified.
+    * @return Number of indices written (same as mask_popcount).
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::base_type apply(
+            typename Vec::base_type  mask, 
+            int32_t *  indices
+         ) {
+            typename Vec::base_type count = 0;
+            for( uint64_t bits = mask & ( ( 1ULL << Vec::vector_element_count() ) - 1 ); bits != 0; bits &= bits - 1 ) {
+               indices[ count++ ] = __builtin_ctzll( bits );
+            }
+            return count;
+         }
+      };
+   } // end of namespace details for template specialization of mask_lane_indices_impl for scalar using int64_t.
+   
+} // end of namespace tvl
+
+#endif //TUD_D2RG_TVL_LIB_GENERATED_DEFINITIONS_MASK_MASK_SCALAR_HPP
\ No newline at end of file
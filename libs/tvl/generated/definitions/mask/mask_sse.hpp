@@ -48,6 +48,52 @@ namespace tvl {
       };
    } // end of namespace details for template specialization of to_integral_impl for sse using int64_t.
    
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct from_integral_impl< simd< int64_t, sse  >, Idof > {
+         using Vec = simd< int64_t, sse  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Forms a vector mask register from the lower bits of an integral value (inverse of to_integral).
+    * @details todo.
+    * @param mask Integral value, bit i selects lane i.
+    * @return Vector mask register selecting the lanes whose bit is set.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::mask_type apply(
+            typename Vec::base_type  mask
+         ) {
+            auto const lane_bits = _mm_set_epi64x( 2, 1 );
+            return _mm_cmpeq_epi64( _mm_and_si128( _mm_set1_epi64x( mask ), lane_bits ), lane_bits );
+         }
+      };
+   } // end of namespace details for template specialization of from_integral_impl for sse using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct leading_mask_impl< simd< int64_t, sse  >, Idof > {
+         using Vec = simd< int64_t, sse  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Forms a vector mask register selecting the first lanes, e.g. for the ragged tail of a batch.
+    * @details todo.
+    * @param count Number of selected lanes, in [0, vector_element_count()].
+    * @return Vector mask register selecting the lanes [0, count).
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::mask_type apply(
+            int32_t  count
+         ) {
+            static constexpr int64_t kLeading[ 4 ] = { -1, -1, 0, 0 };
+            return _mm_loadu_si128( reinterpret_cast< __m128i const * >( kLeading + 2 - count ) );
+         }
+      };
+   } // end of namespace details for template specialization of leading_mask_impl for sse using int64_t.
+   
    namespace details {
       template< ImplementationDegreeOfFreedom Idof >
       struct get_msb_impl< simd< int64_t, sse  >, Idof > {
@@ -111,6 +157,58 @@ namespace tvl {
       };
    } // end of namespace details for template specialization of mask_reduce_impl for sse using int64_t.
    
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct mask_popcount_impl< simd< int64_t, sse  >, Idof > {
+         using Vec = simd< int64_t, sse  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Counts the relevant set bits of an integral mask.
+    * @details todo.
+    * @param mask Integral value containing n (set) bits (see to_integral and get_msb).
+    * @return Number of lanes selected by mask.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::base_type apply(
+            typename Vec::base_type  mask
+         ) {return _mm_popcnt_u32( mask & 0x3 );
+         }
+      };
+   } // end of namespace details for template specialization of mask_popcount_impl for sse using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct mask_lane_indices_impl< simd< int64_t, sse  >, Idof > {
+         using Vec = simd< int64_t, sse  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Writes the indices of the lanes selected by an integral mask in ascending order.
+    * @details todo.
+    * @param mask Integral value containing n (set) bits (see to_integral and get_msb).
+    * @param indices Destination, must have room for Vec::vector_element_count() values. Entries past the returned count are unspecified.
+    * @return Number of indices written (same as mask_popcount).
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::base_type apply(
+            typename Vec::base_type  mask, 
+            int32_t *  indices
+         ) {
+            alignas( 8 ) static constexpr int32_t kLanes[ 4 ][ 2 ] = {
+               { 0, 0 },
+               { 0, 0 },
+               { 1, 0 },
+               { 0, 1 }
+            };
+            _mm_storel_epi64( reinterpret_cast< __m128i * >( indices ), _mm_loadl_epi64( reinterpret_cast< __m128i const * >( kLanes[ mask & 0x3 ] ) ) );
+            return _mm_popcnt_u32( mask & 0x3 );
+         }
+      };
+   } // end of namespace details for template specialization of mask_lane_indices_impl for sse using int64_t.
+   
 } // end of namespace tvl
 
 #endif //TUD_D2RG_TVL_LIB_GENERATED_DEFINITIONS_MASK_MASK_SSE_HPP
\ No newline at end of file
@@ -0,0 +1,138 @@
+/**********************************************************************************************
+ * This file is part of the TVL Project.                                                      *
+ * Copyright (C) 2022 by TVL-Team                                                             *
+ *                                                                                            *
+ * This file is part of TVL - a template simd library.                                        *
+ *                                                                                            *
+ * This program is free software: you can redistribute it and/or modify it under the          *
+ * terms of the GNU General Public License as published by the Free Software Foundation,      *
+ * either version 3 of the License, or (at your option) any later version.                    *
+ *                                                                                            *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;  *
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  *
+ * See the GNU General Public License for more details.                                       *
+ *                                                                                            *
+ * You should have received a copy of the GNU General Public License along with this program. *
+ * If not, see <http://www.gnu.org/licenses/>.                                                *
+ **********************************************************************************************/
+ //todo: Apache2
+/*
+ * @file lib/generated/definitions/permute/permute_avx2.hpp
+ * @date 17.02.2022
+ * @brief Permutation and lookup primitives. Implementation for avx2
+ */
+#ifndef TUD_D2RG_TVL_LIB_GENERATED_DEFINITIONS_PERMUTE_PERMUTE_AVX2_HPP
+#define TUD_D2RG_TVL_LIB_GENERATED_DEFINITIONS_PERMUTE_PERMUTE_AVX2_HPP
+
+#include "../../declarations/permute.hpp"
+
+namespace tvl {
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct permute_impl< simd< int64_t, avx2  >, Idof > {
+         using Vec = simd< int64_t, avx2  >;
+         static constexpr bool native_supported() {
+            return false;
+         }
+   /*
+    * @brief Rearranges the lanes of a vector register.
+    * @details todo.
+    * @param vec Vector containing the values.
+    * @param indices Source lane for every result lane (only the lower log2( vector_element_count() ) bits are used).
+    * @return Vector containing vec[ indices[*] ].
+    */
+         [[nodiscard]] TVL_NO_NATIVE_SUPPORT_WARNING
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec, 
+            typename Vec::register_type  indices
+         ) {
+            static_assert( !std::is_same_v< Idof, native >, "The primitive permute is not supported by your hardware natively while it is forced by using native" );
+            auto const doubled = _mm256_slli_epi64( _mm256_and_si256( indices, _mm256_set1_epi64x( 3 ) ), 1 );
+            auto const halves = _mm256_or_si256( doubled, _mm256_slli_epi64( _mm256_add_epi64( doubled, _mm256_set1_epi64x( 1 ) ), 32 ) );
+            return _mm256_permutevar8x32_epi32( vec, halves );
+         }
+      };
+   } // end of namespace details for template specialization of permute_impl for avx2 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct permute2_impl< simd< int64_t, avx2  >, Idof > {
+         using Vec = simd< int64_t, avx2  >;
+         static constexpr bool native_supported() {
+            return false;
+         }
+   /*
+    * @brief Selects lanes from the concatenation of two vector registers.
+    * @details todo.
+    * @param vec_a Vector containing the lanes [0, vector_element_count()).
+    * @param vec_b Vector containing the lanes [vector_element_count(), 2 * vector_element_count()).
+    * @param indices Source lane for every result lane (only the lower log2( vector_element_count() ) + 1 bits are used).
+    * @return Vector containing { vec_a, vec_b }[ indices[*] ].
+    */
+         [[nodiscard]] TVL_NO_NATIVE_SUPPORT_WARNING
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec_a, 
+            typename Vec::register_type  vec_b, 
+            typename Vec::register_type  indices
+         ) {
+            static_assert( !std::is_same_v< Idof, native >, "The primitive permute2 is not supported by your hardware natively while it is forced by using native" );
+            auto const from_b = _mm256_cmpeq_epi64( _mm256_and_si256( indices, _mm256_set1_epi64x( 4 ) ), _mm256_set1_epi64x( 4 ) );
+            return _mm256_blendv_epi8( tvl::permute< Vec >( vec_a, indices ), tvl::permute< Vec >( vec_b, indices ), from_b );
+         }
+      };
+   } // end of namespace details for template specialization of permute2_impl for avx2 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct lookup_bytes_impl< simd< int64_t, avx2  >, Idof > {
+         using Vec = simd< int64_t, avx2  >;
+         static constexpr bool native_supported() {
+            return false;
+         }
+   /*
+    * @brief Looks up every byte of indices in a table held in one vector register.
+    * @details todo.
+    * @param table Table of vector_size_B() bytes.
+    * @param indices Byte indices into table (only the lower log2( vector_size_B() ) bits are used).
+    * @return Register containing the bytes table[ indices[*] ].
+    */
+         [[nodiscard]] TVL_NO_NATIVE_SUPPORT_WARNING
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  table, 
+            typename Vec::register_type  indices
+         ) {
+            static_assert( !std::is_same_v< Idof, native >, "The primitive lookup_bytes is not supported by your hardware natively while it is forced by using native" );
+            auto const selectors = _mm256_and_si256( indices, _mm256_set1_epi8( 0x1F ) );
+            auto const low = _mm256_shuffle_epi8( _mm256_permute2x128_si256( table, table, 0x00 ), selectors );
+            auto const high = _mm256_shuffle_epi8( _mm256_permute2x128_si256( table, table, 0x11 ), selectors );
+            return _mm256_blendv_epi8( low, high, _mm256_slli_epi16( selectors, 3 ) );
+         }
+      };
+   } // end of namespace details for template specialization of lookup_bytes_impl for avx2 using int64_t.
+   
+   namespace details {
+      template< ImplementationDegreeOfFreedom Idof >
+      struct shuffle_bytes_impl< simd< int64_t, avx2  >, Idof > {
+         using Vec = simd< int64_t, avx2  >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Shuffles the bytes within every 128 bit lane of a vector register (pshufb semantics).
+    * @details todo.
+    * @param vec Vector containing the bytes.
+    * @param indices Byte index within the same 128 bit lane, the result byte is zero if bit 7 is set.
+    * @return Register containing the shuffled bytes.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec, 
+            typename Vec::register_type  indices
+         ) {return _mm256_shuffle_epi8( vec, indices );
+         }
+      };
+   } // end of namespace details for template specialization of shuffle_bytes_impl for avx2 using int64_t.
+   
+} // end of namespace tvl
+
+#endif //TUD_D2RG_TVL_LIB_GENERATED_DEFINITIONS_PERMUTE_PERMUTE_AVX2_HPP
\ No newline at end of file
@@ -0,0 +1,153 @@
+/**********************************************************************************************
+ * This file is part of the TVL Project.                                                      *
+ * Copyright (C) 2022 by TVL-Team                                                             *
+ *                                                                                            *
+ * This file is part of TVL - a template simd library.                                        *
+ *                                                                                            *
+ * This program is free software: you can redistribute it and/or modify it under the          *
+ * terms of the GNU General Public License as published by the Free Software Foundation,      *
+ * either version 3 of the License, or (at your option) any later version.                    *
+ *                                                                                            *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;  *
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  *
+ * See the GNU General Public License for more details.                                       *
+ *                                                                                            *
+ * You should have received a copy of the GNU General Public License along with this program. *
+ * If not, see <http://www.gnu.org/licenses/>.                                                *
+ **********************************************************************************************/
+ //todo: Apache2
+/*
+ * @file lib/generated/definitions/permute/permute_scalar.hpp
+ * @date 17.02.2022
+ * @brief Permutation and lookup primitives. Implementation for scalar
+ */
+#ifndef TUD_D2RG_TVL_LIB_GENERATED_DEFINITIONS_PERMUTE_PERMUTE_SCALAR_HPP
+#define TUD_D2RG_TVL_LIB_GENERATED_DEFINITIONS_PERMUTE_PERMUTE_SCALAR_HPP
+
+#include "../../declarations/permute.hpp"
+
+namespace tvl {
+   namespace details {
+      template< std::size_t VectorSizeInBits, ImplementationDegreeOfFreedom Idof >
+      struct permute_impl< simd< int64_t, scalar, VectorSizeInBits >, Idof > {
+         using Vec = simd< int64_t, scalar, VectorSizeInBits >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Rearranges the lanes of a vector register.
+    * @details todo.
+    * @param vec Vector containing the values.
+    * @param indices Source lane for every result lane (only the lower log2( vector_element_count() ) bits are used).
+    * @return Vector containing vec[ indices[*] ].
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec, 
+            typename Vec::register_type  indices
+         ) {
+            typename Vec::register_type result{ };
+            for( std::size_t i = 0; i < Vec::vector_element_count(); ++i ) {
+               result[ i ] = vec[ indices[ i ] & ( Vec::vector_element_count() - 1 ) ];
+            }
+            return result;
+         }
+      };
+   } // end of namespace details for template specialization of permute_impl for scalar using int64_t.
+   
+   namespace details {
+      template< std::size_t VectorSizeInBits, ImplementationDegreeOfFreedom Idof >
+      struct permute2_impl< simd< int64_t, scalar, VectorSizeInBits >, Idof > {
+         using Vec = simd< int64_t, scalar, VectorSizeInBits >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Selects lanes from the concatenation of two vector registers.
+    * @details todo.
+    * @param vec_a Vector containing the lanes [0, vector_element_count()).
+    * @param vec_b Vector containing the lanes [vector_element_count(), 2 * vector_element_count()).
+    * @param indices Source lane for every result lane (only the lower log2( vector_element_count() ) + 1 bits are used).
+    * @return Vector containing { vec_a, vec_b }[ indices[*] ].
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec_a, 
+            typename Vec::register_type  vec_b, 
+            typename Vec::register_type  indices
+         ) {
+            typename Vec::register_type result{ };
+            for( std::size_t i = 0; i < Vec::vector_element_count(); ++i ) {
+               auto const index = indices[ i ] & ( 2 * Vec::vector_element_count() - 1 );
+               result[ i ] = index < Vec::vector_element_count() ? vec_a[ index ] : vec_b[ index - Vec::vector_element_count() ];
+            }
+            return result;
+         }
+      };
+   } // end of namespace details for template specialization of permute2_impl for scalar using int64_t.
+   
+   namespace details {
+      template< std::size_t VectorSizeInBits, ImplementationDegreeOfFreedom Idof >
+      struct lookup_bytes_impl< simd< int64_t, scalar, VectorSizeInBits >, Idof > {
+         using Vec = simd< int64_t, scalar, VectorSizeInBits >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Looks up every byte of indices in a table held in one vector register.
+    * @details todo.
+    * @param table Table of vector_size_B() bytes.
+    * @param indices Byte indices into table (only the lower log2( vector_size_B() ) bits are used).
+    * @return Register containing the bytes table[ indices[*] ].
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  table, 
+            typename Vec::register_type  indices
+         ) {
+            typename Vec::register_type result{ };
+            auto const * bytes = reinterpret_cast< uint8_t const * >( &table );
+            auto const * selectors = reinterpret_cast< uint8_t const * >( &indices );
+            auto * out = reinterpret_cast< uint8_t * >( &result );
+            for( std::size_t i = 0; i < Vec::vector_size_B(); ++i ) {
+               out[ i ] = bytes[ selectors[ i ] & ( Vec::vector_size_B() - 1 ) ];
+            }
+            return result;
+         }
+      };
+   } // end of namespace details for template specialization of lookup_bytes_impl for scalar using int64_t.
+   
+   namespace details {
+      template< std::size_t VectorSizeInBits, ImplementationDegreeOfFreedom Idof >
+      struct shuffle_bytes_impl< simd< int64_t, scalar, VectorSizeInBits >, Idof > {
+         using Vec = simd< int64_t, scalar, VectorSizeInBits >;
+         static constexpr bool native_supported() {
+            return true;
+         }
+   /*
+    * @brief Shuffles the bytes within every 128 bit lane of a vector register (pshufb semantics).
+    * @details todo.
+    * @param vec Vector containing the bytes.
+    * @param indices Byte index within the same 128 bit lane, the result byte is zero if bit 7 is set.
+    * @return Register containing the shuffled bytes.
+    */
+         [[nodiscard]] 
+         TVL_FORCE_INLINE static typename Vec::register_type apply(
+            typename Vec::register_type  vec, 
+            typename Vec::register_type  indices
+         ) {
+            typename Vec::register_type result{ };
+            auto const * bytes = reinterpret_cast< uint8_t const * >( &vec );
+            auto const * selectors = reinterpret_cast< uint8_t const * >( &indices );
+            auto * out = reinterpret_cast< uint8_t * >( &result );
+            for( std::size_t i = 0; i < Vec::vector_size_B(); ++i ) {
+               out[ i ] = ( selectors[ i ] & 0x80 ) ? 0 : bytes[ ( i & ~std::size_t{ 15 } ) | ( selectors[ i ] & 0x0F ) ];
+            }
+            return result;
+         }
+      };
+   } // end of namespace details for template specialization of shuffle_bytes_impl for scalar using int64_t.
+   
+} // end of namespace tvl
+
+#endif //TUD_D2RG_TVL_LIB_GENERATED_DEFINITIONS_PERMUTE_PERMUTE_SCALAR_HPP
\ No newline at end of file
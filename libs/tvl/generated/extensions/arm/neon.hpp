@@ -25,6 +25,7 @@
 #define TUD_D2RG_TVL_LIB_GENERATED_EXTENSIONS_ARM_NEON_HPP
 
 #include <arm_neon.h>
+#include <arm_acle.h>
 
 namespace tvl {
    struct neon {
@@ -33,17 +33,7 @@ namespace tvl {
       struct types {
          using register_t __attribute__ ((
             __vector_size__ (
-               VectorSizeInBits/sizeof(
-                  TVL_DEP_TYPE(
-                     (std::is_integral_v< BaseType >),
-                     long long,
-                     TVL_DEP_TYPE(
-                        (sizeof( BaseType ) == 4),
-                        float,
-                        double
-                     )
-                  )
-               )
+               VectorSizeInBits/8
             ), 
             __may_alias__, 
             __aligned__(VectorSizeInBits/sizeof(char))
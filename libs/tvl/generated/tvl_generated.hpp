@@ -24,25 +24,53 @@
 #ifndef TUD_D2RG_TVL_LIB_GENERATED_TVL_GENERATED_HPP
 #define TUD_D2RG_TVL_LIB_GENERATED_TVL_GENERATED_HPP
 
+#include "extensions/generic/scalar.hpp"
+#include "definitions/compare/compare_scalar.hpp"
+#include "definitions/mask/mask_scalar.hpp"
+#include "definitions/calc/calc_scalar.hpp"
+#include "definitions/bits/bits_scalar.hpp"
+#include "definitions/io/io_scalar.hpp"
+#include "definitions/convert/convert_scalar.hpp"
+#include "definitions/permute/permute_scalar.hpp"
+#include "definitions/hash/hash_scalar.hpp"
 #ifdef NEON
 #include "extensions/arm/neon.hpp"
 #include "definitions/compare/compare_neon.hpp"
 #include "definitions/mask/mask_neon.hpp"
+#include "definitions/calc/calc_neon.hpp"
+#include "definitions/bits/bits_neon.hpp"
 #include "definitions/io/io_neon.hpp"
+#include "definitions/convert/convert_neon.hpp"
+#include "definitions/permute/permute_neon.hpp"
+#include "definitions/hash/hash_neon.hpp"
 #else
 #include "extensions/intel/sse.hpp"
 #include "extensions/intel/avx2.hpp"
 #include "extensions/intel/avx512.hpp"
-#include "definitions/compare/compare_avx512.hpp"
-#include "definitions/compare/compare_avx2.hpp"
 #include "definitions/compare/compare_sse.hpp"
-#include "definitions/mask/mask_avx512.hpp"
-#include "definitions/mask/mask_avx2.hpp"
+#include "definitions/compare/compare_avx2.hpp"
+#include "definitions/compare/compare_avx512.hpp"
 #include "definitions/mask/mask_sse.hpp"
+#include "definitions/mask/mask_avx2.hpp"
+#include "definitions/mask/mask_avx512.hpp"
+#include "definitions/calc/calc_sse.hpp"
+#include "definitions/calc/calc_avx2.hpp"
 #include "definitions/calc/calc_avx512.hpp"
-#include "definitions/io/io_avx512.hpp"
-#include "definitions/io/io_avx2.hpp"
+#include "definitions/bits/bits_sse.hpp"
+#include "definitions/bits/bits_avx2.hpp"
+#include "definitions/bits/bits_avx512.hpp"
 #include "definitions/io/io_sse.hpp"
+#include "definitions/io/io_avx2.hpp"
+#include "definitions/io/io_avx512.hpp"
+#include "definitions/convert/convert_sse.hpp"
+#include "definitions/convert/convert_avx2.hpp"
+#include "definitions/convert/convert_avx512.hpp"
+#include "definitions/permute/permute_sse.hpp"
+#include "definitions/permute/permute_avx2.hpp"
+#include "definitions/permute/permute_avx512.hpp"
+#include "definitions/hash/hash_sse.hpp"
+#include "definitions/hash/hash_avx2.hpp"
+#include "definitions/hash/hash_avx512.hpp"
 #endif
 
 #endif //TUD_D2RG_TVL_LIB_GENERATED_TVL_GENERATED_HPP
\ No newline at end of file
@@ -0,0 +1,145 @@
+"""Target extensions. Spec consumed by tvl_generator.py.
+
+platform selects the block in tvl_generated.hpp: generic is always included,
+arm under NEON and intel otherwise."""
+
+extensions = [
+   {
+      "name": "scalar",
+      "family": "generic",
+      "platform": "generic",
+      "includes": [ "<cstddef>", "<cstdint>", "<type_traits>" ],
+      "default_size": "64",
+      "register_attributes": """__attribute__ ((
+            __vector_size__ (
+               VectorSizeInBits/8
+            ), 
+            __may_alias__, 
+            __aligned__(VectorSizeInBits/8)
+            ))""",
+      "register_type": "BaseType",
+      "mask_type": "register_t",
+   },
+   {
+      "name": "neon",
+      "family": "arm",
+      "platform": "arm",
+      "includes": [ "<arm_neon.h>", "<arm_acle.h>" ],
+      "default_size": "128",
+      "register_attributes": "",
+      "register_type": """TVL_DEP_TYPE(
+               (std::is_integral_v< BaseType >),
+               int64x2_t,
+               TVL_DEP_TYPE(
+                  (sizeof( BaseType ) == 4),
+                  float32x4_t,
+                  float64x2_t
+               )
+            )""",
+      "mask_type": "uint64x2_t",
+   },
+   {
+      "name": "sse",
+      "family": "intel",
+      "platform": "intel",
+      "includes": [ '"immintrin.h"' ],
+      "default_size": "128",
+      "register_attributes": """__attribute__ ((
+            __vector_size__ (
+               VectorSizeInBits/8
+            ), 
+            __may_alias__, 
+            __aligned__(VectorSizeInBits/sizeof(char))
+            ))""",
+      "register_type": """TVL_DEP_TYPE(
+               (std::is_integral_v< BaseType >),
+               long long,
+               TVL_DEP_TYPE(
+                  (sizeof( BaseType ) == 4),
+                  float,
+                  double
+               )
+            )""",
+      "mask_type": "register_t",
+   },
+   {
+      "name": "avx2",
+      "family": "intel",
+      "platform": "intel",
+      "includes": [ '"immintrin.h"' ],
+      "default_size": "256",
+      "register_attributes": """__attribute__ ((
+            __vector_size__ (
+               VectorSizeInBits/8
+            ), 
+            __may_alias__, 
+            __aligned__(VectorSizeInBits/sizeof(char))
+            ))""",
+      "register_type": """TVL_DEP_TYPE(
+               (std::is_integral_v< BaseType >),
+               long long,
+               TVL_DEP_TYPE(
+                  (sizeof( BaseType ) == 4),
+                  float,
+                  double
+               )
+            )""",
+      "mask_type": "register_t",
+   },
+   {
+      "name": "avx512",
+      "family": "intel",
+      "platform": "intel",
+      "includes": [ '"immintrin.h"' ],
+      "default_size": "512",
+      "register_attributes": """__attribute__ ((
+            __vector_size__ (
+               VectorSizeInBits/8
+            ), 
+            __may_alias__, 
+            __aligned__(VectorSizeInBits/sizeof(char))
+            ))""",
+      "register_type": """TVL_DEP_TYPE(
+               (std::is_integral_v< BaseType >),
+               long long,
+               TVL_DEP_TYPE(
+                  (sizeof( BaseType ) == 4),
+                  float,
+                  double
+               )
+            )""",
+      "mask_type": """TVL_DEP_TYPE(
+            ( VectorSizeInBits == 512 ),
+            TVL_DEP_TYPE(
+               ( sizeof( register_t ) / sizeof( BaseType ) ) == 64,
+               __mmask64,
+               TVL_DEP_TYPE(
+                  ( sizeof( register_t ) / sizeof( BaseType ) ) == 32,
+                  __mmask32,
+                  TVL_DEP_TYPE(
+                     ( sizeof( register_t ) / sizeof( BaseType ) ) == 16,
+                     __mmask16,
+                     __mmask8
+                  )
+               )
+            ),
+            TVL_DEP_TYPE(
+               ( VectorSizeInBits == 256 ),
+               TVL_DEP_TYPE(
+                  ( sizeof( register_t ) / sizeof( BaseType ) ) == 32,
+                  __mmask32,
+                  TVL_DEP_TYPE(
+                     ( sizeof( register_t ) / sizeof( BaseType ) ) == 16,
+                     __mmask16,
+                     __mmask8
+                  )
+               ),
+               TVL_DEP_TYPE(
+                  ( sizeof( register_t ) / sizeof( BaseType ) ) == 16,
+                  __mmask16,
+                  __mmask8
+               )
+            )
+         )""",
+   },
+]
@@ -0,0 +1,222 @@
+"""Bit counting and bit position primitives. Spec consumed by ../tvl_generator.py."""
+brief = "Bit counting and bit position primitives."
+
+# The scalar backend is specialized for every vector size.
+SCALAR = { "extension": "scalar", "vector_size": "VectorSizeInBits", "template_parameters": "std::size_t VectorSizeInBits" }
+SCALAR_LANES = """typename Vec::register_type result{ };
+for( std::size_t i = 0; i < Vec::vector_element_count(); ++i ) {
+   result[ i ] = %s;
+}
+return result;"""
+# Per-byte popcount through a nibble lookup table (pshufb), summed up per lane by psadbw.
+POPCOUNT_NIBBLES = """auto const lookup = {lookup};
+auto const low_nibbles = {p}_set1_epi8( 0x0F );
+auto const counts = {p}_add_epi8(
+   {p}_shuffle_epi8( lookup, {p}_and_{si}( vec, low_nibbles ) ),
+   {p}_shuffle_epi8( lookup, {p}_and_{si}( {p}_srli_epi16( vec, 4 ), low_nibbles ) )
+);
+return {p}_sad_epu8( counts, {p}_setzero_{si}( ) );"""
+NIBBLE_COUNTS = "_mm_setr_epi8( 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4 )"
+# Without a native per lane instruction the leading zeros are 64 - popcount of the value with
+# every bit below the highest set bit set, the trailing zeros are popcount( ~x & ( x - 1 ) ).
+LZCNT_SMEAR = """auto smeared = vec;
+for( int shift = 1; shift < 64; shift <<= 1 ) {{
+   smeared = {p}_or_{si}( smeared, {p}_srli_epi64( smeared, shift ) );
+}}
+return {p}_sub_epi64( {p}_set1_epi64x( 64 ), tvl::popcount< Vec >( smeared ) );"""
+TZCNT_POPCOUNT = "return tvl::popcount< Vec >( {p}_andnot_{si}( vec, {p}_sub_epi64( vec, {p}_set1_epi64x( 1 ) ) ) );"
+
+# Positions of the set bits of every byte, 8 entries per byte padded with zeros.
+BYTE_POSITIONS = """struct Positions {
+   int32_t rows[ 256 ][ 8 ];
+};
+alignas( 64 ) static constexpr Positions kPositions = [ ]( ) {
+   Positions table{ };
+   for( int byte = 0; byte < 256; ++byte ) {
+      int count = 0;
+      for( int bit = 0; bit < 8; ++bit ) {
+         if( byte & ( 1 << bit ) ) {
+            table.rows[ byte ][ count++ ] = bit;
+         }
+      }
+   }
+   return table;
+}( );
+int32_t const low_count = __builtin_popcount( bits & 0xFF );
+"""
+# One 8 x 32 bit register per byte.
+BIT_INDICES_AVX2 = BYTE_POSITIONS + """auto const row = [ & ]( uint32_t byte, int32_t offset ) {
+   return _mm256_add_epi32( _mm256_load_si256( reinterpret_cast< __m256i const * >( kPositions.rows[ byte ] ) ), _mm256_set1_epi32( offset ) );
+};
+_mm256_storeu_si256( reinterpret_cast< __m256i * >( indices ), row( bits & 0xFF, base ) );
+_mm256_storeu_si256( reinterpret_cast< __m256i * >( indices + low_count ), row( ( bits >> 8 ) & 0xFF, base + 8 ) );
+return low_count + __builtin_popcount( bits & 0xFF00 );"""
+BIT_INDICES_SSE = BYTE_POSITIONS + """auto const store = [ & ]( uint32_t byte, int32_t offset, int32_t * out ) {
+   auto const add = _mm_set1_epi32( offset );
+   auto const * row = reinterpret_cast< __m128i const * >( kPositions.rows[ byte ] );
+   _mm_storeu_si128( reinterpret_cast< __m128i * >( out ), _mm_add_epi32( _mm_load_si128( row ), add ) );
+   _mm_storeu_si128( reinterpret_cast< __m128i * >( out + 4 ), _mm_add_epi32( _mm_load_si128( row + 1 ), add ) );
+};
+store( bits & 0xFF, base, indices );
+store( ( bits >> 8 ) & 0xFF, base + 8, indices + low_count );
+return low_count + __builtin_popcount( bits & 0xFF00 );"""
+BIT_INDICES_NEON = BYTE_POSITIONS + """auto const store = [ & ]( uint32_t byte, int32_t offset, int32_t * out ) {
+   auto const add = vdupq_n_s32( offset );
+   vst1q_s32( out, vaddq_s32( vld1q_s32( kPositions.rows[ byte ] ), add ) );
+   vst1q_s32( out + 4, vaddq_s32( vld1q_s32( kPositions.rows[ byte ] + 4 ), add ) );
+};
+store( bits & 0xFF, base, indices );
+store( ( bits >> 8 ) & 0xFF, base + 8, indices + low_count );
+return low_count + __builtin_popcount( bits & 0xFF00 );"""
+# Every byte of the mask takes the next popcount( byte ) source bits. Row 'byte' holds the bit
+# each source bit is deposited to, 8 entries per byte padded with zeros, so the deposited byte is
+# the sum of the entries whose source bit is set.
+BYTE_DEPOSITS = """struct Deposits {{
+   uint8_t rows[ 256 ][ 8 ];
+}};
+alignas( 64 ) static constexpr Deposits kDeposits = [ ]( ) {{
+   Deposits table{{ }};
+   for( int byte = 0; byte < 256; ++byte ) {{
+      int count = 0;
+      for( int bit = 0; bit < 8; ++bit ) {{
+         if( byte & ( 1 << bit ) ) {{
+            table.rows[ byte ][ count++ ] = 1 << bit;
+         }}
+      }}
+   }}
+   return table;
+}}( );
+uint64_t result = 0;
+uint64_t remaining = source;
+for( int shift = 0; shift < 64; shift += 8 ) {{
+   auto const byte = ( mask >> shift ) & 0xFF;
+{deposit}
+   result |= static_cast< uint64_t >( deposited ) << shift;
+   remaining >>= __builtin_popcountll( byte );
+}}
+return result;"""
+DEPOSIT_BITS_SSE = BYTE_DEPOSITS.format( deposit = """   auto const lanes = _mm_set1_epi64x( 0x8040201008040201LL );
+   auto const selected = _mm_cmpeq_epi8( _mm_and_si128( _mm_set1_epi8( static_cast< char >( remaining ) ), lanes ), lanes );
+   auto const row = _mm_loadl_epi64( reinterpret_cast< __m128i const * >( kDeposits.rows[ byte ] ) );
+   auto const deposited = _mm_cvtsi128_si32( _mm_sad_epu8( _mm_and_si128( row, selected ), _mm_setzero_si128( ) ) );""" )
+DEPOSIT_BITS_NEON = BYTE_DEPOSITS.format( deposit = """   auto const selected = vtst_u8( vdup_n_u8( static_cast< uint8_t >( remaining ) ), vcreate_u8( 0x8040201008040201ULL ) );
+   auto const deposited = vaddv_u8( vand_u8( vld1_u8( kDeposits.rows[ byte ] ), selected ) );""" )
+
+primitives = [
+   {
+      "name": "popcount",
+      "brief": "Counts the set bits of every lane.",
+      "parameters": [
+         ( "typename Vec::register_type", "vec", "Vector containing the values." ),
+      ],
+      "return_type": "typename Vec::register_type",
+      "return_doc": "Vector containing popcount( vec[*] ).",
+      "definitions": [
+         { **SCALAR, "ctype": "int64_t", "body": SCALAR_LANES % "__builtin_popcountll( vec[ i ] )" },
+         { "extension": "neon", "ctype": "int64_t", "body": "return vreinterpretq_s64_u64( vpaddlq_u32( vpaddlq_u16( vpaddlq_u8( vcntq_u8( vreinterpretq_u8_s64( vec ) ) ) ) ) );" },
+         { "extension": "sse", "ctype": "int64_t", "native": False, "body": POPCOUNT_NIBBLES.format( p = "_mm", si = "si128", lookup = NIBBLE_COUNTS ) },
+         { "extension": "avx2", "ctype": "int64_t", "native": False, "body": POPCOUNT_NIBBLES.format( p = "_mm256", si = "si256", lookup = "_mm256_broadcastsi128_si256( %s )" % NIBBLE_COUNTS ) },
+         { "extension": "avx512", "ctype": "int64_t", "native": False, "body": "#ifdef __AVX512VPOPCNTDQ__\nreturn _mm512_popcnt_epi64( vec );\n#else\n" + POPCOUNT_NIBBLES.format( p = "_mm512", si = "si512", lookup = "_mm512_broadcast_i32x4( %s )" % NIBBLE_COUNTS ) + "\n#endif" },
+         { "extension": "avx512", "ctype": "int64_t", "vector_size": "256", "native": False, "body": "#ifdef __AVX512VPOPCNTDQ__\nreturn _mm256_popcnt_epi64( vec );\n#else\n" + POPCOUNT_NIBBLES.format( p = "_mm256", si = "si256", lookup = "_mm256_broadcastsi128_si256( %s )" % NIBBLE_COUNTS ) + "\n#endif" },
+      ],
+   },
+   {
+      "name": "lzcnt",
+      "brief": "Counts the leading zero bits of every lane.",
+      "parameters": [
+         ( "typename Vec::register_type", "vec", "Vector containing the values." ),
+      ],
+      "return_type": "typename Vec::register_type",
+      "return_doc": "Vector containing the number of leading zeros of vec[*] (64 for 0).",
+      "definitions": [
+         { **SCALAR, "ctype": "int64_t", "body": SCALAR_LANES % "vec[ i ] == 0 ? 64 : __builtin_clzll( vec[ i ] )" },
+         { "extension": "neon", "ctype": "int64_t", "native": False, "body": """auto smeared = vreinterpretq_u64_s64( vec );
+smeared = vorrq_u64( smeared, vshrq_n_u64( smeared, 1 ) );
+smeared = vorrq_u64( smeared, vshrq_n_u64( smeared, 2 ) );
+smeared = vorrq_u64( smeared, vshrq_n_u64( smeared, 4 ) );
+smeared = vorrq_u64( smeared, vshrq_n_u64( smeared, 8 ) );
+smeared = vorrq_u64( smeared, vshrq_n_u64( smeared, 16 ) );
+smeared = vorrq_u64( smeared, vshrq_n_u64( smeared, 32 ) );
+return vsubq_s64( vdupq_n_s64( 64 ), tvl::popcount< Vec >( vreinterpretq_s64_u64( smeared ) ) );""" },
+         { "extension": "sse", "ctype": "int64_t", "native": False, "body": LZCNT_SMEAR.format( p = "_mm", si = "si128" ) },
+         { "extension": "avx2", "ctype": "int64_t", "native": False, "body": LZCNT_SMEAR.format( p = "_mm256", si = "si256" ) },
+         { "extension": "avx512", "ctype": "int64_t", "body": "return _mm512_lzcnt_epi64( vec );" },
+         { "extension": "avx512", "ctype": "int64_t", "vector_size": "256", "body": "return _mm256_lzcnt_epi64( vec );" },
+      ],
+   },
+   {
+      "name": "tzcnt",
+      "brief": "Counts the trailing zero bits of every lane.",
+      "parameters": [
+         ( "typename Vec::register_type", "vec", "Vector containing the values." ),
+      ],
+      "return_type": "typename Vec::register_type",
+      "return_doc": "Vector containing the number of trailing zeros of vec[*] (64 for 0).",
+      "definitions": [
+         { **SCALAR, "ctype": "int64_t", "body": SCALAR_LANES % "vec[ i ] == 0 ? 64 : __builtin_ctzll( vec[ i ] )" },
+         { "extension": "neon", "ctype": "int64_t", "native": False, "body": "return tvl::popcount< Vec >( vbicq_s64( vsubq_s64( vec, vdupq_n_s64( 1 ) ), vec ) );" },
+         { "extension": "sse", "ctype": "int64_t", "native": False, "body": TZCNT_POPCOUNT.format( p = "_mm", si = "si128" ) },
+         { "extension": "avx2", "ctype": "int64_t", "native": False, "body": TZCNT_POPCOUNT.format( p = "_mm256", si = "si256" ) },
+         # 64 - lzcnt( ~x & ( x - 1 ) ), lzcnt is native with AVX512CD while popcount needs AVX512VPOPCNTDQ.
+         { "extension": "avx512", "ctype": "int64_t", "native": False, "body": "return _mm512_sub_epi64( _mm512_set1_epi64( 64 ), _mm512_lzcnt_epi64( _mm512_andnot_si512( vec, _mm512_sub_epi64( vec, _mm512_set1_epi64( 1 ) ) ) ) );" },
+         { "extension": "avx512", "ctype": "int64_t", "vector_size": "256", "native": False, "body": "return _mm256_sub_epi64( _mm256_set1_epi64x( 64 ), _mm256_lzcnt_epi64( _mm256_andnot_si256( vec, _mm256_sub_epi64( vec, _mm256_set1_epi64x( 1 ) ) ) ) );" },
+      ],
+   },
+   {
+      "name": "bit_indices",
+      "brief": "Writes the positions of the set bits of a 16 bit value in ascending order, e.g. to turn a bitmap into row numbers.",
+      "parameters": [
+         ( "uint32_t", "bits", "Bits, only the lower 16 are used." ),
+         ( "int32_t", "base", "Added to every position." ),
+         ( "int32_t *", "indices", "Destination, must have room for 16 values. Entries past the returned count are unspecified." ),
+      ],
+      "return_type": "int32_t",
+      "return_doc": "Number of indices written (popcount of the lower 16 bits).",
+      "definitions": [
+         { **SCALAR, "ctype": "int64_t", "body": """int32_t count = 0;
+for( uint32_t remaining = bits & 0xFFFF; remaining != 0; remaining &= remaining - 1 ) {
+   indices[ count++ ] = base + __builtin_ctz( remaining );
+}
+return count;""" },
+         { "extension": "neon", "ctype": "int64_t", "body": BIT_INDICES_NEON },
+         { "extension": "sse", "ctype": "int64_t", "body": BIT_INDICES_SSE },
+         { "extension": "avx2", "ctype": "int64_t", "body": BIT_INDICES_AVX2 },
+         { "extension": "avx512", "ctype": "int64_t", "body": """auto const positions = _mm512_add_epi32( _mm512_setr_epi32( 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 ), _mm512_set1_epi32( base ) );
+_mm512_storeu_si512( indices, _mm512_maskz_compress_epi32( static_cast< __mmask16 >( bits ), positions ) );
+return __builtin_popcount( bits & 0xFFFF );""" },
+         { "extension": "avx512", "ctype": "int64_t", "vector_size": "256", "body": """auto const positions = _mm256_add_epi32( _mm256_setr_epi32( 0, 1, 2, 3, 4, 5, 6, 7 ), _mm256_set1_epi32( base ) );
+int32_t const low_count = __builtin_popcount( bits & 0xFF );
+_mm256_storeu_si256( reinterpret_cast< __m256i * >( indices ), _mm256_maskz_compress_epi32( static_cast< __mmask8 >( bits ), positions ) );
+_mm256_storeu_si256(
+   reinterpret_cast< __m256i * >( indices + low_count ),
+   _mm256_maskz_compress_epi32( static_cast< __mmask8 >( bits >> 8 ), _mm256_add_epi32( positions, _mm256_set1_epi32( 8 ) ) )
+);
+return low_count + __builtin_popcount( bits & 0xFF00 );""" },
+      ],
+   },
+   {
+      "name": "deposit_bits",
+      "brief": "Deposits the low bits of a value at the set bits of a mask, like pdep, e.g. to spread the values of a nullable boolean column over its non-null rows.",
+      "parameters": [
+         ( "uint64_t", "source", "Bits to deposit, the lowest popcount( mask ) are used." ),
+         ( "uint64_t", "mask", "Positions to deposit the bits at." ),
+      ],
+      "return_type": "uint64_t",
+      "return_doc": "The i-th lowest bit of source at the position of the i-th lowest set bit of mask, 0 elsewhere.",
+      "definitions": [
+         { **SCALAR, "ctype": "int64_t", "native": False, "body": """uint64_t result = 0;
+uint64_t remaining = source;
+for( uint64_t positions = mask; positions != 0; positions &= positions - 1, remaining >>= 1 ) {
+   result |= ( remaining & 1 ) ? positions & -positions : 0;
+}
+return result;""" },
+         { "extension": "neon", "ctype": "int64_t", "native": False, "body": DEPOSIT_BITS_NEON },
+         # pdep needs BMI2, which the SSE target does not imply.
+         { "extension": "sse", "ctype": "int64_t", "native": False, "body": DEPOSIT_BITS_SSE },
+         { "extension": "avx2", "ctype": "int64_t", "body": "return _pdep_u64( source, mask );" },
+         # vpexpandb on the mask of the source bits (AVX512VBMI2) has half the throughput of pdep.
+         { "extension": "avx512", "ctype": "int64_t", "body": "return _pdep_u64( source, mask );" },
+         { "extension": "avx512", "ctype": "int64_t", "vector_size": "256", "body": "return _pdep_u64( source, mask );" },
+      ],
+   },
+]
@@ -0,0 +1,272 @@
+"""Arithmetic primitives. Spec consumed by ../tvl_generator.py."""
+brief = "Arithmetic primitives."
+
+# The scalar backend is specialized for every vector size.
+SCALAR = { "extension": "scalar", "vector_size": "VectorSizeInBits", "template_parameters": "std::size_t VectorSizeInBits" }
+SCALAR_ADD = """typename Vec::register_type result{ };
+for( std::size_t i = 0; i < Vec::vector_element_count(); ++i ) {
+   result[ i ] = vec_a[ i ] + vec_b[ i ];
+}
+return result;"""
+# 64-bit lane multiply from three 32x32->64 bit products for ISAs without vpmullq.
+MUL64_EMULATED = """auto lo_lo = {p}_mul_epu32( vec_a, vec_b );
+auto hi_lo = {p}_mul_epu32( {p}_srli_epi64( vec_a, 32 ), vec_b );
+auto lo_hi = {p}_mul_epu32( vec_a, {p}_srli_epi64( vec_b, 32 ) );
+return {p}_add_epi64( lo_lo, {p}_slli_epi64( {p}_add_epi64( hi_lo, lo_hi ), 32 ) );"""
+# NEON registers are int64x2_t for every integral base type.
+NEON_ADD32 = "return vreinterpretq_s64_u32( vaddq_u32( vreinterpretq_u32_s64( vec_a ), vreinterpretq_u32_s64( vec_b ) ) );"
+
+primitives = [
+   {
+      "name": "add",
+      "brief": "Adds two vector registers.",
+      "parameters": [
+         ( "typename Vec::register_type", "vec_a", "First vector." ),
+         ( "typename Vec::register_type", "vec_b", "Second vector." ),
+      ],
+      "return_type": "typename Vec::register_type",
+      "return_doc": "Vector containing result of the addition.",
+      "definitions": [
+         { **SCALAR, "ctype": "int64_t", "body": SCALAR_ADD },
+         { **SCALAR, "ctype": "uint64_t", "body": SCALAR_ADD },
+         { **SCALAR, "ctype": "uint32_t", "body": SCALAR_ADD },
+         { "extension": "neon", "ctype": "int64_t", "body": "return vaddq_s64( vec_a, vec_b );" },
+         { "extension": "neon", "ctype": "uint64_t", "body": "return vaddq_s64( vec_a, vec_b );" },
+         { "extension": "neon", "ctype": "uint32_t", "body": NEON_ADD32 },
+         { "extension": "sse", "ctype": "int64_t", "body": "return _mm_add_epi64(vec_a, vec_b);" },
+         { "extension": "sse", "ctype": "uint64_t", "body": "return _mm_add_epi64(vec_a, vec_b);" },
+         { "extension": "sse", "ctype": "uint32_t", "body": "return _mm_add_epi32(vec_a, vec_b);" },
+         { "extension": "avx2", "ctype": "int64_t", "body": "return _mm256_add_epi64(vec_a, vec_b);" },
+         { "extension": "avx2", "ctype": "uint64_t", "body": "return _mm256_add_epi64(vec_a, vec_b);" },
+         { "extension": "avx2", "ctype": "uint32_t", "body": "return _mm256_add_epi32(vec_a, vec_b);" },
+         { "extension": "avx512", "ctype": "int64_t", "body": "return _mm512_add_epi64(vec_a, vec_b);" },
+         { "extension": "avx512", "ctype": "uint64_t", "body": "return _mm512_add_epi64(vec_a, vec_b);" },
+         { "extension": "avx512", "ctype": "uint32_t", "body": "return _mm512_add_epi32(vec_a, vec_b);" },
+         { "extension": "avx512", "ctype": "int64_t", "vector_size": "256", "body": "return _mm256_add_epi64(vec_a, vec_b);" },
+         { "extension": "avx512", "ctype": "uint64_t", "vector_size": "256", "body": "return _mm256_add_epi64(vec_a, vec_b);" },
+         { "extension": "avx512", "ctype": "uint32_t", "vector_size": "256", "body": "return _mm256_add_epi32(vec_a, vec_b);" },
+      ],
+   },
+   {
+      "name": "sub",
+      "brief": "Subtracts two vector registers.",
+      "parameters": [
+         ( "typename Vec::register_type", "vec_a", "Minuend." ),
+         ( "typename Vec::register_type", "vec_b", "Subtrahend." ),
+      ],
+      "return_type": "typename Vec::register_type",
+      "return_doc": "Vector containing vec_a[*] - vec_b[*] (wrapping).",
+      "definitions": [
+         { **SCALAR, "ctype": "int64_t", "body": """typename Vec::register_type result{ };
+for( std::size_t i = 0; i < Vec::vector_element_count(); ++i ) {
+   result[ i ] = static_cast< uint64_t >( vec_a[ i ] ) - static_cast< uint64_t >( vec_b[ i ] );
+}
+return result;""" },
+         { "extension": "neon", "ctype": "int64_t", "body": "return vsubq_s64( vec_a, vec_b );" },
+         { "extension": "sse", "ctype": "int64_t", "body": "return _mm_sub_epi64( vec_a, vec_b );" },
+         { "extension": "avx2", "ctype": "int64_t", "body": "return _mm256_sub_epi64( vec_a, vec_b );" },
+         { "extension": "avx512", "ctype": "int64_t", "body": "return _mm512_sub_epi64( vec_a, vec_b );" },
+         { "extension": "avx512", "ctype": "int64_t", "vector_size": "256", "body": "return _mm256_sub_epi64( vec_a, vec_b );" },
+      ],
+   },
+   {
+      "name": "mul",
+      "brief": "Multiplies two vector registers and keeps the low 64 bit of every product.",
+      "parameters": [
+         ( "typename Vec::register_type", "vec_a", "First vector." ),
+         ( "typename Vec::register_type", "vec_b", "Second vector." ),
+      ],
+      "return_type": "typename Vec::register_type",
+      "return_doc": "Vector containing the wrapped products.",
+      "definitions": [
+         { **SCALAR, "ctype": "int64_t", "body": """typename Vec::register_type result{ };
+for( std::size_t i = 0; i < Vec::vector_element_count(); ++i ) {
+   result[ i ] = static_cast< uint64_t >( vec_a[ i ] ) * static_cast< uint64_t >( vec_b[ i ] );
+}
+return result;""" },
+         { "extension": "neon", "ctype": "int64_t", "native": False, "body": "return vreinterpretq_s64_u64( vreinterpretq_u64_s64( vec_a ) * vreinterpretq_u64_s64( vec_b ) );" },
+         { "extension": "sse", "ctype": "int64_t", "native": False, "body": MUL64_EMULATED.format( p = "_mm" ) },
+         { "extension": "avx2", "ctype": "int64_t", "native": False, "body": MUL64_EMULATED.format( p = "_mm256" ) },
+         { "extension": "avx512", "ctype": "int64_t", "body": "return _mm512_mullo_epi64( vec_a, vec_b );" },
+         { "extension": "avx512", "ctype": "int64_t", "vector_size": "256", "body": "return _mm256_mullo_epi64( vec_a, vec_b );" },
+      ],
+   },
+   {
+      "name": "shift_right",
+      "brief": "Shifts every lane of a vector register logically to the right.",
+      "parameters": [
+         ( "typename Vec::register_type", "vec", "Vector which should be shifted." ),
+         ( "int", "shift", "Number of bits to shift (0 <= shift < lane width)." ),
+      ],
+      "return_type": "typename Vec::register_type",
+      "return_doc": "Vector containing the shifted values, filled with zeros from the left.",
+      "definitions": [
+         { **SCALAR, "ctype": "int64_t", "body": """typename Vec::register_type result{ };
+for( std::size_t i = 0; i < Vec::vector_element_count(); ++i ) {
+   result[ i ] = static_cast< uint64_t >( vec[ i ] ) >> shift;
+}
+return result;""" },
+         { "extension": "neon", "ctype": "int64_t", "body": "return vreinterpretq_s64_u64( vshlq_u64( vreinterpretq_u64_s64( vec ), vdupq_n_s64( -shift ) ) );" },
+         { "extension": "sse", "ctype": "int64_t", "body": "return _mm_srli_epi64( vec, shift );" },
+         { "extension": "avx2", "ctype": "int64_t", "body": "return _mm256_srli_epi64( vec, shift );" },
+         { "extension": "avx512", "ctype": "int64_t", "body": "return _mm512_srli_epi64( vec, shift );" },
+         { "extension": "avx512", "ctype": "int64_t", "vector_size": "256", "body": "return _mm256_srli_epi64( vec, shift );" },
+      ],
+   },
+   {
+      "name": "shift_left",
+      "brief": "Shifts every lane of a vector register to the left.",
+      "parameters": [
+         ( "typename Vec::register_type", "vec", "Vector which should be shifted." ),
+         ( "int", "shift", "Number of bits to shift (0 <= shift < lane width)." ),
+      ],
+      "return_type": "typename Vec::register_type",
+      "return_doc": "Vector containing the shifted values, filled with zeros from the right.",
+      "definitions": [
+         { **SCALAR, "ctype": "int64_t", "body": """typename Vec::register_type result{ };
+for( std::size_t i = 0; i < Vec::vector_element_count(); ++i ) {
+   result[ i ] = static_cast< uint64_t >( vec[ i ] ) << shift;
+}
+return result;""" },
+         { "extension": "neon", "ctype": "int64_t", "body": "return vreinterpretq_s64_u64( vshlq_u64( vreinterpretq_u64_s64( vec ), vdupq_n_s64( shift ) ) );" },
+         { "extension": "sse", "ctype": "int64_t", "body": "return _mm_slli_epi64( vec, shift );" },
+         { "extension": "avx2", "ctype": "int64_t", "body": "return _mm256_slli_epi64( vec, shift );" },
+         { "extension": "avx512", "ctype": "int64_t", "body": "return _mm512_slli_epi64( vec, shift );" },
+         { "extension": "avx512", "ctype": "int64_t", "vector_size": "256", "body": "return _mm256_slli_epi64( vec, shift );" },
+      ],
+   },
+   {
+      "name": "shift_left_variable",
+      "brief": "Shifts every lane of a vector register to the left by its own amount.",
+      "parameters": [
+         ( "typename Vec::register_type", "vec", "Vector which should be shifted." ),
+         ( "typename Vec::register_type", "shift", "Number of bits to shift every lane (0 <= shift[*] < lane width)." ),
+      ],
+      "return_type": "typename Vec::register_type",
+      "return_doc": "Vector containing vec[*] << shift[*], filled with zeros from the right.",
+      "definitions": [
+         { **SCALAR, "ctype": "int64_t", "body": """typename Vec::register_type result{ };
+for( std::size_t i = 0; i < Vec::vector_element_count(); ++i ) {
+   result[ i ] = static_cast< uint64_t >( vec[ i ] ) << shift[ i ];
+}
+return result;""" },
+         { "extension": "neon", "ctype": "int64_t", "body": "return vreinterpretq_s64_u64( vshlq_u64( vreinterpretq_u64_s64( vec ), shift ) );" },
+         # psllq shifts all lanes by the count in the lower lane, so shift twice and take one lane of each.
+         { "extension": "sse", "ctype": "int64_t", "native": False, "body": """auto const low = _mm_sll_epi64( vec, shift );
+auto const high = _mm_sll_epi64( vec, _mm_unpackhi_epi64( shift, shift ) );
+return _mm_blend_epi16( low, high, 0xF0 );""" },
+         { "extension": "avx2", "ctype": "int64_t", "body": "return _mm256_sllv_epi64( vec, shift );" },
+         { "extension": "avx512", "ctype": "int64_t", "body": "return _mm512_sllv_epi64( vec, shift );" },
+         { "extension": "avx512", "ctype": "int64_t", "vector_size": "256", "body": "return _mm256_sllv_epi64( vec, shift );" },
+      ],
+   },
+   {
+      "name": "bitwise_and",
+      "brief": "Computes the bitwise and of two vector registers.",
+      "parameters": [
+         ( "typename Vec::register_type", "vec_a", "First vector." ),
+         ( "typename Vec::register_type", "vec_b", "Second vector." ),
+      ],
+      "return_type": "typename Vec::register_type",
+      "return_doc": "Vector containing vec_a[*] & vec_b[*].",
+      "definitions": [
+         { **SCALAR, "ctype": "int64_t", "body": "return vec_a & vec_b;" },
+         { "extension": "neon", "ctype": "int64_t", "body": "return vandq_s64( vec_a, vec_b );" },
+         { "extension": "sse", "ctype": "int64_t", "body": "return _mm_and_si128( vec_a, vec_b );" },
+         { "extension": "avx2", "ctype": "int64_t", "body": "return _mm256_and_si256( vec_a, vec_b );" },
+         { "extension": "avx512", "ctype": "int64_t", "body": "return _mm512_and_si512( vec_a, vec_b );" },
+         { "extension": "avx512", "ctype": "int64_t", "vector_size": "256", "body": "return _mm256_and_si256( vec_a, vec_b );" },
+      ],
+   },
+   {
+      "name": "bitwise_or",
+      "brief": "Computes the bitwise or of two vector registers.",
+      "parameters": [
+         ( "typename Vec::register_type", "vec_a", "First vector." ),
+         ( "typename Vec::register_type", "vec_b", "Second vector." ),
+      ],
+      "return_type": "typename Vec::register_type",
+      "return_doc": "Vector containing vec_a[*] | vec_b[*].",
+      "definitions": [
+         { **SCALAR, "ctype": "int64_t", "body": "return vec_a | vec_b;" },
+         { "extension": "neon", "ctype": "int64_t", "body": "return vorrq_s64( vec_a, vec_b );" },
+         { "extension": "sse", "ctype": "int64_t", "body": "return _mm_or_si128( vec_a, vec_b );" },
+         { "extension": "avx2", "ctype": "int64_t", "body": "return _mm256_or_si256( vec_a, vec_b );" },
+         { "extension": "avx512", "ctype": "int64_t", "body": "return _mm512_or_si512( vec_a, vec_b );" },
+         { "extension": "avx512", "ctype": "int64_t", "vector_size": "256", "body": "return _mm256_or_si256( vec_a, vec_b );" },
+      ],
+   },
+   {
+      "name": "bitwise_xor",
+      "brief": "Computes the bitwise exclusive or of two vector registers.",
+      "parameters": [
+         ( "typename Vec::register_type", "vec_a", "First vector." ),
+         ( "typename Vec::register_type", "vec_b", "Second vector." ),
+      ],
+      "return_type": "typename Vec::register_type",
+      "return_doc": "Vector containing vec_a[*] ^ vec_b[*].",
+      "definitions": [
+         { **SCALAR, "ctype": "int64_t", "body": "return vec_a ^ vec_b;" },
+         { "extension": "neon", "ctype": "int64_t", "body": "return veorq_s64( vec_a, vec_b );" },
+         { "extension": "sse", "ctype": "int64_t", "body": "return _mm_xor_si128( vec_a, vec_b );" },
+         { "extension": "avx2", "ctype": "int64_t", "body": "return _mm256_xor_si256( vec_a, vec_b );" },
+         { "extension": "avx512", "ctype": "int64_t", "body": "return _mm512_xor_si512( vec_a, vec_b );" },
+         { "extension": "avx512", "ctype": "int64_t", "vector_size": "256", "body": "return _mm256_xor_si256( vec_a, vec_b );" },
+      ],
+   },
+   {
+      "name": "bitwise_andnot",
+      "brief": "Computes the bitwise and of a vector register with the complement of another one.",
+      "parameters": [
+         ( "typename Vec::register_type", "vec_a", "First vector." ),
+         ( "typename Vec::register_type", "vec_b", "Second vector, complemented." ),
+      ],
+      "return_type": "typename Vec::register_type",
+      "return_doc": "Vector containing vec_a[*] & ~vec_b[*].",
+      "definitions": [
+         { **SCALAR, "ctype": "int64_t", "body": "return vec_a & ~vec_b;" },
+         { "extension": "neon", "ctype": "int64_t", "body": "return vbicq_s64( vec_a, vec_b );" },
+         { "extension": "sse", "ctype": "int64_t", "body": "return _mm_andnot_si128( vec_b, vec_a );" },
+         { "extension": "avx2", "ctype": "int64_t", "body": "return _mm256_andnot_si256( vec_b, vec_a );" },
+         { "extension": "avx512", "ctype": "int64_t", "body": "return _mm512_andnot_si512( vec_b, vec_a );" },
+         { "extension": "avx512", "ctype": "int64_t", "vector_size": "256", "body": "return _mm256_andnot_si256( vec_b, vec_a );" },
+      ],
+   },
+   {
+      "name": "bitwise_ornot",
+      "brief": "Computes the bitwise or of a vector register with the complement of another one.",
+      "parameters": [
+         ( "typename Vec::register_type", "vec_a", "First vector." ),
+         ( "typename Vec::register_type", "vec_b", "Second vector, complemented." ),
+      ],
+      "return_type": "typename Vec::register_type",
+      "return_doc": "Vector containing vec_a[*] | ~vec_b[*].",
+      "definitions": [
+         { **SCALAR, "ctype": "int64_t", "body": "return vec_a | ~vec_b;" },
+         { "extension": "neon", "ctype": "int64_t", "body": "return vornq_s64( vec_a, vec_b );" },
+         { "extension": "sse", "ctype": "int64_t", "native": False, "body": "return _mm_or_si128( vec_a, _mm_xor_si128( vec_b, _mm_cmpeq_epi32( vec_b, vec_b ) ) );" },
+         { "extension": "avx2", "ctype": "int64_t", "native": False, "body": "return _mm256_or_si256( vec_a, _mm256_xor_si256( vec_b, _mm256_cmpeq_epi32( vec_b, vec_b ) ) );" },
+         # vpternlogq truth table of a | ~b.
+         { "extension": "avx512", "ctype": "int64_t", "body": "return _mm512_ternarylogic_epi64( vec_a, vec_b, vec_b, 0xF3 );" },
+         { "extension": "avx512", "ctype": "int64_t", "vector_size": "256", "body": "return _mm256_ternarylogic_epi64( vec_a, vec_b, vec_b, 0xF3 );" },
+      ],
+   },
+   {
+      "name": "bitwise_not",
+      "brief": "Computes the bitwise complement of a vector register.",
+      "parameters": [
+         ( "typename Vec::register_type", "vec", "Vector." ),
+      ],
+      "return_type": "typename Vec::register_type",
+      "return_doc": "Vector containing ~vec[*].",
+      "definitions": [
+         { **SCALAR, "ctype": "int64_t", "body": "return ~vec;" },
+         { "extension": "neon", "ctype": "int64_t", "body": "return vreinterpretq_s64_s32( vmvnq_s32( vreinterpretq_s32_s64( vec ) ) );" },
+         { "extension": "sse", "ctype": "int64_t", "native": False, "body": "return _mm_xor_si128( vec, _mm_cmpeq_epi32( vec, vec ) );" },
+         { "extension": "avx2", "ctype": "int64_t", "native": False, "body": "return _mm256_xor_si256( vec, _mm256_cmpeq_epi32( vec, vec ) );" },
+         # vpternlogq truth table of ~c.
+         { "extension": "avx512", "ctype": "int64_t", "body": "return _mm512_ternarylogic_epi64( vec, vec, vec, 0x55 );" },
+         { "extension": "avx512", "ctype": "int64_t", "vector_size": "256", "body": "return _mm256_ternarylogic_epi64( vec, vec, vec, 0x55 );" },
+      ],
+   },
+]
@@ -0,0 +1,53 @@
+"""Compare primitives. Spec consumed by ../tvl_generator.py."""
+brief = "Compare primitives."
+
+# The scalar backend is specialized for every vector size.
+SCALAR = { "extension": "scalar", "vector_size": "VectorSizeInBits", "template_parameters": "std::size_t VectorSizeInBits" }
+
+primitives = [
+   {
+      "name": "equal",
+      "brief": "Compares two vector registers for equality.",
+      "parameters": [
+         ( "typename Vec::register_type", "vec_a", "Left vector." ),
+         ( "typename Vec::register_type", "vec_b", "Right vector." ),
+      ],
+      "return_type": "typename Vec::mask_type",
+      "return_doc": "Vector mask type indicating whether vec_a[*]==vec_b[*].",
+      "definitions": [
+         { **SCALAR, "ctype": "int64_t", "body": """typename Vec::mask_type result{ };
+for( std::size_t i = 0; i < Vec::vector_element_count(); ++i ) {
+   result[ i ] = ( vec_a[ i ] == vec_b[ i ] ) ? -1 : 0;
+}
+return result;""" },
+         { "extension": "neon", "ctype": "int64_t", "body": "return vceqq_s64( vec_a, vec_b );" },
+         { "extension": "sse", "ctype": "int64_t", "body": "return _mm_cmpeq_epi64( vec_a, vec_b );" },
+         { "extension": "avx2", "ctype": "int64_t", "body": "return _mm256_cmpeq_epi64( vec_a, vec_b );" },
+         { "extension": "avx512", "ctype": "int64_t", "body": "return _mm512_cmpeq_epi64_mask( vec_a, vec_b );" },
+         { "extension": "avx512", "ctype": "int64_t", "vector_size": "256", "body": "return _mm256_cmpeq_epi64_mask( vec_a, vec_b );" },
+      ],
+   },
+   {
+      "name": "between_inclusive",
+      "brief": "Checks if the values of a vector are in a specific range (min[*] <= d[*] <= max[*]).",
+      "parameters": [
+         ( "typename Vec::register_type", "vec_data", "Data vector." ),
+         ( "typename Vec::register_type", "vec_min", "Minimum vector." ),
+         ( "typename Vec::register_type", "vec_max", "Maximum vector." ),
+      ],
+      "return_type": "typename Vec::mask_type",
+      "return_doc": "Vector mask type indicating whether the data is in the given range.",
+      "definitions": [
+         { **SCALAR, "ctype": "int64_t", "body": """typename Vec::mask_type result{ };
+for( std::size_t i = 0; i < Vec::vector_element_count(); ++i ) {
+   result[ i ] = ( ( vec_min[ i ] <= vec_data[ i ] ) && ( vec_data[ i ] <= vec_max[ i ] ) ) ? -1 : 0;
+}
+return result;""" },
+         { "extension": "neon", "ctype": "int64_t", "body": "return vandq_u64( vcgeq_s64( vec_data, vec_min ), vcleq_s64( vec_data, vec_max ) );" },
+         { "extension": "sse", "ctype": "int64_t", "body": "return _mm_andnot_si128( _mm_cmpgt_epi64( vec_min, vec_data ), _mm_andnot_si128( _mm_cmpgt_epi64( vec_data, vec_max ), _mm_set1_epi64x(-1)));" },
+         { "extension": "avx2", "ctype": "int64_t", "body": "return _mm256_andnot_si256( _mm256_cmpgt_epi64( vec_min, vec_data ), _mm256_andnot_si256( _mm256_cmpgt_epi64( vec_data, vec_max ), _mm256_set1_epi64x(-1)));" },
+         { "extension": "avx512", "ctype": "int64_t", "body": "return _mm512_cmple_epi64_mask( vec_min, vec_data ) & _mm512_cmpge_epi64_mask( vec_max, vec_data );" },
+         { "extension": "avx512", "ctype": "int64_t", "vector_size": "256", "body": "return _mm256_cmple_epi64_mask( vec_min, vec_data ) & _mm256_cmpge_epi64_mask( vec_max, vec_data );" },
+      ],
+   },
+]
@@ -0,0 +1,299 @@
+"""Conversion primitives. Spec consumed by ../tvl_generator.py."""
+brief = "Conversion primitives."
+
+# The scalar backend is specialized for every vector size.
+SCALAR = { "extension": "scalar", "vector_size": "VectorSizeInBits", "template_parameters": "std::size_t VectorSizeInBits" }
+# Integral registers have the same type for every base type, floating point ones do not.
+DOUBLE_REGISTER = "typename simd< double, typename Vec::target_extension, Vec::vector_size_b() >::register_type"
+FLOAT_REGISTER = "typename simd< float, typename Vec::target_extension, Vec::vector_size_b() >::register_type"
+SCALAR_INT32_REGISTER = "typename simd< int32_t, scalar, VectorSizeInBits >::register_type"
+SCALAR_LOAD = """typename Vec::register_type result{ };
+for( std::size_t i = 0; i < Vec::vector_element_count(); ++i ) {
+   result[ i ] = memory[ i ];
+}
+return result;"""
+# Without vpmovqd the even 32 bit halves are gathered into the lower half of the register.
+NARROW_AVX2 = "return _mm256_zextsi128_si256( _mm256_castsi256_si128( _mm256_permutevar8x32_epi32( vec, _mm256_setr_epi32( 0, 2, 4, 6, 0, 0, 0, 0 ) ) ) );"
+NARROW_SSE = "return _mm_move_epi64( _mm_shuffle_epi32( vec, _MM_SHUFFLE( 3, 3, 2, 0 ) ) );"
+SATURATE = """auto const upper = {p}_set1_epi64x( 0x7FFFFFFFLL );
+auto const lower = {p}_set1_epi64x( -0x80000000LL );
+auto clamped = {p}_blendv_epi8( vec, upper, {p}_cmpgt_epi64( vec, upper ) );
+clamped = {p}_blendv_epi8( clamped, lower, {p}_cmpgt_epi64( lower, clamped ) );
+return tvl::narrow_int32< Vec >( clamped );"""
+
+
+AVX512 = { "extension": "avx512" }
+AVX512_256 = { "extension": "avx512", "vector_size": "256" }
+AVX2 = { "extension": "avx2" }
+SSE = { "extension": "sse" }
+M128 = "reinterpret_cast< __m128i const * >( memory )"
+M256 = "reinterpret_cast< __m256i const * >( memory )"
+# x86 loads of vector_element_count() values per source width: ( processing style, conversion prefix, load ).
+LOADS = {
+   "32": [
+      ( AVX512, "_mm512", "_mm256_loadu_si256( %s )" % M256 ),
+      ( AVX512_256, "_mm256", "_mm_loadu_si128( %s )" % M128 ),
+      ( AVX2, "_mm256", "_mm_loadu_si128( %s )" % M128 ),
+      ( SSE, "_mm", "_mm_loadl_epi64( %s )" % M128 ),
+   ],
+   "16": [
+      ( AVX512, "_mm512", "_mm_loadu_si128( %s )" % M128 ),
+      ( AVX512_256, "_mm256", "_mm_loadl_epi64( %s )" % M128 ),
+      ( AVX2, "_mm256", "_mm_loadl_epi64( %s )" % M128 ),
+      ( SSE, "_mm", "_mm_loadu_si32( memory )" ),
+   ],
+   "8": [
+      ( AVX512, "_mm512", "_mm_loadl_epi64( %s )" % M128 ),
+      ( AVX512_256, "_mm256", "_mm_loadu_si32( memory )" ),
+      ( AVX2, "_mm256", "_mm_loadu_si32( memory )" ),
+      ( SSE, "_mm", "_mm_loadu_si16( memory )" ),
+   ],
+}
+
+
+def extend_primitive( source, signed ):
+   bits = source.lstrip( "uint" )
+   convert = "_cvtep%s%s_epi64" % ( "i" if signed else "u", bits )
+   if bits == "32":
+      neon = { "extension": "neon", "ctype": "int64_t", "body": "return vmovl_s32( vld1_s32( memory ) );" } if signed else \
+         { "extension": "neon", "ctype": "int64_t", "body": "return vreinterpretq_s64_u64( vmovl_u32( vld1_u32( memory ) ) );" }
+   else:
+      # There is no two element load for 8 and 16 bit lanes.
+      neon = { "extension": "neon", "ctype": "int64_t", "native": False, "body": "return int64x2_t{ memory[ 0 ], memory[ 1 ] };" }
+   definitions = [ { **SCALAR, "ctype": "int64_t", "body": SCALAR_LOAD }, neon ]
+   for style, prefix, load in LOADS[ bits ]:
+      definitions.append( { **style, "ctype": "int64_t", "body": "return %s%s( %s );" % ( prefix, convert, load ) } )
+   return {
+      "name": "loadu_extend_%s" % source,
+      "brief": "Loads vector_element_count() %s bit values from unaligned memory and %s them to 64 bit." % (
+         bits, "sign extends" if signed else "zero extends" ),
+      "parameters": [
+         ( "%s_t const *" % source, "memory", "Memory address containing the values." ),
+      ],
+      "return_type": "typename Vec::register_type",
+      "return_doc": "Vector containing the %s extended values." % ( "sign" if signed else "zero" ),
+      "definitions": definitions,
+   }
+
+
+primitives = [ extend_primitive( source, source.startswith( "int" ) ) for source in
+               [ "int8", "int16", "int32", "uint8", "uint16", "uint32" ] ] + [
+   {
+      "name": "maskz_loadu_extend_int32",
+      "brief": "Loads the selected 32 bit values from unaligned memory, sign extends them to 64 bit and zeroes the other lanes.",
+      "parameters": [
+         ( "int32_t const *", "memory", "Memory address containing the values, lanes which are not selected are not accessed." ),
+         ( "typename Vec::mask_type", "mask", "Vector mask register selecting the lanes to load." ),
+      ],
+      "return_type": "typename Vec::register_type",
+      "return_doc": "Vector containing the sign extended values and zero in all other lanes.",
+      "definitions": [
+         { **SCALAR, "ctype": "int64_t", "body": """typename Vec::register_type result{ };
+for( std::size_t i = 0; i < Vec::vector_element_count(); ++i ) {
+   result[ i ] = mask[ i ] ? memory[ i ] : 0;
+}
+return result;""" },
+         { "extension": "neon", "ctype": "int64_t", "native": False, "body": """auto result = vdupq_n_s64( 0 );
+if( vgetq_lane_u64( mask, 0 ) ) {
+   result = vsetq_lane_s64( memory[ 0 ], result, 0 );
+}
+if( vgetq_lane_u64( mask, 1 ) ) {
+   result = vsetq_lane_s64( memory[ 1 ], result, 1 );
+}
+return result;""" },
+         { "extension": "sse", "ctype": "int64_t", "native": False, "body": """auto const lanes = _mm_movemask_pd( _mm_castsi128_pd( mask ) );
+auto result = _mm_setzero_si128( );
+if( lanes & 1 ) {
+   result = _mm_insert_epi64( result, memory[ 0 ], 0 );
+}
+if( lanes & 2 ) {
+   result = _mm_insert_epi64( result, memory[ 1 ], 1 );
+}
+return result;""" },
+         # vpmaskmovd takes one mask bit per 32 bit lane, the even halves of the 64 bit mask lanes are packed first.
+         { "extension": "avx2", "ctype": "int64_t", "body": """auto const dwords = _mm256_castsi256_si128( _mm256_permutevar8x32_epi32( mask, _mm256_setr_epi32( 0, 2, 4, 6, 0, 0, 0, 0 ) ) );
+return _mm256_cvtepi32_epi64( _mm_maskload_epi32( memory, dwords ) );""" },
+         { "extension": "avx512", "ctype": "int64_t", "body": "return _mm512_cvtepi32_epi64( _mm256_maskz_loadu_epi32( mask, memory ) );" },
+         { "extension": "avx512", "ctype": "int64_t", "vector_size": "256", "body": "return _mm256_cvtepi32_epi64( _mm_maskz_loadu_epi32( mask, memory ) );" },
+      ],
+   },
+   {
+      "name": "narrow_int32",
+      "brief": "Truncates every 64 bit lane to 32 bit and packs the results into the lower half of the register.",
+      "parameters": [
+         ( "typename Vec::register_type", "vec", "Vector containing the values." ),
+      ],
+      "return_type": "typename Vec::register_type",
+      "return_doc": "Register holding vector_element_count() int32_t values in its lower half and zeros in the upper half.",
+      "definitions": [
+         { **SCALAR, "ctype": "int64_t", "body": """%s result{ };
+for( std::size_t i = 0; i < Vec::vector_element_count(); ++i ) {
+   result[ i ] = static_cast< int32_t >( vec[ i ] );
+}
+return ( typename Vec::register_type ) result;""" % SCALAR_INT32_REGISTER },
+         { "extension": "neon", "ctype": "int64_t", "body": "return vreinterpretq_s64_s32( vcombine_s32( vmovn_s64( vec ), vdup_n_s32( 0 ) ) );" },
+         { "extension": "sse", "ctype": "int64_t", "body": NARROW_SSE },
+         { "extension": "avx2", "ctype": "int64_t", "native": False, "body": NARROW_AVX2 },
+         { "extension": "avx512", "ctype": "int64_t", "body": "return _mm512_zextsi256_si512( _mm512_cvtepi64_epi32( vec ) );" },
+         { "extension": "avx512", "ctype": "int64_t", "vector_size": "256", "body": "return _mm256_zextsi128_si256( _mm256_cvtepi64_epi32( vec ) );" },
+      ],
+   },
+   {
+      "name": "narrow_int32_saturate",
+      "brief": "Clamps every 64 bit lane to the int32_t range and packs the results into the lower half of the register.",
+      "parameters": [
+         ( "typename Vec::register_type", "vec", "Vector containing the values." ),
+      ],
+      "return_type": "typename Vec::register_type",
+      "return_doc": "Register holding vector_element_count() int32_t values in its lower half and zeros in the upper half.",
+      "definitions": [
+         { **SCALAR, "ctype": "int64_t", "body": """%s result{ };
+for( std::size_t i = 0; i < Vec::vector_element_count(); ++i ) {
+   result[ i ] = vec[ i ] > 0x7FFFFFFFLL ? 0x7FFFFFFF : ( vec[ i ] < -0x80000000LL ? -0x7FFFFFFF - 1 : static_cast< int32_t >( vec[ i ] ) );
+}
+return ( typename Vec::register_type ) result;""" % SCALAR_INT32_REGISTER },
+         { "extension": "neon", "ctype": "int64_t", "body": "return vreinterpretq_s64_s32( vcombine_s32( vqmovn_s64( vec ), vdup_n_s32( 0 ) ) );" },
+         { "extension": "sse", "ctype": "int64_t", "native": False, "body": SATURATE.format( p = "_mm" ) },
+         { "extension": "avx2", "ctype": "int64_t", "native": False, "body": SATURATE.format( p = "_mm256" ) },
+         { "extension": "avx512", "ctype": "int64_t", "body": "return _mm512_zextsi256_si512( _mm512_cvtsepi64_epi32( vec ) );" },
+         { "extension": "avx512", "ctype": "int64_t", "vector_size": "256", "body": "return _mm256_zextsi128_si256( _mm256_cvtsepi64_epi32( vec ) );" },
+      ],
+   },
+   {
+      "name": "to_double",
+      "brief": "Converts every 64 bit integer lane to double.",
+      "parameters": [
+         ( "typename Vec::register_type", "vec", "Vector containing the values." ),
+      ],
+      "return_type": DOUBLE_REGISTER,
+      "return_doc": "Vector containing the values rounded to the nearest double.",
+      "definitions": [
+         { **SCALAR, "ctype": "int64_t", "body": "return __builtin_convertvector( vec, %s );" % DOUBLE_REGISTER },
+         { "extension": "neon", "ctype": "int64_t", "body": "return vcvtq_f64_s64( vec );" },
+         # vcvtqq2pd needs AVX512DQ, the compiler picks the best sequence for the current target.
+         { "extension": "sse", "ctype": "int64_t", "native": False, "body": "return __builtin_convertvector( vec, __m128d );" },
+         { "extension": "avx2", "ctype": "int64_t", "native": False, "body": "return __builtin_convertvector( vec, __m256d );" },
+         { "extension": "avx512", "ctype": "int64_t", "body": "return _mm512_cvtepi64_pd( vec );" },
+         { "extension": "avx512", "ctype": "int64_t", "vector_size": "256", "body": "return _mm256_cvtepi64_pd( vec );" },
+      ],
+   },
+   {
+      "name": "from_double",
+      "brief": "Converts every double lane to a 64 bit integer, rounding towards zero.",
+      "parameters": [
+         ( DOUBLE_REGISTER, "vec", "Vector containing the values (must be representable as int64_t)." ),
+      ],
+      "return_type": "typename Vec::register_type",
+      "return_doc": "Vector containing the truncated values.",
+      "definitions": [
+         { **SCALAR, "ctype": "int64_t", "body": "return __builtin_convertvector( vec, typename Vec::register_type );" },
+         { "extension": "neon", "ctype": "int64_t", "body": "return vcvtq_s64_f64( vec );" },
+         { "extension": "sse", "ctype": "int64_t", "native": False, "body": "return __builtin_convertvector( vec, __m128i );" },
+         { "extension": "avx2", "ctype": "int64_t", "native": False, "body": "return __builtin_convertvector( vec, __m256i );" },
+         { "extension": "avx512", "ctype": "int64_t", "body": "return _mm512_cvttpd_epi64( vec );" },
+         { "extension": "avx512", "ctype": "int64_t", "vector_size": "256", "body": "return _mm256_cvttpd_epi64( vec );" },
+      ],
+   },
+   {
+      "name": "to_float",
+      "brief": "Converts every 32 bit integer lane of an integral register to float.",
+      "parameters": [
+         ( "typename Vec::register_type", "vec", "Register holding 2 * vector_element_count() int32_t values." ),
+      ],
+      "return_type": FLOAT_REGISTER,
+      "return_doc": "Vector containing the values rounded to the nearest float.",
+      "definitions": [
+         { **SCALAR, "ctype": "int64_t", "body": "return __builtin_convertvector( ( %s ) vec, %s );" % ( SCALAR_INT32_REGISTER, FLOAT_REGISTER ) },
+         { "extension": "neon", "ctype": "int64_t", "body": "return vcvtq_f32_s32( vreinterpretq_s32_s64( vec ) );" },
+         { "extension": "sse", "ctype": "int64_t", "body": "return _mm_cvtepi32_ps( vec );" },
+         { "extension": "avx2", "ctype": "int64_t", "body": "return _mm256_cvtepi32_ps( vec );" },
+         { "extension": "avx512", "ctype": "int64_t", "body": "return _mm512_cvtepi32_ps( vec );" },
+         { "extension": "avx512", "ctype": "int64_t", "vector_size": "256", "body": "return _mm256_cvtepi32_ps( vec );" },
+      ],
+   },
+   {
+      "name": "from_float",
+      "brief": "Converts every float lane to a 32 bit integer, rounding towards zero.",
+      "parameters": [
+         ( FLOAT_REGISTER, "vec", "Vector containing the values (must be representable as int32_t)." ),
+      ],
+      "return_type": "typename Vec::register_type",
+      "return_doc": "Register holding 2 * vector_element_count() int32_t values.",
+      "definitions": [
+         { **SCALAR, "ctype": "int64_t", "body": "return ( typename Vec::register_type ) __builtin_convertvector( vec, %s );" % SCALAR_INT32_REGISTER },
+         { "extension": "neon", "ctype": "int64_t", "body": "return vreinterpretq_s64_s32( vcvtq_s32_f32( vec ) );" },
+         { "extension": "sse", "ctype": "int64_t", "body": "return _mm_cvttps_epi32( vec );" },
+         { "extension": "avx2", "ctype": "int64_t", "body": "return _mm256_cvttps_epi32( vec );" },
+         { "extension": "avx512", "ctype": "int64_t", "body": "return _mm512_cvttps_epi32( vec );" },
+         { "extension": "avx512", "ctype": "int64_t", "vector_size": "256", "body": "return _mm256_cvttps_epi32( vec );" },
+      ],
+   },
+   {
+      "name": "reinterpret_as_double",
+      "brief": "Reinterprets the bits of an integral register as double lanes.",
+      "parameters": [
+         ( "typename Vec::register_type", "vec", "Vector containing the bits." ),
+      ],
+      "return_type": DOUBLE_REGISTER,
+      "return_doc": "The same bits as double register.",
+      "definitions": [
+         { **SCALAR, "ctype": "int64_t", "body": "return ( %s ) vec;" % DOUBLE_REGISTER },
+         { "extension": "neon", "ctype": "int64_t", "body": "return vreinterpretq_f64_s64( vec );" },
+         { "extension": "sse", "ctype": "int64_t", "body": "return _mm_castsi128_pd( vec );" },
+         { "extension": "avx2", "ctype": "int64_t", "body": "return _mm256_castsi256_pd( vec );" },
+         { "extension": "avx512", "ctype": "int64_t", "body": "return _mm512_castsi512_pd( vec );" },
+         { "extension": "avx512", "ctype": "int64_t", "vector_size": "256", "body": "return _mm256_castsi256_pd( vec );" },
+      ],
+   },
+   {
+      "name": "reinterpret_from_double",
+      "brief": "Reinterprets the bits of a double register as integral lanes.",
+      "parameters": [
+         ( DOUBLE_REGISTER, "vec", "Vector containing the bits." ),
+      ],
+      "return_type": "typename Vec::register_type",
+      "return_doc": "The same bits as integral register.",
+      "definitions": [
+         { **SCALAR, "ctype": "int64_t", "body": "return ( typename Vec::register_type ) vec;" },
+         { "extension": "neon", "ctype": "int64_t", "body": "return vreinterpretq_s64_f64( vec );" },
+         { "extension": "sse", "ctype": "int64_t", "body": "return _mm_castpd_si128( vec );" },
+         { "extension": "avx2", "ctype": "int64_t", "body": "return _mm256_castpd_si256( vec );" },
+         { "extension": "avx512", "ctype": "int64_t", "body": "return _mm512_castpd_si512( vec );" },
+         { "extension": "avx512", "ctype": "int64_t", "vector_size": "256", "body": "return _mm256_castpd_si256( vec );" },
+      ],
+   },
+   {
+      "name": "reinterpret_as_float",
+      "brief": "Reinterprets the bits of an integral register as float lanes.",
+      "parameters": [
+         ( "typename Vec::register_type", "vec", "Vector containing the bits." ),
+      ],
+      "return_type": FLOAT_REGISTER,
+      "return_doc": "The same bits as float register.",
+      "definitions": [
+         { **SCALAR, "ctype": "int64_t", "body": "return ( %s ) vec;" % FLOAT_REGISTER },
+         { "extension": "neon", "ctype": "int64_t", "body": "return vreinterpretq_f32_s64( vec );" },
+         { "extension": "sse", "ctype": "int64_t", "body": "return _mm_castsi128_ps( vec );" },
+         { "extension": "avx2", "ctype": "int64_t", "body": "return _mm256_castsi256_ps( vec );" },
+         { "extension": "avx512", "ctype": "int64_t", "body": "return _mm512_castsi512_ps( vec );" },
+         { "extension": "avx512", "ctype": "int64_t", "vector_size": "256", "body": "return _mm256_castsi256_ps( vec );" },
+      ],
+   },
+   {
+      "name": "reinterpret_from_float",
+      "brief": "Reinterprets the bits of a float register as integral lanes.",
+      "parameters": [
+         ( FLOAT_REGISTER, "vec", "Vector containing the bits." ),
+      ],
+      "return_type": "typename Vec::register_type",
+      "return_doc": "The same bits as integral register.",
+      "definitions": [
+         { **SCALAR, "ctype": "int64_t", "body": "return ( typename Vec::register_type ) vec;" },
+         { "extension": "neon", "ctype": "int64_t", "body": "return vreinterpretq_s64_f32( vec );" },
+         { "extension": "sse", "ctype": "int64_t", "body": "return _mm_castps_si128( vec );" },
+         { "extension": "avx2", "ctype": "int64_t", "body": "return _mm256_castps_si256( vec );" },
+         { "extension": "avx512", "ctype": "int64_t", "body": "return _mm512_castps_si512( vec );" },
+         { "extension": "avx512", "ctype": "int64_t", "vector_size": "256", "body": "return _mm256_castps_si256( vec );" },
+      ],
+   },
+]
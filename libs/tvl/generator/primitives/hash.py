@@ -0,0 +1,113 @@
+"""Hash primitives. Spec consumed by ../tvl_generator.py."""
+brief = "Hash primitives."
+
+# The scalar backend is specialized for every vector size.
+SCALAR = { "extension": "scalar", "vector_size": "VectorSizeInBits", "template_parameters": "std::size_t VectorSizeInBits" }
+# Processing styles with a native 64-bit lane multiply.
+MUL_NATIVE = [
+   SCALAR,
+   { "extension": "avx512" },
+   { "extension": "avx512", "vector_size": "256" },
+]
+MUL_EMULATED = [
+   { "extension": "neon", "native": False },
+   { "extension": "sse", "native": False },
+   { "extension": "avx2", "native": False },
+]
+
+
+def composed( body ):
+   """The same body, written in terms of other TVL primitives, for every processing style."""
+   return [ { **style, "ctype": "int64_t", "body": body } for style in MUL_NATIVE+MUL_EMULATED ]
+
+
+# Lane-wise CRC32C from the scalar crc32 instruction for ISAs without a vector form.
+CRC32C_LANES = """typename Vec::register_type result{ };
+for( std::size_t i = 0; i < Vec::vector_element_count(); ++i ) {
+   result[ i ] = %s;
+}
+return result;"""
+
+primitives = [
+   {
+      "name": "hash_mix",
+      "brief": "Combines two 64 bit hashes per lane into one (Hash128to64 from cityhash, same as bits::hashMix).",
+      "parameters": [
+         ( "typename Vec::register_type", "upper", "First hash." ),
+         ( "typename Vec::register_type", "lower", "Second hash." ),
+      ],
+      "return_type": "typename Vec::register_type",
+      "return_doc": "Vector containing hashMix( upper[*], lower[*] ).",
+      "definitions": composed( """auto const kMul = tvl::set1< Vec >( 0x9ddfea08eb382d69ULL );
+auto a = tvl::mul< Vec >( tvl::bitwise_xor< Vec >( lower, upper ), kMul );
+a = tvl::bitwise_xor< Vec >( a, tvl::shift_right< Vec >( a, 47 ) );
+auto b = tvl::mul< Vec >( tvl::bitwise_xor< Vec >( upper, a ), kMul );
+b = tvl::bitwise_xor< Vec >( b, tvl::shift_right< Vec >( b, 47 ) );
+return tvl::mul< Vec >( b, kMul );""" ),
+   },
+   {
+      "name": "commutative_hash_mix",
+      "brief": "Combines two 64 bit hashes per lane independent of their order (same as bits::commutativeHashMix).",
+      "parameters": [
+         ( "typename Vec::register_type", "upper", "First hash." ),
+         ( "typename Vec::register_type", "lower", "Second hash." ),
+      ],
+      "return_type": "typename Vec::register_type",
+      "return_doc": "Vector containing commutativeHashMix( upper[*], lower[*] ).",
+      "definitions": composed( """auto sum = tvl::mul< Vec >( tvl::add< Vec >( upper, lower ), tvl::set1< Vec >( 2779 ) );
+auto product = tvl::mul< Vec >( upper, lower );
+return tvl::add< Vec >( tvl::add< Vec >( tvl::set1< Vec >( 3860031 ), sum ), tvl::add< Vec >( product, product ) );""" ),
+   },
+   {
+      "name": "hash_finalize",
+      "brief": "Applies the 64 bit murmur3 finalizer (fmix64) to every lane.",
+      "parameters": [
+         ( "typename Vec::register_type", "vec", "Keys or partial hashes." ),
+      ],
+      "return_type": "typename Vec::register_type",
+      "return_doc": "Vector containing the avalanched values.",
+      "definitions": composed( """auto h = tvl::bitwise_xor< Vec >( vec, tvl::shift_right< Vec >( vec, 33 ) );
+h = tvl::mul< Vec >( h, tvl::set1< Vec >( 0xff51afd7ed558ccdULL ) );
+h = tvl::bitwise_xor< Vec >( h, tvl::shift_right< Vec >( h, 33 ) );
+h = tvl::mul< Vec >( h, tvl::set1< Vec >( 0xc4ceb9fe1a85ec53ULL ) );
+return tvl::bitwise_xor< Vec >( h, tvl::shift_right< Vec >( h, 33 ) );""" ),
+   },
+   {
+      "name": "multiply_shift",
+      "brief": "Multiply-shift hashing: keeps the upper bits of vec[*] * multiplier.",
+      "parameters": [
+         ( "typename Vec::register_type", "vec", "Keys which should be hashed." ),
+         ( "typename Vec::base_type", "multiplier", "Odd multiplier." ),
+         ( "int", "shift", "64 - number of result bits." ),
+      ],
+      "return_type": "typename Vec::register_type",
+      "return_doc": "Vector containing ( vec[*] * multiplier ) >> shift.",
+      "definitions": composed( "return tvl::shift_right< Vec >( tvl::mul< Vec >( vec, tvl::set1< Vec >( multiplier ) ), shift );" ),
+   },
+   {
+      "name": "crc32c",
+      "brief": "Accumulates 8 bytes per lane into a CRC32C (Castagnoli) checksum.",
+      "parameters": [
+         ( "typename Vec::register_type", "crc", "Running checksums (lower 32 bit of every lane)." ),
+         ( "typename Vec::register_type", "data", "Data which should be accumulated." ),
+      ],
+      "return_type": "typename Vec::register_type",
+      "return_doc": "Vector containing the updated checksums (zero extended).",
+      "definitions": [
+         { **SCALAR, "ctype": "int64_t", "body": """typename Vec::register_type result{ };
+for( std::size_t i = 0; i < Vec::vector_element_count(); ++i ) {
+   uint32_t value = static_cast< uint32_t >( crc[ i ] );
+   for( std::size_t bit = 0; bit < 64; ++bit ) {
+      uint32_t carry = ( value ^ ( static_cast< uint64_t >( data[ i ] ) >> bit ) ) & 1;
+      value = ( value >> 1 ) ^ ( 0x82F63B78u & ( 0u - carry ) );
+   }
+   result[ i ] = value;
+}
+return result;""" },
+         { "extension": "neon", "ctype": "int64_t", "native": False, "body": CRC32C_LANES % "__crc32cd( static_cast< uint32_t >( crc[ i ] ), data[ i ] )" },
+      ] + [
+         { **style, "ctype": "int64_t", "native": False, "body": CRC32C_LANES % "_mm_crc32_u64( static_cast< uint32_t >( crc[ i ] ), data[ i ] )" }
+         for style in MUL_NATIVE[ 1: ]+MUL_EMULATED[ 1: ]
+      ],
+   },
+]
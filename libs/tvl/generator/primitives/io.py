@@ -0,0 +1,259 @@
+"""I/O primitives. Spec consumed by ../tvl_generator.py."""
+brief = "I/O primitives."
+
+# The scalar backend is specialized for every vector size.
+SCALAR = { "extension": "scalar", "vector_size": "VectorSizeInBits", "template_parameters": "std::size_t VectorSizeInBits" }
+
+# Without byte granular masked moves the partial load/store goes through an aligned buffer.
+PARTIAL_LOAD = """alignas( Vec::vector_alignment() ) typename Vec::base_type buffer[ Vec::vector_element_count() ]{ };
+__builtin_memcpy( buffer, memory, bytes );
+return tvl::load< Vec >( buffer );"""
+PARTIAL_STORE = """alignas( Vec::vector_alignment() ) typename Vec::base_type buffer[ Vec::vector_element_count() ];
+tvl::store< Vec >( buffer, vec );
+__builtin_memcpy( memory, buffer, bytes );"""
+# Lane wise inserts of the selected lanes, no lane outside of mask is accessed.
+MASKZ_LOAD_SSE = """auto const lanes = _mm_movemask_pd( _mm_castsi128_pd( mask ) );
+auto result = _mm_setzero_si128( );
+if( lanes & 1 ) {
+   result = _mm_insert_epi64( result, memory[ 0 ], 0 );
+}
+if( lanes & 2 ) {
+   result = _mm_insert_epi64( result, memory[ 1 ], 1 );
+}
+return result;"""
+MASKZ_LOAD_NEON = """auto result = vdupq_n_s64( 0 );
+if( vgetq_lane_u64( mask, 0 ) ) {
+   result = vsetq_lane_s64( memory[ 0 ], result, 0 );
+}
+if( vgetq_lane_u64( mask, 1 ) ) {
+   result = vsetq_lane_s64( memory[ 1 ], result, 1 );
+}
+return result;"""
+BYTE_MASK_512 = "auto const mask = bytes >= 64 ? ~__mmask64{ 0 } : ( __mmask64{ 1 } << bytes ) - 1;"
+BYTE_MASK_256 = "auto const mask = static_cast< __mmask32 >( ( uint64_t{ 1 } << bytes ) - 1 );"
+
+primitives = [
+   {
+      "name": "load",
+      "brief": "Loads data from aligned memory into a vector register.",
+      "parameters": [
+         ( "typename Vec::base_type const *", "memory", "Aligned memory which should be transferred into a vector register." ),
+      ],
+      "return_type": "typename Vec::register_type",
+      "return_doc": "Vector containing the loaded data.",
+      "definitions": [
+         { **SCALAR, "ctype": "int64_t", "body": """typename Vec::register_type result{ };
+for( std::size_t i = 0; i < Vec::vector_element_count(); ++i ) {
+   result[ i ] = memory[ i ];
+}
+return result;""" },
+         { "extension": "neon", "ctype": "int64_t", "body": "return vld1q_s64( memory );" },
+         { "extension": "sse", "ctype": "int64_t", "body": "return _mm_load_si128( reinterpret_cast< __m128i const * >( memory ) );" },
+         { "extension": "avx2", "ctype": "int64_t", "body": "return _mm256_load_si256( reinterpret_cast< __m256i const * >( memory ) );" },
+         { "extension": "avx512", "ctype": "int64_t", "body": "return _mm512_load_si512( reinterpret_cast< void const * >( memory ) );" },
+         { "extension": "avx512", "ctype": "int64_t", "vector_size": "256", "body": "return _mm256_load_si256( reinterpret_cast< __m256i const * >( memory ) );" },
+      ],
+   },
+   {
+      "name": "loadu",
+      "brief": "Loads data from (un)aligned memory into a vector register.",
+      "parameters": [
+         ( "typename Vec::base_type const *", "memory", "(Un)aligned memory which should be transferred into a vector register." ),
+      ],
+      "return_type": "typename Vec::register_type",
+      "return_doc": "Vector containing the loaded data.",
+      "definitions": [
+         { **SCALAR, "ctype": "int64_t", "body": """typename Vec::register_type result{ };
+for( std::size_t i = 0; i < Vec::vector_element_count(); ++i ) {
+   result[ i ] = memory[ i ];
+}
+return result;""" },
+         { "extension": "neon", "ctype": "int64_t", "body": "return vld1q_s64( memory );" },
+         { "extension": "sse", "ctype": "int64_t", "body": "return _mm_loadu_si128( reinterpret_cast< __m128i const * >( memory ) );" },
+         { "extension": "avx2", "ctype": "int64_t", "body": "return _mm256_loadu_si256( reinterpret_cast< __m256i const * >( memory ) );" },
+         { "extension": "avx512", "ctype": "int64_t", "body": "return _mm512_loadu_si512( reinterpret_cast< void const * >( memory ) );" },
+         { "extension": "avx512", "ctype": "int64_t", "vector_size": "256", "body": "return _mm256_loadu_si256( reinterpret_cast< __m256i const * >( memory ) );" },
+      ],
+   },
+   {
+      "name": "store",
+      "brief": "Stores a vector register into aligned memory.",
+      "parameters": [
+         ( "typename Vec::base_type *", "memory", "Aligned memory which should receive the vector register." ),
+         ( "typename Vec::register_type", "vec", "Vector which should be stored." ),
+      ],
+      "return_type": "void",
+      "return_doc": "Nothing.",
+      "definitions": [
+         { **SCALAR, "ctype": "int64_t", "body": """for( std::size_t i = 0; i < Vec::vector_element_count(); ++i ) {
+   memory[ i ] = vec[ i ];
+}""" },
+         { "extension": "neon", "ctype": "int64_t", "body": "vst1q_s64( memory, vec );" },
+         { "extension": "sse", "ctype": "int64_t", "body": "_mm_store_si128( reinterpret_cast< __m128i * >( memory ), vec );" },
+         { "extension": "avx2", "ctype": "int64_t", "body": "_mm256_store_si256( reinterpret_cast< __m256i * >( memory ), vec );" },
+         { "extension": "avx512", "ctype": "int64_t", "body": "_mm512_store_si512( reinterpret_cast< void * >( memory ), vec );" },
+         { "extension": "avx512", "ctype": "int64_t", "vector_size": "256", "body": "_mm256_store_si256( reinterpret_cast< __m256i * >( memory ), vec );" },
+      ],
+   },
+   {
+      "name": "storeu",
+      "brief": "Stores a vector register into (un)aligned memory.",
+      "parameters": [
+         ( "typename Vec::base_type *", "memory", "(Un)aligned memory which should receive the vector register." ),
+         ( "typename Vec::register_type", "vec", "Vector which should be stored." ),
+      ],
+      "return_type": "void",
+      "return_doc": "Nothing.",
+      "definitions": [
+         { **SCALAR, "ctype": "int64_t", "body": """for( std::size_t i = 0; i < Vec::vector_element_count(); ++i ) {
+   memory[ i ] = vec[ i ];
+}""" },
+         { "extension": "neon", "ctype": "int64_t", "body": "vst1q_s64( memory, vec );" },
+         { "extension": "sse", "ctype": "int64_t", "body": "_mm_storeu_si128( reinterpret_cast< __m128i * >( memory ), vec );" },
+         { "extension": "avx2", "ctype": "int64_t", "body": "_mm256_storeu_si256( reinterpret_cast< __m256i * >( memory ), vec );" },
+         { "extension": "avx512", "ctype": "int64_t", "body": "_mm512_storeu_si512( reinterpret_cast< void * >( memory ), vec );" },
+         { "extension": "avx512", "ctype": "int64_t", "vector_size": "256", "body": "_mm256_storeu_si256( reinterpret_cast< __m256i * >( memory ), vec );" },
+      ],
+   },
+   {
+      "name": "maskz_loadu",
+      "brief": "Loads the selected lanes from (un)aligned memory and zeroes the others.",
+      "parameters": [
+         ( "typename Vec::base_type const *", "memory", "(Un)aligned memory, lanes which are not selected are not accessed." ),
+         ( "typename Vec::mask_type", "mask", "Vector mask register selecting the lanes to load." ),
+      ],
+      "return_type": "typename Vec::register_type",
+      "return_doc": "Vector containing the loaded lanes and zero in all other lanes.",
+      "definitions": [
+         { **SCALAR, "ctype": "int64_t", "body": """typename Vec::register_type result{ };
+for( std::size_t i = 0; i < Vec::vector_element_count(); ++i ) {
+   result[ i ] = mask[ i ] ? memory[ i ] : 0;
+}
+return result;""" },
+         { "extension": "neon", "ctype": "int64_t", "native": False, "body": MASKZ_LOAD_NEON },
+         { "extension": "sse", "ctype": "int64_t", "native": False, "body": MASKZ_LOAD_SSE },
+         { "extension": "avx2", "ctype": "int64_t", "body": "return _mm256_maskload_epi64( reinterpret_cast< long long const * >( memory ), mask );" },
+         { "extension": "avx512", "ctype": "int64_t", "body": "return _mm512_maskz_loadu_epi64( mask, memory );" },
+         { "extension": "avx512", "ctype": "int64_t", "vector_size": "256", "body": "return _mm256_maskz_loadu_epi64( mask, memory );" },
+      ],
+   },
+   {
+      "name": "loadu_partial",
+      "brief": "Loads the first bytes of a vector register from (un)aligned memory and zeroes the rest.",
+      "parameters": [
+         ( "typename Vec::base_type const *", "memory", "(Un)aligned memory, only [memory, memory + bytes) is accessed." ),
+         ( "int32_t", "bytes", "Number of bytes to load, in [0, vector_size_B()]." ),
+      ],
+      "return_type": "typename Vec::register_type",
+      "return_doc": "Vector containing the loaded bytes followed by zeroes.",
+      "definitions": [
+         { **SCALAR, "ctype": "int64_t", "body": """typename Vec::register_type result{ };
+__builtin_memcpy( &result, memory, bytes );
+return result;""" },
+         { "extension": "neon", "ctype": "int64_t", "native": False, "body": PARTIAL_LOAD },
+         { "extension": "sse", "ctype": "int64_t", "native": False, "body": PARTIAL_LOAD },
+         { "extension": "avx2", "ctype": "int64_t", "native": False, "body": PARTIAL_LOAD },
+         { "extension": "avx512", "ctype": "int64_t", "body": BYTE_MASK_512 + "\nreturn _mm512_maskz_loadu_epi8( mask, memory );" },
+         { "extension": "avx512", "ctype": "int64_t", "vector_size": "256", "body": BYTE_MASK_256 + "\nreturn _mm256_maskz_loadu_epi8( mask, memory );" },
+      ],
+   },
+   {
+      "name": "storeu_partial",
+      "brief": "Stores the first bytes of a vector register into (un)aligned memory.",
+      "parameters": [
+         ( "typename Vec::base_type *", "memory", "(Un)aligned memory, only [memory, memory + bytes) is written." ),
+         ( "typename Vec::register_type", "vec", "Vector which should be stored." ),
+         ( "int32_t", "bytes", "Number of bytes to store, in [0, vector_size_B()]." ),
+      ],
+      "return_type": "void",
+      "return_doc": "Nothing.",
+      "definitions": [
+         { **SCALAR, "ctype": "int64_t", "body": "__builtin_memcpy( memory, &vec, bytes );" },
+         { "extension": "neon", "ctype": "int64_t", "native": False, "body": PARTIAL_STORE },
+         { "extension": "sse", "ctype": "int64_t", "native": False, "body": PARTIAL_STORE },
+         { "extension": "avx2", "ctype": "int64_t", "native": False, "body": PARTIAL_STORE },
+         { "extension": "avx512", "ctype": "int64_t", "body": BYTE_MASK_512 + "\n_mm512_mask_storeu_epi8( memory, mask, vec );" },
+         { "extension": "avx512", "ctype": "int64_t", "vector_size": "256", "body": BYTE_MASK_256 + "\n_mm256_mask_storeu_epi8( memory, mask, vec );" },
+      ],
+   },
+   {
+      "name": "stream",
+      "brief": "Stores a vector register into aligned memory bypassing the caches (non-temporal store).",
+      "parameters": [
+         ( "typename Vec::base_type *", "memory", "Aligned memory which should receive the vector register." ),
+         ( "typename Vec::register_type", "vec", "Vector which should be stored." ),
+      ],
+      "return_type": "void",
+      "return_doc": "Nothing. Call stream_fence before the memory is handed to another thread.",
+      "definitions": [
+         { **SCALAR, "ctype": "int64_t", "native": False, "body": "tvl::store< Vec >( memory, vec );" },
+         { "extension": "neon", "ctype": "int64_t", "native": False, "body": "vst1q_s64( memory, vec );" },
+         { "extension": "sse", "ctype": "int64_t", "body": "_mm_stream_si128( reinterpret_cast< __m128i * >( memory ), vec );" },
+         { "extension": "avx2", "ctype": "int64_t", "body": "_mm256_stream_si256( reinterpret_cast< __m256i * >( memory ), vec );" },
+         { "extension": "avx512", "ctype": "int64_t", "body": "_mm512_stream_si512( reinterpret_cast< __m512i * >( memory ), vec );" },
+         { "extension": "avx512", "ctype": "int64_t", "vector_size": "256", "body": "_mm256_stream_si256( reinterpret_cast< __m256i * >( memory ), vec );" },
+      ],
+   },
+   {
+      "name": "stream_fence",
+      "brief": "Orders preceding stream stores before all following stores.",
+      "parameters": [ ],
+      "return_type": "void",
+      "return_doc": "Nothing.",
+      "definitions": [
+         { **SCALAR, "ctype": "int64_t", "body": "// stream is a regular store." },
+         { "extension": "neon", "ctype": "int64_t", "body": "// stream is a regular store." },
+         { "extension": "sse", "ctype": "int64_t", "body": "_mm_sfence( );" },
+         { "extension": "avx2", "ctype": "int64_t", "body": "_mm_sfence( );" },
+         { "extension": "avx512", "ctype": "int64_t", "body": "_mm_sfence( );" },
+         { "extension": "avx512", "ctype": "int64_t", "vector_size": "256", "body": "_mm_sfence( );" },
+      ],
+   },
+   {
+      "name": "set1",
+      "brief": "Broadcasts a single value into all lanes of a vector register.",
+      "parameters": [
+         ( "typename Vec::base_type", "value", "Value which should be broadcasted." ),
+      ],
+      "return_type": "typename Vec::register_type",
+      "return_doc": "Vector containing the same value in all lanes.",
+      "definitions": [
+         { **SCALAR, "ctype": "int64_t", "body": """typename Vec::register_type result{ };
+for( std::size_t i = 0; i < Vec::vector_element_count(); ++i ) {
+   result[ i ] = value;
+}
+return result;""" },
+         { "extension": "neon", "ctype": "int64_t", "body": "return vdupq_n_s64( value );" },
+         { "extension": "sse", "ctype": "int64_t", "body": "return _mm_set1_epi64x( value );" },
+         { "extension": "avx2", "ctype": "int64_t", "body": "return _mm256_set1_epi64x( value );" },
+         { "extension": "avx512", "ctype": "int64_t", "body": "return _mm512_set1_epi64( value );" },
+         { "extension": "avx512", "ctype": "int64_t", "vector_size": "256", "body": "return _mm256_set1_epi64x( value );" },
+      ],
+   },
+   {
+      "name": "gather",
+      "brief": "Transfers data from arbitrary locations into a vector register.",
+      "parameters": [
+         ( "typename Vec::register_type", "source", "Vector register containing values which should be preserved depending on the mask (if mask[i] == 0)." ),
+         ( "typename Vec::base_type const *", "memory", "(Start)pointer of the memory (which is used as base for address calculation)." ),
+         ( "typename Vec::register_type", "index", "Offsets (in base_type granularity) relative to the start pointer." ),
+         ( "typename Vec::mask_type", "mask", "Mask indicating which lanes should be gathered." ),
+      ],
+      "return_type": "typename Vec::register_type",
+      "return_doc": "Vector containing gathered data.",
+      "definitions": [
+         { **SCALAR, "ctype": "int64_t", "body": """typename Vec::register_type result{ };
+for( std::size_t i = 0; i < Vec::vector_element_count(); ++i ) {
+   result[ i ] = ( mask[ i ] == 0 ) ? source[ i ] : memory[ index[ i ] ];
+}
+return result;""" },
+         { "extension": "neon", "ctype": "int64_t", "native": False, "body": """auto tmp = vdupq_n_s64( ( mask[ 0 ] == 0 ) ? source[ 0 ] : memory[ index[ 0 ] ] );
+return vsetq_lane_s64( ( ( mask[ 1 ] == 0 ) ? source[ 1 ] : memory[ index[ 1 ] ] ), tmp, 1 );
+""" },
+         { "extension": "sse", "ctype": "int64_t", "native": False, "body": "return _mm_set_epi64x( ( mask[ 1 ] == 0 ) ? source[ 1 ] : memory[ index[ 1 ] ], ( mask[ 0 ] == 0 ) ? source[ 0 ] : memory[ index[ 0 ] ] );" },
+         { "extension": "avx2", "ctype": "int64_t", "body": "return _mm256_mask_i64gather_epi64( source, reinterpret_cast< long long int const * >( memory ), index, mask, 8 );" },
+         { "extension": "avx512", "ctype": "int64_t", "body": "return _mm512_mask_i64gather_epi64( source, mask, index, reinterpret_cast< void const * >( memory ), 8 );" },
+         { "extension": "avx512", "ctype": "int64_t", "vector_size": "256", "body": "return _mm256_mmask_i64gather_epi64( source, mask, index, reinterpret_cast< void const * >( memory ), 8 );" },
+      ],
+   },
+]
@@ -0,0 +1,192 @@
+"""Mask related primitives. Spec consumed by ../tvl_generator.py."""
+brief = "Mask related primitives."
+
+# The scalar backend is specialized for every vector size.
+SCALAR = { "extension": "scalar", "vector_size": "VectorSizeInBits", "template_parameters": "std::size_t VectorSizeInBits" }
+
+# Lane indices of every set bit of a mask, padded with 0. Used as a lookup table
+# by the processing styles without a compress instruction.
+def lane_table( lanes ):
+   rows = []
+   for mask in range( 1 << lanes ):
+      row = [ lane for lane in range( lanes ) if mask & ( 1 << lane ) ]
+      rows.append( "{ " + ", ".join( str( lane ) for lane in row+[ 0 ]*( lanes-len( row ) ) ) + " }" )
+   return "alignas( %d ) static constexpr int32_t kLanes[ %d ][ %d ] = {\n   %s\n};" % (
+      4*lanes, 1 << lanes, lanes, ",\n   ".join( rows ) )
+
+primitives = [
+   {
+      "name": "to_integral",
+      "brief": "Forms an integral value from the most significant bits of every lane in a vector mask register.",
+      "parameters": [
+         ( "typename Vec::mask_type", "vec_mask", "Vector mask register containing mask style data." ),
+      ],
+      "return_type": "typename Vec::base_type",
+      "return_doc": "Integral value representing the vector mask register.",
+      "definitions": [
+         { **SCALAR, "ctype": "int64_t", "body": """typename Vec::base_type result = 0;
+for( std::size_t i = 0; i < Vec::vector_element_count(); ++i ) {
+   result |= ( ( static_cast< uint64_t >( vec_mask[ i ] ) >> 63 ) << i );
+}
+return result;""" },
+         { "extension": "neon", "ctype": "int64_t", "native": False, "body": "return ( ( vec_mask[ 1 ] >> 62 ) & 0b10 ) | ( vec_mask[ 0 ] >> 63 );" },
+         { "extension": "sse", "ctype": "int64_t", "body": "return _mm_movemask_pd( _mm_castsi128_pd( vec_mask ) );" },
+         { "extension": "avx2", "ctype": "int64_t", "body": "return _mm256_movemask_pd( _mm256_castsi256_pd( vec_mask ) );" },
+         { "extension": "avx512", "ctype": "int64_t", "body": "return vec_mask; //mask is integral already." },
+         { "extension": "avx512", "ctype": "int64_t", "vector_size": "256", "body": "return vec_mask; //mask is integral already." },
+      ],
+   },
+   {
+      "name": "from_integral",
+      "brief": "Forms a vector mask register from the lower bits of an integral value (inverse of to_integral).",
+      "parameters": [
+         ( "typename Vec::base_type", "mask", "Integral value, bit i selects lane i." ),
+      ],
+      "return_type": "typename Vec::mask_type",
+      "return_doc": "Vector mask register selecting the lanes whose bit is set.",
+      "definitions": [
+         { **SCALAR, "ctype": "int64_t", "body": """typename Vec::mask_type result{ };
+for( std::size_t i = 0; i < Vec::vector_element_count(); ++i ) {
+   result[ i ] = ( ( mask >> i ) & 1 ) ? -1 : 0;
+}
+return result;""" },
+         { "extension": "neon", "ctype": "int64_t", "body": """int64_t const lane_bits[ 2 ] = { 1, 2 };
+return vtstq_s64( vdupq_n_s64( mask ), vld1q_s64( lane_bits ) );""" },
+         { "extension": "sse", "ctype": "int64_t", "body": """auto const lane_bits = _mm_set_epi64x( 2, 1 );
+return _mm_cmpeq_epi64( _mm_and_si128( _mm_set1_epi64x( mask ), lane_bits ), lane_bits );""" },
+         { "extension": "avx2", "ctype": "int64_t", "body": """auto const lane_bits = _mm256_setr_epi64x( 1, 2, 4, 8 );
+return _mm256_cmpeq_epi64( _mm256_and_si256( _mm256_set1_epi64x( mask ), lane_bits ), lane_bits );""" },
+         { "extension": "avx512", "ctype": "int64_t", "body": "return mask; //mask is integral already." },
+         { "extension": "avx512", "ctype": "int64_t", "vector_size": "256", "body": "return mask & 0xF; //mask is integral already." },
+      ],
+   },
+   {
+      "name": "leading_mask",
+      "brief": "Forms a vector mask register selecting the first lanes, e.g. for the ragged tail of a batch.",
+      "parameters": [
+         ( "int32_t", "count", "Number of selected lanes, in [0, vector_element_count()]." ),
+      ],
+      "return_type": "typename Vec::mask_type",
+      "return_doc": "Vector mask register selecting the lanes [0, count).",
+      "definitions": [
+         { **SCALAR, "ctype": "int64_t", "body": """typename Vec::mask_type result{ };
+for( std::size_t i = 0; i < Vec::vector_element_count(); ++i ) {
+   result[ i ] = static_cast< int32_t >( i ) < count ? -1 : 0;
+}
+return result;""" },
+         # Sliding window over vector_element_count() set lanes followed by as many clear lanes.
+         { "extension": "neon", "ctype": "int64_t", "body": """static constexpr uint64_t kLeading[ 4 ] = { ~0ULL, ~0ULL, 0, 0 };
+return vld1q_u64( kLeading + 2 - count );""" },
+         { "extension": "sse", "ctype": "int64_t", "body": """static constexpr int64_t kLeading[ 4 ] = { -1, -1, 0, 0 };
+return _mm_loadu_si128( reinterpret_cast< __m128i const * >( kLeading + 2 - count ) );""" },
+         { "extension": "avx2", "ctype": "int64_t", "body": """static constexpr int64_t kLeading[ 8 ] = { -1, -1, -1, -1, 0, 0, 0, 0 };
+return _mm256_loadu_si256( reinterpret_cast< __m256i const * >( kLeading + 4 - count ) );""" },
+         { "extension": "avx512", "ctype": "int64_t", "body": "return static_cast< __mmask8 >( ( 1U << count ) - 1 );" },
+         { "extension": "avx512", "ctype": "int64_t", "vector_size": "256", "body": "return static_cast< __mmask8 >( ( 1U << count ) - 1 );" },
+      ],
+   },
+   {
+      "name": "get_msb",
+      "brief": "Retrieves the most significant bit of every element in a vector register and sets the corresponding bit in a base type.",
+      "parameters": [
+         ( "typename Vec::register_type", "vec", "Vector mask register containing mask style data." ),
+      ],
+      "return_type": "typename Vec::base_type",
+      "return_doc": "Integral value representing the vector mask register.",
+      "definitions": [
+         { **SCALAR, "ctype": "int64_t", "body": """typename Vec::base_type result = 0;
+for( std::size_t i = 0; i < Vec::vector_element_count(); ++i ) {
+   result |= ( ( static_cast< uint64_t >( vec[ i ] ) >> 63 ) << i );
+}
+return result;""" },
+         { "extension": "neon", "ctype": "int64_t", "native": False, "body": "return ( ( vec[ 1 ] >> 62 ) & 0b10 ) | ( vec[ 0 ] >> 63 );" },
+         { "extension": "sse", "ctype": "int64_t", "body": "return _mm_movemask_pd( _mm_castsi128_pd( vec ) );" },
+         { "extension": "avx2", "ctype": "int64_t", "body": "return _mm256_movemask_pd( _mm256_castsi256_pd( vec ) );" },
+         { "extension": "avx512", "ctype": "int64_t", "body": "return _mm512_movepi64_mask( vec );" },
+         { "extension": "avx512", "ctype": "int64_t", "vector_size": "256", "body": "return _mm256_movepi64_mask( vec );" },
+      ],
+   },
+   {
+      "name": "to_vector",
+      "brief": "Forms an vector register from an integral where all bits are set in a lane if the corresponding mask bit is set to 1.",
+      "parameters": [
+         ( "typename Vec::mask_type", "mask", "Vector mask register containing mask style data." ),
+      ],
+      "return_type": "typename Vec::register_type",
+      "return_doc": "Integral value representing the vector mask register.",
+      "definitions": [
+         { **SCALAR, "ctype": "int64_t", "body": "return mask; //mask is a vector already." },
+         { "extension": "neon", "ctype": "int64_t", "body": "return vreinterpretq_s64_u64( mask ); //mask is a vector already." },
+         { "extension": "sse", "ctype": "int64_t", "body": "return mask; //mask is a vector already." },
+         { "extension": "avx2", "ctype": "int64_t", "body": "return mask; //mask is a vector already." },
+         { "extension": "avx512", "ctype": "int64_t", "body": "return _mm512_maskz_set1_epi64( mask, -1 );" },
+         { "extension": "avx512", "ctype": "int64_t", "vector_size": "256", "body": "return _mm256_maskz_set1_epi64( mask, -1 );" },
+      ],
+   },
+   {
+      "name": "mask_reduce",
+      "brief": "Masks out every non relevant bit.",
+      "parameters": [
+         ( "typename Vec::base_type", "mask", "Integral value containing n (set) bits." ),
+      ],
+      "return_type": "typename Vec::base_type",
+      "return_doc": "Integral value with only relevant bits set (or not).",
+      "definitions": [
+         { **SCALAR, "ctype": "int64_t", "body": "return mask & ( ( 1ULL << Vec::vector_element_count() ) - 1 );" },
+         { "extension": "neon", "ctype": "int64_t", "body": "return mask & 0x3;" },
+         { "extension": "sse", "ctype": "int64_t", "body": "return mask & 0x3;" },
+         { "extension": "avx2", "ctype": "int64_t", "body": "return mask & 0xF;" },
+         { "extension": "avx512", "ctype": "int64_t", "body": "return mask & 0xFF; //mask is integral already." },
+         { "extension": "avx512", "ctype": "int64_t", "vector_size": "256", "body": "return mask & 0xF; //mask is integral already." },
+      ],
+   },
+   {
+      "name": "mask_popcount",
+      "brief": "Counts the relevant set bits of an integral mask.",
+      "parameters": [
+         ( "typename Vec::base_type", "mask", "Integral value containing n (set) bits (see to_integral and get_msb)." ),
+      ],
+      "return_type": "typename Vec::base_type",
+      "return_doc": "Number of lanes selected by mask.",
+      "definitions": [
+         { **SCALAR, "ctype": "int64_t", "body": "return __builtin_popcountll( mask & ( ( 1ULL << Vec::vector_element_count() ) - 1 ) );" },
+         { "extension": "neon", "ctype": "int64_t", "body": "return __builtin_popcount( mask & 0x3 );" },
+         { "extension": "sse", "ctype": "int64_t", "body": "return _mm_popcnt_u32( mask & 0x3 );" },
+         { "extension": "avx2", "ctype": "int64_t", "body": "return _mm_popcnt_u32( mask & 0xF );" },
+         { "extension": "avx512", "ctype": "int64_t", "body": "return _mm_popcnt_u32( mask & 0xFF );" },
+         { "extension": "avx512", "ctype": "int64_t", "vector_size": "256", "body": "return _mm_popcnt_u32( mask & 0xF );" },
+      ],
+   },
+   {
+      "name": "mask_lane_indices",
+      "brief": "Writes the indices of the lanes selected by an integral mask in ascending order.",
+      "parameters": [
+         ( "typename Vec::base_type", "mask", "Integral value containing n (set) bits (see to_integral and get_msb)." ),
+         ( "int32_t *", "indices", "Destination, must have room for Vec::vector_element_count() values. Entries past the returned count are unspecified." ),
+      ],
+      "return_type": "typename Vec::base_type",
+      "return_doc": "Number of indices written (same as mask_popcount).",
+      "definitions": [
+         { **SCALAR, "ctype": "int64_t", "body": """typename Vec::base_type count = 0;
+for( uint64_t bits = mask & ( ( 1ULL << Vec::vector_element_count() ) - 1 ); bits != 0; bits &= bits - 1 ) {
+   indices[ count++ ] = __builtin_ctzll( bits );
+}
+return count;""" },
+         { "extension": "neon", "ctype": "int64_t", "body": lane_table( 2 ) + """
+vst1_s32( indices, vld1_s32( kLanes[ mask & 0x3 ] ) );
+return __builtin_popcount( mask & 0x3 );""" },
+         { "extension": "sse", "ctype": "int64_t", "body": lane_table( 2 ) + """
+_mm_storel_epi64( reinterpret_cast< __m128i * >( indices ), _mm_loadl_epi64( reinterpret_cast< __m128i const * >( kLanes[ mask & 0x3 ] ) ) );
+return _mm_popcnt_u32( mask & 0x3 );""" },
+         { "extension": "avx2", "ctype": "int64_t", "body": lane_table( 4 ) + """
+_mm_storeu_si128( reinterpret_cast< __m128i * >( indices ), _mm_load_si128( reinterpret_cast< __m128i const * >( kLanes[ mask & 0xF ] ) ) );
+return _mm_popcnt_u32( mask & 0xF );""" },
+         { "extension": "avx512", "ctype": "int64_t", "body": """auto const lanes = _mm256_setr_epi32( 0, 1, 2, 3, 4, 5, 6, 7 );
+_mm256_storeu_si256( reinterpret_cast< __m256i * >( indices ), _mm256_maskz_compress_epi32( static_cast< __mmask8 >( mask ), lanes ) );
+return _mm_popcnt_u32( mask & 0xFF );""" },
+         { "extension": "avx512", "ctype": "int64_t", "vector_size": "256", "body": """auto const lanes = _mm_setr_epi32( 0, 1, 2, 3 );
+_mm_storeu_si128( reinterpret_cast< __m128i * >( indices ), _mm_maskz_compress_epi32( static_cast< __mmask8 >( mask & 0xF ), lanes ) );
+return _mm_popcnt_u32( mask & 0xF );""" },
+      ],
+   },
+]
@@ -0,0 +1,136 @@
+"""Permutation and lookup primitives. Spec consumed by ../tvl_generator.py."""
+brief = "Permutation and lookup primitives."
+
+# The scalar backend is specialized for every vector size.
+SCALAR = { "extension": "scalar", "vector_size": "VectorSizeInBits", "template_parameters": "std::size_t VectorSizeInBits" }
+# Byte wise access to a scalar register (registers are declared __may_alias__).
+SCALAR_BYTES = """typename Vec::register_type result{ };
+auto const * bytes = reinterpret_cast< uint8_t const * >( &%s );
+auto const * selectors = reinterpret_cast< uint8_t const * >( &indices );
+auto * out = reinterpret_cast< uint8_t * >( &result );
+for( std::size_t i = 0; i < Vec::vector_size_B(); ++i ) {
+   out[ i ] = %s;
+}
+return result;"""
+# vpermd on the 32 bit halves of every selected 64 bit lane.
+PERMUTE_AVX2 = """auto const doubled = _mm256_slli_epi64( _mm256_and_si256( indices, _mm256_set1_epi64x( 3 ) ), 1 );
+auto const halves = _mm256_or_si256( doubled, _mm256_slli_epi64( _mm256_add_epi64( doubled, _mm256_set1_epi64x( 1 ) ), 32 ) );
+return _mm256_permutevar8x32_epi32( vec, halves );"""
+# Byte indices ( index * 8 + [0..7] ) of every selected 64 bit lane for pshufb/tbl.
+PERMUTE_SSE = """auto const first_bytes = _mm_slli_epi64( _mm_and_si128( indices, _mm_set1_epi64x( 1 ) ), 3 );
+auto const bytes = _mm_add_epi8(
+   _mm_shuffle_epi8( first_bytes, _mm_setr_epi8( 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8 ) ),
+   _mm_setr_epi8( 0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 6, 7 )
+);
+return _mm_shuffle_epi8( vec, bytes );"""
+NEON_LANE_BYTES = """auto const first_bytes = vreinterpretq_u8_s64( vshlq_n_s64( vandq_s64( indices, vdupq_n_s64( %d ) ), 3 ) );
+uint8_t const broadcast[ 16 ] = { 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8 };
+uint8_t const offsets[ 16 ] = { 0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 6, 7 };
+auto const bytes = vaddq_u8( vqtbl1q_u8( first_bytes, vld1q_u8( broadcast ) ), vld1q_u8( offsets ) );"""
+# Both sources permuted, the bit above the lane index selects vec_b.
+PERMUTE2 = """auto const from_b = {p}_cmpeq_epi64( {p}_and_{si}( indices, {set1}( {n} ) ), {set1}( {n} ) );
+return {p}_blendv_epi8( tvl::permute< Vec >( vec_a, indices ), tvl::permute< Vec >( vec_b, indices ), from_b );"""
+# 16 byte pshufb per table chunk, the upper index bits select the chunk.
+LOOKUP_AVX2 = """auto const selectors = _mm256_and_si256( indices, _mm256_set1_epi8( 0x1F ) );
+auto const low = _mm256_shuffle_epi8( _mm256_permute2x128_si256( table, table, 0x00 ), selectors );
+auto const high = _mm256_shuffle_epi8( _mm256_permute2x128_si256( table, table, 0x11 ), selectors );
+return _mm256_blendv_epi8( low, high, _mm256_slli_epi16( selectors, 3 ) );"""
+LOOKUP_AVX512 = """auto const selectors = _mm512_and_si512( indices, _mm512_set1_epi8( 0x3F ) );
+auto const odd = _mm512_test_epi8_mask( selectors, _mm512_set1_epi8( 0x10 ) );
+auto const low = _mm512_mask_shuffle_epi8(
+   _mm512_shuffle_epi8( _mm512_shuffle_i64x2( table, table, 0x00 ), selectors ), odd,
+   _mm512_shuffle_i64x2( table, table, 0x55 ), selectors
+);
+auto const high = _mm512_mask_shuffle_epi8(
+   _mm512_shuffle_epi8( _mm512_shuffle_i64x2( table, table, 0xAA ), selectors ), odd,
+   _mm512_shuffle_i64x2( table, table, 0xFF ), selectors
+);
+return _mm512_mask_blend_epi8( _mm512_test_epi8_mask( selectors, _mm512_set1_epi8( 0x20 ) ), low, high );"""
+
+primitives = [
+   {
+      "name": "permute",
+      "brief": "Rearranges the lanes of a vector register.",
+      "parameters": [
+         ( "typename Vec::register_type", "vec", "Vector containing the values." ),
+         ( "typename Vec::register_type", "indices", "Source lane for every result lane (only the lower log2( vector_element_count() ) bits are used)." ),
+      ],
+      "return_type": "typename Vec::register_type",
+      "return_doc": "Vector containing vec[ indices[*] ].",
+      "definitions": [
+         { **SCALAR, "ctype": "int64_t", "body": """typename Vec::register_type result{ };
+for( std::size_t i = 0; i < Vec::vector_element_count(); ++i ) {
+   result[ i ] = vec[ indices[ i ] & ( Vec::vector_element_count() - 1 ) ];
+}
+return result;""" },
+         { "extension": "neon", "ctype": "int64_t", "native": False, "body": NEON_LANE_BYTES % 1 + """
+return vreinterpretq_s64_u8( vqtbl1q_u8( vreinterpretq_u8_s64( vec ), bytes ) );""" },
+         { "extension": "sse", "ctype": "int64_t", "native": False, "body": PERMUTE_SSE },
+         { "extension": "avx2", "ctype": "int64_t", "native": False, "body": PERMUTE_AVX2 },
+         { "extension": "avx512", "ctype": "int64_t", "body": "return _mm512_permutexvar_epi64( indices, vec );" },
+         { "extension": "avx512", "ctype": "int64_t", "vector_size": "256", "body": "return _mm256_permutexvar_epi64( indices, vec );" },
+      ],
+   },
+   {
+      "name": "permute2",
+      "brief": "Selects lanes from the concatenation of two vector registers.",
+      "parameters": [
+         ( "typename Vec::register_type", "vec_a", "Vector containing the lanes [0, vector_element_count())." ),
+         ( "typename Vec::register_type", "vec_b", "Vector containing the lanes [vector_element_count(), 2 * vector_element_count())." ),
+         ( "typename Vec::register_type", "indices", "Source lane for every result lane (only the lower log2( vector_element_count() ) + 1 bits are used)." ),
+      ],
+      "return_type": "typename Vec::register_type",
+      "return_doc": "Vector containing { vec_a, vec_b }[ indices[*] ].",
+      "definitions": [
+         { **SCALAR, "ctype": "int64_t", "body": """typename Vec::register_type result{ };
+for( std::size_t i = 0; i < Vec::vector_element_count(); ++i ) {
+   auto const index = indices[ i ] & ( 2 * Vec::vector_element_count() - 1 );
+   result[ i ] = index < Vec::vector_element_count() ? vec_a[ index ] : vec_b[ index - Vec::vector_element_count() ];
+}
+return result;""" },
+         { "extension": "neon", "ctype": "int64_t", "native": False, "body": NEON_LANE_BYTES % 3 + """
+return vreinterpretq_s64_u8( vqtbl2q_u8( uint8x16x2_t{ { vreinterpretq_u8_s64( vec_a ), vreinterpretq_u8_s64( vec_b ) } }, bytes ) );""" },
+         { "extension": "sse", "ctype": "int64_t", "native": False, "body": PERMUTE2.format( p = "_mm", si = "si128", set1 = "_mm_set1_epi64x", n = 2 ) },
+         { "extension": "avx2", "ctype": "int64_t", "native": False, "body": PERMUTE2.format( p = "_mm256", si = "si256", set1 = "_mm256_set1_epi64x", n = 4 ) },
+         { "extension": "avx512", "ctype": "int64_t", "body": "return _mm512_permutex2var_epi64( vec_a, indices, vec_b );" },
+         { "extension": "avx512", "ctype": "int64_t", "vector_size": "256", "body": "return _mm256_permutex2var_epi64( vec_a, indices, vec_b );" },
+      ],
+   },
+   {
+      "name": "lookup_bytes",
+      "brief": "Looks up every byte of indices in a table held in one vector register.",
+      "parameters": [
+         ( "typename Vec::register_type", "table", "Table of vector_size_B() bytes." ),
+         ( "typename Vec::register_type", "indices", "Byte indices into table (only the lower log2( vector_size_B() ) bits are used)." ),
+      ],
+      "return_type": "typename Vec::register_type",
+      "return_doc": "Register containing the bytes table[ indices[*] ].",
+      "definitions": [
+         { **SCALAR, "ctype": "int64_t", "body": SCALAR_BYTES % ( "table", "bytes[ selectors[ i ] & ( Vec::vector_size_B() - 1 ) ]" ) },
+         { "extension": "neon", "ctype": "int64_t", "body": "return vreinterpretq_s64_u8( vqtbl1q_u8( vreinterpretq_u8_s64( table ), vandq_u8( vreinterpretq_u8_s64( indices ), vdupq_n_u8( 0x0F ) ) ) );" },
+         { "extension": "sse", "ctype": "int64_t", "body": "return _mm_shuffle_epi8( table, _mm_and_si128( indices, _mm_set1_epi8( 0x0F ) ) );" },
+         { "extension": "avx2", "ctype": "int64_t", "native": False, "body": LOOKUP_AVX2 },
+         # vpermb needs AVX512VBMI (Ice Lake and later), which the avx512 backend does not require.
+         { "extension": "avx512", "ctype": "int64_t", "native": False, "body": "#ifdef __AVX512VBMI__\nreturn _mm512_permutexvar_epi8( indices, table );\n#else\n" + LOOKUP_AVX512 + "\n#endif" },
+         { "extension": "avx512", "ctype": "int64_t", "vector_size": "256", "native": False, "body": "#ifdef __AVX512VBMI__\nreturn _mm256_permutexvar_epi8( indices, table );\n#else\n" + LOOKUP_AVX2 + "\n#endif" },
+      ],
+   },
+   {
+      "name": "shuffle_bytes",
+      "brief": "Shuffles the bytes within every 128 bit lane of a vector register (pshufb semantics).",
+      "parameters": [
+         ( "typename Vec::register_type", "vec", "Vector containing the bytes." ),
+         ( "typename Vec::register_type", "indices", "Byte index within the same 128 bit lane, the result byte is zero if bit 7 is set." ),
+      ],
+      "return_type": "typename Vec::register_type",
+      "return_doc": "Register containing the shuffled bytes.",
+      "definitions": [
+         { **SCALAR, "ctype": "int64_t", "body": SCALAR_BYTES % ( "vec", "( selectors[ i ] & 0x80 ) ? 0 : bytes[ ( i & ~std::size_t{ 15 } ) | ( selectors[ i ] & 0x0F ) ]" ) },
+         { "extension": "neon", "ctype": "int64_t", "body": "return vreinterpretq_s64_u8( vqtbl1q_u8( vreinterpretq_u8_s64( vec ), vandq_u8( vreinterpretq_u8_s64( indices ), vdupq_n_u8( 0x8F ) ) ) );" },
+         { "extension": "sse", "ctype": "int64_t", "body": "return _mm_shuffle_epi8( vec, indices );" },
+         { "extension": "avx2", "ctype": "int64_t", "body": "return _mm256_shuffle_epi8( vec, indices );" },
+         { "extension": "avx512", "ctype": "int64_t", "body": "return _mm512_shuffle_epi8( vec, indices );" },
+         { "extension": "avx512", "ctype": "int64_t", "vector_size": "256", "body": "return _mm256_shuffle_epi8( vec, indices );" },
+      ],
+   },
+]
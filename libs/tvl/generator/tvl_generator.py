@@ -0,0 +1,242 @@
+#!/usr/bin/env python3
+"""Generates libs/tvl/generated from the primitive and extension specs.
+
+The specs live next to this script:
+  extensions.py       target extensions (register and mask types, includes)
+  primitives/*.py     one file per primitive group (declaration and all definitions)
+  templates/*.template
+                      the layout of every emitted file (string.Template syntax)
+
+Only the Python standard library is used, so the generator runs wherever CMake
+finds a Python 3 interpreter (see the tvl_generate and tvl_check_generated
+targets in the top level CMakeLists.txt).
+"""
+import argparse
+import os
+import runpy
+import sys
+from string import Template
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+DEFAULT_OUT = os.path.normpath(os.path.join(HERE, "..", "generated"))
+DATE = "17.02.2022"
+# Primitive groups in the order their definitions are included by tvl_generated.hpp.
+GROUP_ORDER = ["compare", "mask", "calc", "bits", "io", "convert", "permute", "hash"]
+
+
+def load_template(name):
+    with open(os.path.join(HERE, "templates", name + ".template")) as f:
+        return Template(f.read())
+
+
+TEMPLATES = {name: load_template(name) for name in
+             ["license", "file", "collection", "declaration", "definition", "extension"]}
+LICENSE = TEMPLATES["license"].template
+
+
+def guard(path):
+    return "TUD_D2RG_TVL_" + path.replace("/", "_").replace(".", "_").upper()
+
+
+def render_file(path, brief, includes, body):
+    return TEMPLATES["file"].substitute(
+        license=LICENSE, path=path, date=DATE, brief=brief, guard=guard(path),
+        includes="".join("#include %s\n" % inc for inc in includes), body=body)
+
+
+def doc_comment(primitive):
+    lines = ["   /*", "    * @brief " + primitive["brief"], "    * @details todo."]
+    for _, name, description in primitive["parameters"]:
+        lines.append("    * @param %s %s" % (name, description))
+    lines.append("    * @return " + primitive["return_doc"])
+    lines.append("    */")
+    return "\n".join(lines)
+
+
+def parameter_list(primitive, indent):
+    params = primitive["parameters"]
+    return "\n".join(
+        "%s%s  %s%s" % (indent, ctype, name, ", " if i + 1 < len(params) else "")
+        for i, (ctype, name, _) in enumerate(params))
+
+
+def vec_name(definition):
+    size = definition.get("vector_size")
+    if size is None:
+        return "simd< %s, %s  >" % (definition["ctype"], definition["extension"])
+    return "simd< %s, %s, %s >" % (definition["ctype"], definition["extension"], size)
+
+
+def native(definition):
+    return definition.get("native", True)
+
+
+def attributes(primitive, indent, warning=""):
+    """Attribute line in front of a declaration or definition. Primitives returning void are not nodiscard."""
+    if primitive["return_type"] != "void":
+        return "%s[[nodiscard]] %s\n" % (indent, warning)
+    return "%s%s\n" % (indent, warning) if warning else ""
+
+
+def render_declaration(primitive):
+    return TEMPLATES["declaration"].substitute(
+        name=primitive["name"], doc=doc_comment(primitive), return_type=primitive["return_type"],
+        attributes=attributes(primitive, "   "),
+        parameters=parameter_list(primitive, "      "),
+        arguments=", ".join(name for _, name, _ in primitive["parameters"]))
+
+
+def render_definition(primitive, definition):
+    body = definition["body"]
+    if native(definition) and "\n" not in body:
+        rendered_body = body
+    else:
+        lines = []
+        if not native(definition):
+            lines.append(
+                'static_assert( !std::is_same_v< Idof, native >, "The primitive %s is not supported by '
+                'your hardware natively while it is forced by using native" );' % primitive["name"])
+        lines.extend(body.split("\n"))
+        rendered_body = "".join("\n" + ("            " + line if line else "") for line in lines)
+    template_parameters = definition.get("template_parameters")
+    return TEMPLATES["definition"].substitute(
+        name=primitive["name"], vec=vec_name(definition),
+        template_parameters=(template_parameters + ", ") if template_parameters else "",
+        native="true" if native(definition) else "false", doc=doc_comment(primitive),
+        attributes=attributes(primitive, "         ", "" if native(definition) else "TVL_NO_NATIVE_SUPPORT_WARNING"),
+        return_type=primitive["return_type"], parameters=parameter_list(primitive, "            "),
+        body=rendered_body, extension=definition["extension"], ctype=definition["ctype"])
+
+
+def render_extension(extension):
+    return TEMPLATES["extension"].substitute(extension)
+
+
+def load_specs():
+    extensions = runpy.run_path(os.path.join(HERE, "extensions.py"))["extensions"]
+    groups = {}
+    for name in GROUP_ORDER:
+        groups[name] = runpy.run_path(os.path.join(HERE, "primitives", name + ".py"))
+    known = {e["name"] for e in extensions}
+    for group in groups.values():
+        for primitive in group["primitives"]:
+            for definition in primitive["definitions"]:
+                if definition["extension"] not in known:
+                    raise SystemExit("%s: unknown extension %s" % (primitive["name"], definition["extension"]))
+    return extensions, groups
+
+
+def generate(extensions, groups):
+    """Returns {relative path: content} for everything below libs/tvl/generated."""
+    files = {}
+    for extension in extensions:
+        path = "extensions/%s/%s.hpp" % (extension["family"], extension["name"])
+        files[path] = render_file("lib/generated/" + path, "", extension["includes"],
+                                  render_extension(extension))
+    for name, group in groups.items():
+        path = "declarations/%s.hpp" % name
+        files[path] = render_file("lib/generated/" + path, group["brief"], [],
+                                  "".join(render_declaration(p) for p in group["primitives"]))
+        for extension in extensions:
+            blocks = [render_definition(p, d) for p in group["primitives"] for d in p["definitions"]
+                      if d["extension"] == extension["name"]]
+            if not blocks:
+                continue
+            path = "definitions/%s/%s_%s.hpp" % (name, name, extension["name"])
+            files[path] = render_file(
+                "lib/generated/" + path, "%s Implementation for %s" % (group["brief"], extension["name"]),
+                ['"../../declarations/%s.hpp"' % name], "".join(blocks))
+    files["tvl_generated.hpp"] = render_collection(extensions, files)
+    files["coverage.md"] = render_coverage(extensions, groups)
+    return files
+
+
+def render_collection(extensions, files):
+    def includes_for(platform):
+        members = [e for e in extensions if e["platform"] == platform]
+        lines = ['#include "extensions/%s/%s.hpp"' % (e["family"], e["name"]) for e in members]
+        for group in GROUP_ORDER:
+            for e in members:
+                path = "definitions/%s/%s_%s.hpp" % (group, group, e["name"])
+                if path in files:
+                    lines.append('#include "%s"' % path)
+        return lines
+
+    lines = includes_for("generic") + ["#ifdef NEON"] + includes_for("arm") + ["#else"] + \
+        includes_for("intel") + ["#endif"]
+    path = "lib/generated/tvl_generated.hpp"
+    return TEMPLATES["collection"].substitute(
+        license=LICENSE, path=path, date=DATE, brief="", guard=guard(path),
+        includes="".join(line + "\n" for line in lines))
+
+
+def render_coverage(extensions, groups):
+    """Markdown matrix primitive x type x extension. Cells are native, workaround or empty."""
+    columns = []
+    for extension in extensions:
+        sizes = []
+        for group in groups.values():
+            for primitive in group["primitives"]:
+                for d in primitive["definitions"]:
+                    if d["extension"] == extension["name"] and d.get("vector_size") not in sizes:
+                        sizes.append(d.get("vector_size"))
+        for size in sizes:
+            label = extension["name"] if size is None or not size.isdigit() else "%s/%s" % (extension["name"], size)
+            columns.append((extension["name"], size, label))
+    out = ["# TVL primitive coverage", "",
+           "Generated by libs/tvl/generator/tvl_generator.py, do not edit.", "",
+           "| group | primitive | type | " + " | ".join(c[2] for c in columns) + " |",
+           "|---|---|---|" + "---|" * len(columns)]
+    for name, group in groups.items():
+        for primitive in group["primitives"]:
+            ctypes = []
+            for d in primitive["definitions"]:
+                if d["ctype"] not in ctypes:
+                    ctypes.append(d["ctype"])
+            for ctype in ctypes:
+                cells = []
+                for extension, size, _ in columns:
+                    match = [d for d in primitive["definitions"] if d["ctype"] == ctype and
+                             d["extension"] == extension and d.get("vector_size") == size]
+                    cells.append("" if not match else ("native" if native(match[0]) else "workaround"))
+                out.append("| %s | %s | %s | %s |" % (name, primitive["name"], ctype, " | ".join(cells)))
+    return "\n".join(out) + "\n"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--out", default=DEFAULT_OUT, help="output directory (default: libs/tvl/generated)")
+    parser.add_argument("--check", action="store_true",
+                        help="do not write anything, fail if the output directory is out of date")
+    args = parser.parse_args()
+
+    files = generate(*load_specs())
+    stale = []
+    for path, content in sorted(files.items()):
+        target = os.path.join(args.out, path)
+        current = None
+        if os.path.exists(target):
+            with open(target) as f:
+                current = f.read()
+        if current == content:
+            continue
+        stale.append(path)
+        if not args.check:
+            os.makedirs(os.path.dirname(target), exist_ok=True)
+            with open(target, "w") as f:
+                f.write(content)
+    for root, _, names in os.walk(args.out):
+        for name in names:
+            path = os.path.relpath(os.path.join(root, name), args.out)
+            if path not in files:
+                print("warning: %s is not produced by the generator" % path, file=sys.stderr)
+    if args.check and stale:
+        print("out of date, run the tvl_generate target:\n  " + "\n  ".join(stale), file=sys.stderr)
+        return 1
+    for path in stale:
+        print("generated " + path)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -1,8 +1,19 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <iostream>
 #include <cstdint>
-#include "tvl/tvlintrin.hpp"
-#include "FilterTVL.h"
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <thread>
+#include <unordered_set>
+#include "BigintValuesBuilder.h"
+#include "BitmapSummary.h"
+#include "DictionaryFilter.h"
+#include "FilterTVLDispatch.h"
 #include "Filter.h"
+#include "RowSet.h"
 
 #include "folly/Benchmark.h"
 #include "folly/Portability.h"
@@ -17,108 +28,1260 @@ using namespace facebook::velox::common;
 
 std::vector<int64_t> sparseValues;
 std::vector<int64_t> denseValues;
+// denseValues narrowed to 32 bit, like a date column.
+std::vector<int32_t> denseValues32;
+std::vector<int64_t> widened;
 
 
 std::unique_ptr<BigintValuesUsingHashTable> filter;
-#ifdef NEON
-   std::unique_ptr<BigintValuesUsingHashTableTVL< tvl::simd< int64_t, tvl::neon > > > filter_neon;
-#else
-   std::unique_ptr<BigintValuesUsingHashTableTVL< tvl::simd< int64_t, tvl::sse > > > filter_sse;
-   std::unique_ptr<BigintValuesUsingHashTableTVL< tvl::simd< int64_t, tvl::avx2 > > > filter_avx2;
-   std::unique_ptr<BigintValuesUsingHashTableTVL< tvl::simd< int64_t, tvl::avx512 > > > filter_avx512;
-#endif
+// One FilterTVL kernel per processing style, nullptr if the host lacks it.
+std::unique_ptr< FilterTVLKernel > filterTVL[static_cast<int>(TVLTarget::kAvx512) + 1];
 
-template< tvl::VectorProcessingStyle Vec >
-int32_t run(const std::vector<int64_t>& data) {
-   int64_t count = 0;
-   assert(data.size() % Vec::vector_element_count() == 0);
-   for (auto i = 0; i < data.size(); i += Vec::vector_element_count()) {
-#ifdef NEON
-         auto result = filter_neon->test(tvl::loadu< Vec >(data.data() + i));
-         count += tvl::get_msb< Vec >( result );
-#else
-      if constexpr( std::is_same_v< Vec, tvl::simd< int64_t, tvl::sse > >) {
-         auto result = filter_sse->test(tvl::loadu< Vec >(data.data() + i));
-         count += tvl::get_msb< Vec >( result );
-      } else if constexpr( std::is_same_v< Vec, tvl::simd< int64_t, tvl::avx2 > >) {
-         auto result = filter_avx2->test(tvl::loadu< Vec >(data.data() + i));
-         count += tvl::get_msb< Vec >( result );
-      } else if constexpr( std::is_same_v< Vec, tvl::simd< int64_t, tvl::avx512 > >) {
-         auto result = filter_avx512->test(tvl::loadu< Vec >(data.data() + i));
-         count += tvl::get_msb< Vec >( result );
-      } else {
-         throw "Wrong Vec";
+// x BETWEEN kLower AND kUpper AND x NOT IN (excludedValues) for bestTVLTarget(),
+// through the virtual FilterTVL ([0]) and fused into one expression ([1]).
+constexpr int64_t kLower = 500'000;
+constexpr int64_t kUpper = 2'500'000;
+std::vector<int64_t> excludedValues;
+std::unique_ptr< FilterTVLKernel > betweenNotIn[2];
+
+// IN-list of 30000 keys 100 apart built like a dynamic filter from a hash
+// join build side, for which BigintValuesBuilder picks a bitmask, and the same
+// list as a hash table.
+std::vector<int64_t> dynamicKeys;
+std::unique_ptr< FilterTVLKernel > dynamicFilter;
+std::unique_ptr< FilterTVLKernel > dynamicHashTable;
+
+// Adds 'keys' to a builder from several threads, in batches of 256.
+std::unique_ptr<BigintValuesBuilder> buildKeys(const std::vector<int64_t>& keys, int64_t maxValues) {
+   constexpr int32_t kThreads = 4;
+   constexpr int32_t kBatch = 256;
+   auto builder = std::make_unique<BigintValuesBuilder>(maxValues);
+   std::vector<std::thread> threads;
+   for (auto t = 0; t < kThreads; ++t) {
+      threads.emplace_back([&, t]() {
+         for (int64_t i = t * kBatch; i < keys.size(); i += kThreads * kBatch) {
+            builder->add(keys.data() + i, std::min<int64_t>(kBatch, keys.size() - i));
+         }
+      });
+   }
+   for (auto& thread : threads) {
+      thread.join();
+   }
+   return builder;
+}
+
+// Every kind the builder can pick must count like the scalar IN-list, except
+// for the false positives of the Bloom filter.
+void verifyDynamicFilters(const std::vector<int64_t>& filterValues) {
+   auto check = [](const std::vector<int64_t>& keys, int64_t maxValues, BigintValuesBuilder::Kind kind) {
+      auto builder = buildKeys(keys, maxValues);
+      if (builder->kind() != kind) {
+         throw "BigintValuesBuilder picked an unexpected filter";
       }
-#endif
+      std::unordered_set<int64_t> expected(keys.begin(), keys.end());
+      if (kind == BigintValuesBuilder::Kind::kBloomFilter
+             ? std::abs(builder->distinctCount() - (int64_t)expected.size()) > expected.size() / 10
+             : builder->distinctCount() != expected.size()) {
+         throw "BigintValuesBuilder miscounts the distinct keys";
+      }
+      for (auto target : {TVLTarget::kScalar, TVLTarget::kNeon, TVLTarget::kSse,
+                          TVLTarget::kAvx2, TVLTarget::kAvx512VL, TVLTarget::kAvx512}) {
+         auto kernel = createFilterTVLKernel(target, *builder, false);
+         if (!kernel) {
+            continue;
+         }
+         int32_t count = 0;
+         for (auto value : denseValues) {
+            count += expected.count(value);
+         }
+         auto passed = kernel->countPassing(denseValues.data(), denseValues.size());
+         if (kind == BigintValuesBuilder::Kind::kBloomFilter
+                ? passed < count || kernel->countPassing(keys.data(), keys.size()) != keys.size()
+                : passed != count) {
+            throw "Dynamic filter disagrees with the scalar IN-list";
+         }
+      }
+   };
+   std::vector<int64_t> keys;
+   check(keys, 100, BigintValuesBuilder::Kind::kEmpty);
+   for (auto i = 0; i < 5000; ++i) {
+      keys.push_back(1'000'000 + i % 2000);
+   }
+   check(keys, 100'000, BigintValuesBuilder::Kind::kRange);
+   check(filterValues, 100'000, BigintValuesBuilder::Kind::kHashTable);
+   keys.clear();
+   for (auto i = 0; i < 20'000; ++i) {
+      keys.push_back(i * 100);
+   }
+   check(keys, 100'000, BigintValuesBuilder::Kind::kBitmask);
+   keys.clear();
+   for (int64_t i = 0; i < 5000; ++i) {
+      keys.push_back(i * 1'000'003);
+   }
+   check(keys, 100'000, BigintValuesBuilder::Kind::kHashTable);
+   check(keys, 1000, BigintValuesBuilder::Kind::kBloomFilter);
+   // Keys sharing their low bits must not share their Bloom filter bits.
+   keys.clear();
+   std::vector<int64_t> others;
+   for (int64_t i = 0; i < 100'000; ++i) {
+      (i % 2 ? others : keys).push_back(i << 18);
+   }
+   auto bloom = createFilterTVLKernel(bestTVLTarget(), *buildKeys(keys, 1000), false);
+   if (bloom->countPassing(keys.data(), keys.size()) != keys.size() ||
+       bloom->countPassing(others.data(), others.size()) > others.size() / 100) {
+      throw "Bloom filter has too many false positives";
    }
-   return count;
 }
 
-int32_t run1x64(const std::vector<int64_t>& data) {
-   int32_t count = 0;
+// Conjuncts on sparseValues in a poor planner order: a cheap range passing
+// 95%, an IN-list passing 75% and a range passing 2%. Applied in this order
+// ([0]) and reordered by observed cost and selectivity ([1]).
+std::vector<TVLConjunct> conjuncts;
+std::unique_ptr< FilterTVLKernel > conjunctsTVL[2];
+
+void makeFilterTVL(TVLTarget target, const std::vector<int64_t>& filterValues) {
+   filterTVL[static_cast<int>(target)] = createFilterTVLKernel(target, filterValues, false);
+}
+
+int32_t run(TVLTarget target, const std::vector<int64_t>& data) {
+   auto& kernel = filterTVL[static_cast<int>(target)];
+   if (!kernel) {
+      return 0;
+   }
+   return kernel->countPassing(data.data(), data.size());
+}
+
+int32_t run(TVLTarget target, const std::vector<int32_t>& data) {
+   auto& kernel = filterTVL[static_cast<int>(target)];
+   if (!kernel) {
+      return 0;
+   }
+   return kernel->countPassing(data.data(), data.size());
+}
+
+// Widens the 32 bit column into a temporary before running the 64 bit kernel.
+int32_t runWidened(TVLTarget target, const std::vector<int32_t>& data) {
+   widened.resize(data.size());
    for (auto i = 0; i < data.size(); ++i) {
-         count += filter->testInt64(data[i]);
+         widened[i] = data[i];
       }
+   return run(target, widened);
+}
+
+// The scalar TVL backend is the reference every ISA backend has to agree with.
+void verify(TVLTarget target, const std::vector<int64_t>& data) {
+   if (filterTVL[static_cast<int>(target)] && run(target, data) != run(TVLTarget::kScalar, data)) {
+      throw "TVL backend disagrees with the scalar reference";
+   }
+}
+
+// Sign extending while loading must count the same as the 64 bit kernel.
+void verify32(TVLTarget target) {
+   if (filterTVL[static_cast<int>(target)] && run(target, denseValues32) != run(target, denseValues)) {
+      throw "TVL 32 bit kernel disagrees with the 64 bit kernel";
+   }
+}
+
+// Folds the sparse column into the dense one like a two column row hash.
+void hashRows(const HashTVLKernels* kernels, std::vector<uint64_t>& result) {
+   auto upper = reinterpret_cast<const uint64_t*>(denseValues.data());
+   auto lower = reinterpret_cast<const uint64_t*>(sparseValues.data());
+   result.resize(denseValues.size());
+   if (!kernels) {
+      for (auto i = 0; i < result.size(); ++i) {
+         result[i] = bits::hashMix(upper[i], lower[i]);
+      }
+      return;
+   }
+   kernels->hashMix(upper, lower, result.size(), result.data());
+}
+
+// Batches of any size must count like the scalar filter. The batches end at
+// the end of the column, so an over-read would leave the allocation.
+void verifyTail(TVLTarget target) {
+   auto& kernel = filterTVL[static_cast<int>(target)];
+   if (!kernel) {
+      return;
+   }
+   for (int32_t size = 0; size <= 3 * kernel->lanes(); ++size) {
+      auto offset = denseValues.size() - size;
+      int32_t expected = 0;
+      for (auto i = 0; i < size; ++i) {
+         expected += filter->testInt64(denseValues[offset + i]);
+      }
+      if (kernel->countPassing(denseValues.data() + offset, size) != expected ||
+          kernel->countPassing(denseValues32.data() + offset, size) != expected) {
+         throw "TVL kernel miscounts a ragged batch";
+      }
+   }
+}
+
+// The fused and the virtual expression must agree with the scalar predicates.
+void verifyBetweenNotIn() {
+   std::unordered_set<int64_t> excluded(excludedValues.begin(), excludedValues.end());
+   int32_t expected = 0;
+   for (auto value : denseValues) {
+      expected += value >= kLower && value <= kUpper && !excluded.count(value);
+   }
+   for (auto& kernel : betweenNotIn) {
+      if (kernel->countPassing(denseValues.data(), denseValues.size()) != expected) {
+         throw "BETWEEN AND NOT IN kernel disagrees with the scalar predicates";
+      }
+   }
+}
+
+// Both orders must count like the scalar conjunction, also with several
+// threads sharing the adaptive kernel while it reorders.
+void verifyConjuncts() {
+   std::vector<std::unordered_set<int64_t>> inLists;
+   for (auto& conjunct : conjuncts) {
+      inLists.emplace_back(conjunct.values.begin(), conjunct.values.end());
+   }
+   int32_t expected = 0;
+   for (auto value : sparseValues) {
+      bool passed = true;
+      for (auto i = 0; i < conjuncts.size(); ++i) {
+         passed &= conjuncts[i].values.empty()
+            ? value >= conjuncts[i].lower && value <= conjuncts[i].upper
+            : inLists[i].count(value) > 0;
+      }
+      expected += passed;
+   }
+   for (auto& kernel : conjunctsTVL) {
+      if (kernel->countPassing(sparseValues.data(), sparseValues.size()) != expected) {
+         throw "FilterTVLSet disagrees with the scalar conjunction";
+      }
+   }
+   std::atomic<int32_t> mismatches = 0;
+   std::vector<std::thread> threads;
+   for (auto t = 0; t < 4; ++t) {
+      threads.emplace_back([&]() {
+         for (auto i = 0; i < 20; ++i) {
+            mismatches += conjunctsTVL[1]->countPassing(sparseValues.data(), sparseValues.size()) != expected;
+         }
+      });
+   }
+   for (auto& thread : threads) {
+      thread.join();
+   }
+   if (mismatches > 0) {
+      throw "FilterTVLSet disagrees with the scalar conjunction when shared between threads";
+   }
+}
+
+// Hash kernels must match bits::hashMix and bits::commutativeHashMix bit for bit,
+// including the scalar tail.
+void verifyHash(TVLTarget target) {
+   auto kernels = hashTVLKernels(target);
+   if (!kernels) {
+      return;
+   }
+   auto upper = reinterpret_cast<const uint64_t*>(denseValues.data());
+   auto lower = reinterpret_cast<const uint64_t*>(sparseValues.data());
+   int32_t size = denseValues.size() - 3;
+   std::vector<uint64_t> mixed(size);
+   std::vector<uint64_t> commutative(size);
+   kernels->hashMix(upper, lower, size, mixed.data());
+   kernels->commutativeHashMix(upper, lower, size, commutative.data());
+   for (auto i = 0; i < size; ++i) {
+      if (mixed[i] != bits::hashMix(upper[i], lower[i]) ||
+          commutative[i] != bits::commutativeHashMix(upper[i], lower[i])) {
+         throw "TVL hash kernel disagrees with bits::hashMix";
+      }
+   }
+}
+
+std::vector<uint64_t> rowHashes;
+
+// Bitmaps of kNumBits bits with a fraction of kDensities[i] / 1000 set, turned
+// into row numbers by the toIndices benchmarks.
+constexpr int32_t kNumBits = 1 << 20;
+constexpr int32_t kDensities[] = {1, 10, 100, 500, 900, 990};
+std::vector<uint64_t> densityBits[std::size(kDensities)];
+std::vector<int32_t> rowIndices(kNumBits);
+
+// The bit by bit loop bits::toIndices runs below kMinTVLBits.
+int32_t toIndicesBitByBit(const uint64_t* bits, int32_t begin, int32_t end, int32_t* indices) {
+   int32_t count = 0;
+   bits::forEachSetBit(bits, begin, end, [&](int32_t row) { indices[count++] = row; });
    return count;
 }
 
-#ifndef NEON
-int32_t run4x64(const std::vector<int64_t>& data) {
-   using TV = simd::Vectors<int64_t>;
+// Must write the same rows as the bit by bit loop for unaligned ranges too,
+// also through bits::toIndices.
+void verifyToIndices(TVLTarget target) {
+   auto kernels = bitsTVLKernels(target);
+   if (!kernels) {
+      return;
+   }
+   std::vector<int32_t> expected(kNumBits);
+   for (auto& bitmap : densityBits) {
+      for (auto [begin, end] : {std::pair{0, kNumBits}, {3, 50}, {17, 200}, {64, 129}, {5, kNumBits - 7}}) {
+         auto count = kernels->toIndices(bitmap.data(), begin, end, rowIndices.data());
+         if (count != toIndicesBitByBit(bitmap.data(), begin, end, expected.data()) ||
+             !std::equal(expected.begin(), expected.begin() + count, rowIndices.begin())) {
+            throw "TVL toIndices disagrees with the bit by bit loop";
+         }
+         if (target == bestTVLTarget() &&
+             (bits::toIndices(bitmap.data(), begin, end, rowIndices.data()) != count ||
+              !std::equal(expected.begin(), expected.begin() + count, rowIndices.begin()))) {
+            throw "bits::toIndices disagrees with the bit by bit loop";
+         }
+      }
+   }
+}
+
+void toIndicesScalar(uint32_t iters, int32_t density) {
+   for (auto i = 0; i < iters; ++i) {
+      folly::doNotOptimizeAway(toIndicesBitByBit(densityBits[density].data(), 0, kNumBits, rowIndices.data()));
+   }
+}
+
+void toIndicesTVLDispatch(uint32_t iters, int32_t density) {
+   auto kernels = bitsTVLKernels(bestTVLTarget());
+   for (auto i = 0; i < iters; ++i) {
+      folly::doNotOptimizeAway(kernels->toIndices(densityBits[density].data(), 0, kNumBits, rowIndices.data()));
+   }
+}
+
+// Must match a bit by bit evaluation, with the partial words at both ends of
+// the range left untouched outside of it.
+void verifyBitLogic(TVLTarget target) {
+   auto kernels = bitsTVLKernels(target);
+   if (!kernels) {
+      return;
+   }
+   auto& left = densityBits[3];
+   auto& right = densityBits[1];
+   std::vector<uint64_t> result(left.size());
+   for (auto [begin, end] : {std::pair{0, kNumBits}, {3, 50}, {17, 200}, {64, 129}, {5, kNumBits - 7}, {1000, 5000}}) {
+      for (auto op = 0; op < 4; ++op) {
+         auto expected = densityBits[5];
+         result = expected;
+         auto function = std::array{kernels->andBits, kernels->andWithNegatedBits, kernels->orBits, kernels->orWithNegatedBits}[op];
+         function(result.data(), left.data(), right.data(), begin, end);
+         for (auto bit = begin; bit < end; ++bit) {
+            auto r = bits::isBitSet(right.data(), bit) != (op % 2 == 1);
+            auto l = bits::isBitSet(left.data(), bit);
+            bits::setBit(expected.data(), bit, op < 2 ? l && r : l || r);
+         }
+         if (result != expected) {
+            throw "TVL bit logic disagrees with the bit by bit result";
+         }
+      }
+      auto count = 0;
+      for (auto bit = begin; bit < end; ++bit) {
+         count += bits::isBitSet(left.data(), bit);
+      }
+      if (kernels->countBits(left.data(), begin, end) != count) {
+         throw "TVL countBits disagrees with the bit by bit result";
+      }
+      if (begin % 8 == 0 && end % 8 == 0) {
+         result = left;
+         kernels->negate(reinterpret_cast<char*>(result.data()) + begin / 8, end - begin);
+         for (auto bit = 0; bit < kNumBits; ++bit) {
+            if (bits::isBitSet(result.data(), bit) != (bits::isBitSet(left.data(), bit) != (bit >= begin && bit < end))) {
+               throw "TVL negate disagrees with the bit by bit result";
+            }
+         }
+      }
+   }
+}
+
+std::vector<uint64_t> bitLogicTarget(bits::nwords(kNumBits));
+
+// One pass of and, or not, negate and count over the 1M bit bitmaps with
+// 'kernels', bits::andBits and friends if nullptr.
+void bitLogic(const BitsTVLKernels* kernels) {
+   auto* target = bitLogicTarget.data();
+   auto* left = densityBits[3].data();
+   auto* right = densityBits[4].data();
+   auto* negated = reinterpret_cast<char*>(target);
+   if (kernels) {
+      kernels->andBits(target, left, right, 0, kNumBits);
+      kernels->orWithNegatedBits(target, target, right, 0, kNumBits);
+      kernels->negate(negated, kNumBits);
+      folly::doNotOptimizeAway(kernels->countBits(target, 0, kNumBits));
+   } else {
+      bits::andBits(target, left, right, 0, kNumBits);
+      bits::orWithNegatedBits(target, right, 0, kNumBits);
+      bits::negate(negated, kNumBits);
+      folly::doNotOptimizeAway(bits::countBits(target, 0, kNumBits));
+   }
+}
+
+// Bit by bit scatterBits, which is what hosts without BMI2 ran before the
+// kernels had a table driven deposit.
+void scatterBitsSimple(int32_t numSource, int32_t numTarget, const char* source, const uint64_t* targetMask, char* target) {
+   int64_t from = numSource - 1;
+   for (int64_t to = numTarget - 1; to >= 0; to--) {
+      bool maskIsSet = bits::isBitSet(targetMask, to);
+      bits::setBit(target, to, maskIsSet && bits::isBitSet(source, from));
+      from -= maskIsSet ? 1 : 0;
+   }
+}
+
+// copyBits must match a bit by bit copy for any pair of offsets and leave the
+// bits around the copy alone. scatterBits must match scatterBitsSimple, also
+// in place with 'source' a prefix of 'target'.
+void verifyCopyAndScatter(TVLTarget target) {
+   auto kernels = bitsTVLKernels(target);
+   if (!kernels) {
+      return;
+   }
+   auto& source = densityBits[3];
+   std::vector<uint64_t> result(source.size());
+   for (uint64_t sourceOffset : {0, 1, 63, 64, 100}) {
+      for (uint64_t targetOffset : {0, 5, 64, 127}) {
+         for (uint64_t numBits : {0, 1, 70, 600, 5000, kNumBits - 128}) {
+            result = densityBits[5];
+            kernels->copyBits(source.data(), sourceOffset, result.data(), targetOffset, numBits);
+            for (auto bit = 0; bit < kNumBits; ++bit) {
+               bool inCopy = bit >= targetOffset && bit < targetOffset + numBits;
+               if (bits::isBitSet(result.data(), bit) !=
+                   (inCopy ? bits::isBitSet(source.data(), sourceOffset + bit - targetOffset)
+                           : bits::isBitSet(densityBits[5].data(), bit))) {
+                  throw "TVL copyBits disagrees with the bit by bit copy";
+               }
+            }
+         }
+      }
+   }
+   std::vector<uint64_t> expected(source.size());
+   for (auto& mask : {densityBits[2], densityBits[3], densityBits[5]}) {
+      for (int32_t numTarget : {0, 1, 63, 64, 65, 1000, kNumBits - 3}) {
+         auto numSource = bits::countBits(mask.data(), 0, numTarget);
+         result = densityBits[1];
+         expected = densityBits[1];
+         scatterBitsSimple(numSource, numTarget, reinterpret_cast<const char*>(source.data()), mask.data(), reinterpret_cast<char*>(expected.data()));
+         kernels->scatterBits(numSource, numTarget, reinterpret_cast<const char*>(source.data()), mask.data(), reinterpret_cast<char*>(result.data()));
+         if (result != expected) {
+            throw "TVL scatterBits disagrees with the bit by bit scatter";
+         }
+         bits::copyBits(source.data(), 0, result.data(), 0, numSource);
+         kernels->scatterBits(numSource, numTarget, reinterpret_cast<const char*>(result.data()), mask.data(), reinterpret_cast<char*>(result.data()));
+         if (result != expected) {
+            throw "TVL scatterBits in place disagrees with the bit by bit scatter";
+         }
+      }
+   }
+}
+
+// Spreads the values of a nullable boolean column over its non-null rows,
+// densityBits[nonNull] being the non-null mask. 'kernels' nullptr runs the
+// bit by bit loop.
+std::vector<uint64_t> scatterTarget(bits::nwords(kNumBits));
+
+void scatterNulls(const BitsTVLKernels* kernels, uint32_t iters, int32_t nonNull) {
+   auto& mask = densityBits[nonNull];
+   auto numSource = bits::countBits(mask.data(), 0, kNumBits);
+   auto source = reinterpret_cast<const char*>(densityBits[3].data());
+   auto target = reinterpret_cast<char*>(scatterTarget.data());
+   for (auto i = 0; i < iters; ++i) {
+      if (kernels) {
+         kernels->scatterBits(numSource, kNumBits, source, mask.data(), target);
+      } else {
+         scatterBitsSimple(numSource, kNumBits, source, mask.data(), target);
+      }
+      folly::doNotOptimizeAway(scatterTarget[0]);
+   }
+}
+
+void scatterBitsSimple(uint32_t iters, int32_t nonNull) {
+   scatterNulls(nullptr, iters, nonNull);
+}
+
+void scatterBitsScalar(uint32_t iters, int32_t nonNull) {
+   scatterNulls(bitsTVLKernels(TVLTarget::kScalar), iters, nonNull);
+}
+
+// The byte table deposit NEON uses too.
+void scatterBitsSse(uint32_t iters, int32_t nonNull) {
+   scatterNulls(bitsTVLKernels(TVLTarget::kSse), iters, nonNull);
+}
+
+void scatterBitsTVLDispatch(uint32_t iters, int32_t nonNull) {
+   for (auto i = 0; i < iters; ++i) {
+      bits::scatterBits(bits::countBits(densityBits[nonNull].data(), 0, kNumBits), kNumBits,
+                        reinterpret_cast<const char*>(densityBits[3].data()), densityBits[nonNull].data(),
+                        reinterpret_cast<char*>(scatterTarget.data()));
+      folly::doNotOptimizeAway(scatterTarget[0]);
+   }
+}
+
+// Copies 1M bits from bit 3 to bit 70.
+void copyBitsUnaligned(const BitsTVLKernels* kernels) {
+   if (kernels) {
+      kernels->copyBits(densityBits[3].data(), 3, scatterTarget.data(), 70, kNumBits - 128);
+   } else {
+      bits::copyBits(densityBits[3].data(), 3, scatterTarget.data(), 70, kNumBits - 128);
+   }
+   folly::doNotOptimizeAway(scatterTarget[0]);
+}
+
+// Null masks for the summary scans: no nulls, and nulls in a few clusters
+// like a column that was null in some files only. lateRow is a filter result
+// with one passing row near the end.
+std::vector<uint64_t> noNulls(bits::nwords(kNumBits), ~0ULL);
+std::vector<uint64_t> clusteredNulls(bits::nwords(kNumBits), ~0ULL);
+std::vector<uint64_t> lateRow(bits::nwords(kNumBits));
+std::unique_ptr<bits::BitmapSummary> noNullsSummary;
+std::unique_ptr<bits::BitmapSummary> clusteredNullsSummary;
+std::unique_ptr<bits::BitmapSummary> lateRowSummary;
+
+// The summary-aware scans must agree with the plain ones on every range,
+// also after update().
+void verifyBitmapSummary() {
+   std::vector<uint64_t> bitmap = clusteredNulls;
+   bits::BitmapSummary summary(bitmap.data(), kNumBits - 5);
+   for (auto round = 0; round < 2; ++round) {
+      for (auto [begin, end] : {std::pair{0, kNumBits - 5}, {3, 50}, {4000, 9000}, {64, 200'000}, {300'000, 300'000},
+                                {4096, 8192}, {kNumBits / 2, kNumBits - 5}}) {
+         int64_t sum = 0;
+         int64_t expectedSum = 0;
+         summary.forEachSetBit(begin, end, [&](int32_t row) { sum += row; });
+         bits::forEachSetBit(bitmap.data(), begin, end, [&](int32_t row) { expectedSum += row; });
+         if (summary.countBits(begin, end) != bits::countBits(bitmap.data(), begin, end) ||
+             summary.findFirstBit(begin, end) != bits::findFirstBit(bitmap.data(), begin, end) ||
+             summary.isAllSet(begin, end) != bits::isAllSet(bitmap.data(), begin, end) ||
+             summary.isAllSet(begin, end, false) != bits::isAllSet(bitmap.data(), begin, end, false) ||
+             sum != expectedSum) {
+            throw "BitmapSummary disagrees with the plain bitmap scans";
+         }
+      }
+      bits::fillBits(bitmap.data(), 0, 300'000, false);
+      bits::fillBits(bitmap.data(), 300'000, 700'000, true);
+      summary.update(0, 700'000);
+   }
+}
+
+// Row sets over kRowSetRows rows as RowSet and as plain bitmap: 0.1% of the
+// rows (array chunks), 50% (bitmap chunks), 99% and ranges of 10000 rows (run
+// chunks).
+constexpr int64_t kRowSetRows = 1 << 22;
+std::vector<uint64_t> rowSetBits[4];
+RowSet rowSets[4];
+std::vector<uint64_t> rowSetResult(bits::nwords(kRowSetRows));
+
+// Intersection and union must match andBits and orBits on the bitmaps, also
+// for batches that do not start at a chunk.
+void verifyRowSets() {
+   for (auto i = 0; i < std::size(rowSets); ++i) {
+      if (rowSets[i].count() != bits::countBits(rowSetBits[i].data(), 0, kRowSetRows)) {
+         throw "RowSet miscounts";
+      }
+      for (auto j = 0; j < std::size(rowSets); ++j) {
+         for (auto unite : {false, true}) {
+            auto set = unite ? RowSet::unite(rowSets[i], rowSets[j]) : RowSet::intersect(rowSets[i], rowSets[j]);
+            auto expected = rowSetBits[i];
+            unite ? bits::orBits(expected.data(), rowSetBits[j].data(), 0, kRowSetRows)
+                  : bits::andBits(expected.data(), rowSetBits[j].data(), 0, kRowSetRows);
+            set.toBits(0, kRowSetRows, rowSetResult.data());
+            if (rowSetResult != expected || set.count() != bits::countBits(expected.data(), 0, kRowSetRows)) {
+               throw "RowSet intersect or unite disagrees with the bitmaps";
+            }
+            auto encoded = RowSet::fromBits(expected.data(), 0, kRowSetRows);
+            for (auto chunk = 0; chunk < set.numChunks(); ++chunk) {
+               if (set.numChunks() != encoded.numChunks() || set.chunkKind(chunk) != encoded.chunkKind(chunk)) {
+                  throw "RowSet intersect or unite picks other containers than fromBits";
+               }
+            }
+            for (int64_t begin : {0, 1000, 65536 * 3 - 5}) {
+               std::vector<uint64_t> batch(bits::nwords(70000));
+               set.toBits(begin, 70000, batch.data());
+               for (auto row = 0; row < 70000; row += 97) {
+                  if (bits::isBitSet(batch.data(), row) != bits::isBitSet(expected.data(), begin + row) ||
+                      set.contains(begin + row) != bits::isBitSet(expected.data(), begin + row)) {
+                     throw "RowSet batch disagrees with the bitmap";
+                  }
+               }
+            }
+         }
+      }
+   }
+   auto range = RowSet::fromRange(100, kRowSetRows - 100);
+   if (range.count() != kRowSetRows - 200 || range.contains(99) || !range.contains(100) || range.contains(kRowSetRows - 100)) {
+      throw "RowSet::fromRange is off";
+   }
+}
+
+// The IN-list of filterTVL as a one conjunct FilterTVLSet, which selects
+// through a row number vector, and the bitmaps of the filterToBits benchmarks.
+std::unique_ptr< FilterTVLKernel > filterRowsTVL;
+std::vector<uint64_t> filterBits;
+
+// Must set exactly the selected bits of the passing values, for batches of
+// any size and for 32 bit values too.
+void verifyFilterToBits(const FilterTVLKernel* kernel) {
+   if (!kernel) {
+      return;
+   }
+   auto* selection = densityBits[3].data();
+   std::vector<uint64_t> result(bits::nwords(denseValues.size()) + 1);
+   for (int32_t size : {0, 1, 7, 63, 64, 65, 200, (int32_t)denseValues.size()}) {
+      for (auto* selected : {(const uint64_t*)nullptr, (const uint64_t*)selection}) {
+         std::fill(result.begin(), result.end(), ~0ULL);
+         auto count = kernel->filterToBits(denseValues.data(), size, selected, result.data());
+         int32_t expected = 0;
+         for (auto i = 0; i < bits::nwords(size) * 64; ++i) {
+            bool passed = i < size && filter->testInt64(denseValues[i]) && (!selected || bits::isBitSet(selected, i));
+            expected += passed;
+            if (bits::isBitSet(result.data(), i) != passed) {
+               throw "TVL filterToBits disagrees with the scalar filter";
+            }
+         }
+         if (count != expected || result[bits::nwords(size)] != ~0ULL ||
+             kernel->filterToBits(denseValues32.data(), size, selected, result.data()) != expected ||
+             (!selected && kernel->countPassing(denseValues32.data(), size) != expected)) {
+            throw "TVL filterToBits miscounts";
+         }
+      }
+   }
+}
+
+// Packs the low 'bitWidth' bits of every value LSB first, plus a word of
+// padding for storeBits.
+std::vector<uint64_t> packBits(const std::vector<int64_t>& values, int32_t bitWidth) {
+   std::vector<uint64_t> packed(bits::nwords(values.size() * bitWidth) + 1);
+   for (auto i = 0; i < values.size(); ++i) {
+      bits::detail::storeBits<uint64_t>(packed.data(), i * bitWidth, values[i], bitWidth);
+   }
+   return packed;
+}
+
+// denseValues, which are below 2^22, packed at 22 bits and the buffer they
+// are unpacked to before filtering without the fused kernels.
+constexpr int32_t kPackedBits = 22;
+std::vector<uint64_t> packedDense;
+std::vector<int64_t> unpackedDense;
+
+// filterPackedToBits must match the scalar filter on the low bits of
+// denseValues for every bit width, also when the last group is partial.
+void verifyFilterPacked(const FilterTVLKernel* kernel) {
+   if (!kernel) {
+      return;
+   }
+   std::vector<int64_t> codes(2000);
+   std::vector<uint64_t> result(bits::nwords(codes.size()) + 1);
+   for (auto bitWidth = 1; bitWidth <= 32; ++bitWidth) {
+      for (auto i = 0; i < codes.size(); ++i) {
+         codes[i] = denseValues[i] & bits::lowMask(bitWidth);
+      }
+      auto packed = packBits(codes, bitWidth);
+      for (int32_t size : {0, 1, 63, 64, 65, 200, (int32_t)codes.size()}) {
+         for (auto* selected : {(const uint64_t*)nullptr, (const uint64_t*)densityBits[3].data()}) {
+            std::fill(result.begin(), result.end(), ~0ULL);
+            auto count = kernel->filterPackedToBits(packed.data(), bitWidth, size, selected, result.data());
+            int32_t expected = 0;
+            for (auto i = 0; i < bits::nwords(size) * 64; ++i) {
+               bool passed = i < size && filter->testInt64(codes[i]) && (!selected || bits::isBitSet(selected, i));
+               expected += passed;
+               if (bits::isBitSet(result.data(), i) != passed) {
+                  throw "TVL filterPackedToBits disagrees with the scalar filter";
+               }
+            }
+            if (count != expected || result[bits::nwords(size)] != ~0ULL) {
+               throw "TVL filterPackedToBits miscounts";
+            }
+         }
+      }
+   }
+   if (kernel->filterPackedToBits(packedDense.data(), kPackedBits, denseValues.size(), nullptr, filterBits.data()) !=
+       kernel->countPassing(denseValues.data(), denseValues.size())) {
+      throw "TVL filterPackedToBits disagrees with countPassing";
+   }
+}
+
+// Encodes 'values' as a block of the smallest bit width, with its codes in
+// 'packed'. Delta blocks need ascending values.
+TVLEncodedBlock encodeBlock(const int64_t* values, int32_t size, TVLEncodedBlock::Encoding encoding, std::vector<uint64_t>& packed) {
+   bool delta = encoding == TVLEncodedBlock::Encoding::kDelta;
+   auto [low, high] = std::minmax_element(values, values + size);
+   std::vector<int64_t> codes(size);
+   for (auto i = 0; i < size; ++i) {
+      codes[i] = delta ? (i == 0 ? 0 : values[i] - values[i - 1]) : values[i] - *low;
+   }
+   auto maxCode = *std::max_element(codes.begin(), codes.end());
+   int32_t bitWidth = std::max(1, 64 - __builtin_clzll(maxCode | 1));
+   packed = packBits(codes, bitWidth);
+   return {encoding, delta ? values[0] : *low, packed.data(), bitWidth, size, *low, *high};
+}
+
+// denseValues sorted, like a clustered column, in blocks of kBlockValues
+// encoded with frame of reference ([0]) and delta ([1]). Most blocks lie
+// outside the IN-list of filterTVL and are skipped.
+constexpr int32_t kBlockValues = 4096;
+std::vector<int64_t> sortedValues;
+std::vector<TVLEncodedBlock> encodedBlocks[2];
+std::vector<std::vector<uint64_t>> encodedCodes[2];
+
+// filterBlockToBits must match the scalar filter on the decoded values,
+// for deltas of every bit width and for the skipped blocks.
+void verifyFilterBlocks(const FilterTVLKernel* kernel) {
+   if (!kernel) {
+      return;
+   }
+   std::vector<uint64_t> result(bits::nwords(kBlockValues) + 1);
+   auto check = [&](const TVLEncodedBlock& block, const std::vector<int64_t>& values) {
+      for (auto* selected : {(const uint64_t*)nullptr, (const uint64_t*)densityBits[3].data()}) {
+         std::fill(result.begin(), result.end(), ~0ULL);
+         auto count = kernel->filterBlockToBits(block, selected, result.data());
+         int32_t expected = 0;
+         for (auto i = 0; i < bits::nwords(block.size) * 64; ++i) {
+            bool passed = i < block.size && filter->testInt64(values[i]) && (!selected || bits::isBitSet(selected, i));
+            expected += passed;
+            if (bits::isBitSet(result.data(), i) != passed) {
+               throw "TVL filterBlockToBits disagrees with the scalar filter";
+            }
+         }
+         if (count != expected || result[bits::nwords(block.size)] != ~0ULL) {
+            throw "TVL filterBlockToBits miscounts";
+         }
+      }
+   };
+   for (auto encoding : {0, 1}) {
+      for (auto i = 0; i < encodedBlocks[encoding].size(); i += 37) {
+         auto& block = encodedBlocks[encoding][i];
+         check(block, std::vector<int64_t>(sortedValues.begin() + i * kBlockValues, sortedValues.begin() + i * kBlockValues + block.size));
+      }
+   }
+   // Deltas of every width, summed up from a negative base.
+   std::vector<int64_t> codes(1000);
+   std::vector<int64_t> values(codes.size());
+   for (auto bitWidth = 1; bitWidth <= 32; ++bitWidth) {
+      int64_t value = -2'000'000;
+      for (auto i = 0; i < codes.size(); ++i) {
+         codes[i] = (denseValues[i] / 1000 + (i % 7 == 0 ? 1000 : 0)) & bits::lowMask(bitWidth);
+         value += codes[i];
+         values[i] = value;
+      }
+      auto packed = packBits(codes, bitWidth);
+      for (int32_t size : {1, 64, 65, 200, (int32_t)codes.size()}) {
+         check({TVLEncodedBlock::Encoding::kDelta, -2'000'000, packed.data(), bitWidth, size,
+                std::numeric_limits<int64_t>::min(), std::numeric_limits<int64_t>::max()}, values);
+      }
+   }
+   std::vector<uint64_t> blockBits(bits::nwords(kBlockValues) + 1);
+   for (auto encoding : {0, 1}) {
+      int32_t count = 0;
+      for (auto& block : encodedBlocks[encoding]) {
+         count += kernel->filterBlockToBits(block, nullptr, blockBits.data());
+      }
+      if (count != kernel->countPassing(sortedValues.data(), sortedValues.size())) {
+         throw "TVL filterBlockToBits disagrees with countPassing";
+      }
+   }
+}
+
+// sortedValues run length encoded, about 330 rows per run.
+std::vector<int64_t> runValues;
+std::vector<int32_t> runLengths;
+
+// filterRunsToBits must match the scalar filter on the expanded rows, also
+// for empty runs and when the last word is partial.
+void verifyFilterRuns(const FilterTVLKernel* kernel) {
+   if (!kernel) {
+      return;
+   }
+   std::vector<int64_t> values;
+   std::vector<int32_t> lengths;
+   for (auto i = 0; i < 3000; ++i) {
+      values.push_back(denseValues[i]);
+      lengths.push_back(i % 11 == 0 ? 0 : i % 5 == 0 ? 130 : i % 3);
+   }
+   std::vector<uint64_t> result(filterBits.size() + 1);
+   for (int32_t numRuns : {0, 1, 7, 100, 1025, (int32_t)values.size(), -1}) {
+      auto* runs = numRuns < 0 ? runValues.data() : values.data();
+      auto* length = numRuns < 0 ? runLengths.data() : lengths.data();
+      numRuns = numRuns < 0 ? runValues.size() : numRuns;
+      std::vector<int64_t> rows;
+      for (auto i = 0; i < numRuns; ++i) {
+         rows.insert(rows.end(), length[i], runs[i]);
+      }
+      int32_t size = rows.size();
+      for (auto* selected : {(const uint64_t*)nullptr, (const uint64_t*)densityBits[3].data()}) {
+         std::fill(result.begin(), result.end(), ~0ULL);
+         auto count = kernel->filterRunsToBits(runs, length, numRuns, selected, result.data());
+         int32_t expected = 0;
+         for (auto i = 0; i < bits::nwords(size) * 64; ++i) {
+            bool passed = i < size && filter->testInt64(rows[i]) && (!selected || bits::isBitSet(selected, i));
+            expected += passed;
+            if (bits::isBitSet(result.data(), i) != passed) {
+               throw "TVL filterRunsToBits disagrees with the scalar filter";
+            }
+         }
+         if (count != expected || result[bits::nwords(size)] != ~0ULL) {
+            throw "TVL filterRunsToBits miscounts";
+         }
+      }
+   }
+}
+
+// Codes of a dictionary encoded column of kNumValues rows, with a dictionary
+// of 4000 entries ([0], a quarter of them in the IN-list of filterTVL) and
+// one of 50 entries ([1], half of them in it). Without the dictionary filter
+// the codes are decoded to unpackedDense first.
+constexpr int32_t kDictionarySizes[] = {4000, 50};
+std::vector<int64_t> dictionaries[2];
+std::vector<int32_t> dictionaryCodes[2];
+DictionaryFilterCache dictionaryFilters;
+
+// gatherBits must return the addressed bits of the selected indices for
+// bitmaps of one word and of many, also when the last group is partial.
+void verifyGatherBits(TVLTarget target) {
+   auto* kernels = bitsTVLKernels(target);
+   if (!kernels) {
+      return;
+   }
+   std::vector<int32_t> indices(2000);
+   std::vector<uint64_t> result(bits::nwords(indices.size()) + 1);
+   auto* source = densityBits[3].data();
+   for (int32_t numBits : {1, 50, 64, 65, 4000}) {
+      for (auto i = 0; i < indices.size(); ++i) {
+         indices[i] = folly::Random::rand32() % numBits;
+      }
+      for (int32_t size : {0, 1, 7, 63, 64, 65, 200, (int32_t)indices.size()}) {
+         for (auto* selected : {(const uint64_t*)nullptr, (const uint64_t*)densityBits[2].data()}) {
+            std::fill(result.begin(), result.end(), ~0ULL);
+            auto count = kernels->gatherBits(source, numBits, indices.data(), size, selected, result.data());
+            int32_t expected = 0;
+            for (auto i = 0; i < bits::nwords(size) * 64; ++i) {
+               bool set = i < size && bits::isBitSet(source, indices[i]) && (!selected || bits::isBitSet(selected, i));
+               expected += set;
+               if (bits::isBitSet(result.data(), i) != set) {
+                  throw "TVL gatherBits disagrees with isBitSet";
+               }
+            }
+            if (count != expected || result[bits::nwords(size)] != ~0ULL) {
+               throw "TVL gatherBits miscounts";
+            }
+         }
+      }
+   }
+}
+
+// The dictionary filters must match the scalar filter on the decoded values
+// and come from the cache once built.
+void verifyDictionaryFilters() {
+   auto& kernel = filterTVL[static_cast<int>(bestTVLTarget())];
+   auto* selection = densityBits[3].data();
+   for (auto i : {0, 1}) {
+      auto& dictionary = dictionaries[i];
+      auto& codes = dictionaryCodes[i];
+      auto dictionaryFilter = dictionaryFilters.get(dictionary.data(), dictionary.size(), [&] {
+         return DictionaryFilter(*kernel, dictionary.data(), dictionary.size());
+      });
+      for (auto j = 0; j < codes.size(); ++j) {
+         bits::setBit(filterBits.data(), j, filter->testInt64(dictionary[codes[j]]) && bits::isBitSet(selection, j));
+      }
+      std::vector<uint64_t> result(filterBits.size());
+      if (dictionaryFilter->filterToBits(codes.data(), codes.size(), selection, result.data()) !=
+          bits::countBits(filterBits.data(), 0, codes.size()) || result != filterBits) {
+         throw "DictionaryFilter disagrees with the scalar filter";
+      }
+      if (dictionaryFilters.get(dictionary.data(), dictionary.size(), [&]() -> DictionaryFilter {
+             throw "DictionaryFilterCache rebuilds a cached filter";
+          }) != dictionaryFilter) {
+         throw "DictionaryFilterCache returns another filter";
+      }
+   }
+   // Dictionaries where every or no entry passes skip the codes.
+   for (bool pass : {false, true}) {
+      auto dictionaryFilter = DictionaryFilter::fromTest(50, [&](int32_t) { return pass; });
+      std::vector<uint64_t> result(bits::nwords(1000), 0);
+      std::fill(filterBits.begin(), filterBits.end(), 0);
+      bits::fillBits(filterBits.data(), 0, 1000, pass);
+      if (dictionaryFilter.filterToBits(dictionaryCodes[1].data(), 1000, nullptr, result.data()) != (pass ? 1000 : 0) ||
+          !std::equal(result.begin(), result.end(), filterBits.begin())) {
+         throw "DictionaryFilter with a uniform result miscounts";
+      }
+   }
+}
+
+// Source and target of the memcpy size sweep. Large enough to reach
+// tvlStreamingBytes().
+constexpr int64_t kCopyBytes = 32 << 20;
+std::vector<char> copySource;
+std::vector<char> copyTarget;
+
+// Memory kernels must match libc for every size and misalignment, including
+// the streaming path.
+void verifyMemory(TVLTarget target) {
+   auto kernels = memoryTVLKernels(target);
+   if (!kernels) {
+      return;
+   }
+   std::vector<char> expected(copyTarget.size());
+   for (int64_t bytes : {0L, 1L, 7L, 31L, 64L, 100L, 4097L, kCopyBytes - 256}) {
+      for (auto offset : {0, 3, 17}) {
+         std::memset(copyTarget.data(), 0, bytes + 128);
+         std::memset(expected.data(), 0, bytes + 128);
+         kernels->memcpy(copyTarget.data() + offset, copySource.data() + 5, bytes);
+         std::memcpy(expected.data() + offset, copySource.data() + 5, bytes);
+         if (std::memcmp(copyTarget.data(), expected.data(), bytes + 128)) {
+            throw "TVL memory kernel disagrees with libc";
+         }
+      }
+   }
+}
+
+// Moves 'bytes' per iteration, the source offset varies the alignment. The
+// size is hidden from the compiler so libc is not inlined for small sizes.
+void memcpyLibc(uint32_t iters, int64_t bytes) {
+   folly::makeUnpredictable(bytes);
+   for (auto i = 0; i < iters; ++i) {
+      std::memcpy(copyTarget.data(), copySource.data() + (i & 63), bytes);
+   }
+   folly::doNotOptimizeAway(copyTarget[0]);
+}
+
+void memcpyTVLDispatch(uint32_t iters, int64_t bytes) {
+   folly::makeUnpredictable(bytes);
+   for (auto i = 0; i < iters; ++i) {
+      tvlMemcpy(copyTarget.data(), copySource.data() + (i & 63), bytes);
+   }
+   folly::doNotOptimizeAway(copyTarget[0]);
+}
+
+int32_t run1x64(const std::vector<int64_t>& data) {
    int32_t count = 0;
-   assert(data.size() % 4 == 0);
-   for (auto i = 0; i < data.size(); i += 4) {
-         auto result = filter->test4x64(simd::Vectors<int64_t>::load(data.data() + i));
-         count += TV::compareBitMask(TV::compareResult(result));
+   for (auto i = 0; i < data.size(); ++i) {
+         count += filter->testInt64(data[i]);
       }
    return count;
 }
-#endif
 
-BENCHMARK(denseScalar) {
+BENCHMARK(denseTVLScalar) {
+   folly::doNotOptimizeAway(run(TVLTarget::kScalar, denseValues));
+}
+BENCHMARK_RELATIVE(denseScalar) {
    folly::doNotOptimizeAway(run1x64(denseValues));
 }
+BENCHMARK_RELATIVE(denseTVLDispatch) {
+   folly::doNotOptimizeAway(run(bestTVLTarget(), denseValues));
+}
 #ifndef NEON
    BENCHMARK_RELATIVE(denseTVLSSE) {
-      folly::doNotOptimizeAway(run< tvl::simd< int64_t, tvl::sse > >(denseValues));
-   }
-   BENCHMARK_RELATIVE(denseAVX2) {
-      folly::doNotOptimizeAway(run4x64(denseValues));
+      folly::doNotOptimizeAway(run(TVLTarget::kSse, denseValues));
    }
    BENCHMARK_RELATIVE(denseTVLAVX2) {
-      folly::doNotOptimizeAway(run< tvl::simd< int64_t, tvl::avx2 > >(denseValues));
+      folly::doNotOptimizeAway(run(TVLTarget::kAvx2, denseValues));
    }
    BENCHMARK_RELATIVE(denseTVLAVX512) {
-      folly::doNotOptimizeAway(run< tvl::simd< int64_t, tvl::avx512 > >(denseValues));
+      folly::doNotOptimizeAway(run(TVLTarget::kAvx512, denseValues));
+   }
+   BENCHMARK_RELATIVE(denseTVLAVX512VL) {
+      folly::doNotOptimizeAway(run(TVLTarget::kAvx512VL, denseValues));
    }
 #else
    BENCHMARK_RELATIVE(denseTVLNeon) {
-      folly::doNotOptimizeAway(run< tvl::simd< int64_t, tvl::neon > >(denseValues));
+      folly::doNotOptimizeAway(run(TVLTarget::kNeon, denseValues));
    }
 #endif
 
-BENCHMARK(sparseScalar) {
+BENCHMARK(sparseTVLScalar) {
+   folly::doNotOptimizeAway(run(TVLTarget::kScalar, sparseValues));
+}
+BENCHMARK_RELATIVE(sparseScalar) {
    folly::doNotOptimizeAway(run1x64(sparseValues));
 }
+BENCHMARK_RELATIVE(sparseTVLDispatch) {
+   folly::doNotOptimizeAway(run(bestTVLTarget(), sparseValues));
+}
 #ifndef NEON
    BENCHMARK_RELATIVE(sparseTVLSSE) {
-      folly::doNotOptimizeAway(run< tvl::simd< int64_t, tvl::sse > >(sparseValues));
-   }
-   BENCHMARK_RELATIVE(sparseAVX2) {
-      folly::doNotOptimizeAway(run4x64(sparseValues));
+      folly::doNotOptimizeAway(run(TVLTarget::kSse, sparseValues));
    }
    BENCHMARK_RELATIVE(sparseTVLAVX2) {
-      folly::doNotOptimizeAway(run< tvl::simd< int64_t, tvl::avx2 > >(sparseValues));
+      folly::doNotOptimizeAway(run(TVLTarget::kAvx2, sparseValues));
    }
    BENCHMARK_RELATIVE(sparseTVLAVX512) {
-      folly::doNotOptimizeAway(run< tvl::simd< int64_t, tvl::avx512 > >(sparseValues));
+      folly::doNotOptimizeAway(run(TVLTarget::kAvx512, sparseValues));
+   }
+   BENCHMARK_RELATIVE(sparseTVLAVX512VL) {
+      folly::doNotOptimizeAway(run(TVLTarget::kAvx512VL, sparseValues));
    }
 #else
    BENCHMARK_RELATIVE(sparseTVLNeon) {
-      folly::doNotOptimizeAway(run< tvl::simd< int64_t, tvl::neon > >(sparseValues));
+      folly::doNotOptimizeAway(run(TVLTarget::kNeon, sparseValues));
    }
 #endif
 
+BENCHMARK(dense32WidenTVLDispatch) {
+   folly::doNotOptimizeAway(runWidened(bestTVLTarget(), denseValues32));
+}
+BENCHMARK_RELATIVE(dense32TVLDispatch) {
+   folly::doNotOptimizeAway(run(bestTVLTarget(), denseValues32));
+}
+
+BENCHMARK(inListHashTable) {
+   folly::doNotOptimizeAway(dynamicHashTable->countPassing(denseValues.data(), denseValues.size()));
+}
+BENCHMARK_RELATIVE(inListFromBuilder) {
+   folly::doNotOptimizeAway(dynamicFilter->countPassing(denseValues.data(), denseValues.size()));
+}
+
+BENCHMARK(betweenNotInDynamic) {
+   folly::doNotOptimizeAway(betweenNotIn[0]->countPassing(denseValues.data(), denseValues.size()));
+}
+BENCHMARK_RELATIVE(betweenNotInFused) {
+   folly::doNotOptimizeAway(betweenNotIn[1]->countPassing(denseValues.data(), denseValues.size()));
+}
+
+BENCHMARK(conjunctsFixedOrder) {
+   folly::doNotOptimizeAway(conjunctsTVL[0]->countPassing(sparseValues.data(), sparseValues.size()));
+}
+BENCHMARK_RELATIVE(conjunctsAdaptiveOrder) {
+   folly::doNotOptimizeAway(conjunctsTVL[1]->countPassing(sparseValues.data(), sparseValues.size()));
+}
+
+BENCHMARK(filterToBitsThroughRows) {
+   folly::doNotOptimizeAway(filterRowsTVL->filterToBits(denseValues.data(), denseValues.size(), densityBits[3].data(), filterBits.data()));
+}
+BENCHMARK_RELATIVE(filterToBitsTVLDispatch) {
+   auto& kernel = filterTVL[static_cast<int>(bestTVLTarget())];
+   folly::doNotOptimizeAway(kernel->filterToBits(denseValues.data(), denseValues.size(), densityBits[3].data(), filterBits.data()));
+}
+
+// Filters 22 bit packed values: unpacked with loadBits into an int64_t array
+// first, or unpacked in registers and tested right away.
+BENCHMARK(filterPackedUnpackFirst) {
+   auto& kernel = filterTVL[static_cast<int>(bestTVLTarget())];
+   for (auto i = 0; i < unpackedDense.size(); ++i) {
+      unpackedDense[i] = bits::detail::loadBits<uint64_t>(packedDense.data(), i * kPackedBits, kPackedBits) & bits::lowMask(kPackedBits);
+   }
+   folly::doNotOptimizeAway(kernel->filterToBits(unpackedDense.data(), unpackedDense.size(), nullptr, filterBits.data()));
+}
+BENCHMARK_RELATIVE(filterPackedTVLDispatch) {
+   auto& kernel = filterTVL[static_cast<int>(bestTVLTarget())];
+   folly::doNotOptimizeAway(kernel->filterPackedToBits(packedDense.data(), kPackedBits, denseValues.size(), nullptr, filterBits.data()));
+}
+
+// Filters the encoded blocks of sortedValues: decoded into an int64_t array
+// first, or decoded in registers with the blocks outside the IN-list skipped.
+int32_t filterBlocksDecodeFirst(int32_t encoding) {
+   auto& kernel = filterTVL[static_cast<int>(bestTVLTarget())];
+   int32_t count = 0;
+   for (auto i = 0; i < encodedBlocks[encoding].size(); ++i) {
+      auto& block = encodedBlocks[encoding][i];
+      int64_t value = block.base;
+      for (auto j = 0; j < block.size; ++j) {
+         auto code = bits::detail::loadBits<uint64_t>(block.packed, j * block.bitWidth, block.bitWidth) & bits::lowMask(block.bitWidth);
+         value = encoding ? value + code : block.base + code;
+         unpackedDense[j] = value;
+      }
+      count += kernel->filterToBits(unpackedDense.data(), block.size, nullptr, filterBits.data() + i * kBlockValues / 64);
+   }
+   return count;
+}
+
+int32_t filterBlocksTVLDispatch(int32_t encoding) {
+   auto& kernel = filterTVL[static_cast<int>(bestTVLTarget())];
+   int32_t count = 0;
+   for (auto i = 0; i < encodedBlocks[encoding].size(); ++i) {
+      count += kernel->filterBlockToBits(encodedBlocks[encoding][i], nullptr, filterBits.data() + i * kBlockValues / 64);
+   }
+   return count;
+}
+
+BENCHMARK(filterFrameOfReferenceDecodeFirst) {
+   folly::doNotOptimizeAway(filterBlocksDecodeFirst(0));
+}
+BENCHMARK_RELATIVE(filterFrameOfReferenceTVLDispatch) {
+   folly::doNotOptimizeAway(filterBlocksTVLDispatch(0));
+}
+BENCHMARK(filterDeltaDecodeFirst) {
+   folly::doNotOptimizeAway(filterBlocksDecodeFirst(1));
+}
+BENCHMARK_RELATIVE(filterDeltaTVLDispatch) {
+   folly::doNotOptimizeAway(filterBlocksTVLDispatch(1));
+}
+
+// Filters the run length encoded sortedValues: expanded into an int64_t
+// array first, or tested once per run.
+BENCHMARK(filterRunsExpandFirst) {
+   auto& kernel = filterTVL[static_cast<int>(bestTVLTarget())];
+   int32_t row = 0;
+   for (auto i = 0; i < runValues.size(); ++i) {
+      std::fill_n(unpackedDense.begin() + row, runLengths[i], runValues[i]);
+      row += runLengths[i];
+   }
+   folly::doNotOptimizeAway(kernel->filterToBits(unpackedDense.data(), row, densityBits[3].data(), filterBits.data()));
+}
+BENCHMARK_RELATIVE(filterRunsTVLDispatch) {
+   auto& kernel = filterTVL[static_cast<int>(bestTVLTarget())];
+   folly::doNotOptimizeAway(kernel->filterRunsToBits(
+      runValues.data(), runLengths.data(), runValues.size(), densityBits[3].data(), filterBits.data()));
+}
+
+// Filters a dictionary encoded column: decoded into an int64_t array and
+// filtered per row, or filtered per dictionary entry once and then per code.
+int32_t filterCodesDecodeFirst(int32_t dictionary) {
+   auto& kernel = filterTVL[static_cast<int>(bestTVLTarget())];
+   auto& codes = dictionaryCodes[dictionary];
+   for (auto i = 0; i < codes.size(); ++i) {
+      unpackedDense[i] = dictionaries[dictionary][codes[i]];
+   }
+   return kernel->filterToBits(unpackedDense.data(), codes.size(), densityBits[3].data(), filterBits.data());
+}
+
+int32_t filterCodesTVLDispatch(int32_t dictionary) {
+   auto& kernel = filterTVL[static_cast<int>(bestTVLTarget())];
+   auto& values = dictionaries[dictionary];
+   auto dictionaryFilter = dictionaryFilters.get(values.data(), values.size(), [&] {
+      return DictionaryFilter(*kernel, values.data(), values.size());
+   });
+   auto& codes = dictionaryCodes[dictionary];
+   return dictionaryFilter->filterToBits(codes.data(), codes.size(), densityBits[3].data(), filterBits.data());
+}
+
+BENCHMARK(filterDictionaryDecodeFirst) {
+   folly::doNotOptimizeAway(filterCodesDecodeFirst(0));
+}
+BENCHMARK_RELATIVE(filterDictionaryTVLDispatch) {
+   folly::doNotOptimizeAway(filterCodesTVLDispatch(0));
+}
+BENCHMARK(filterSmallDictionaryDecodeFirst) {
+   folly::doNotOptimizeAway(filterCodesDecodeFirst(1));
+}
+BENCHMARK_RELATIVE(filterSmallDictionaryTVLDispatch) {
+   folly::doNotOptimizeAway(filterCodesTVLDispatch(1));
+}
+
+BENCHMARK(hashMixScalar) {
+   hashRows(nullptr, rowHashes);
+   folly::doNotOptimizeAway(rowHashes.back());
+}
+BENCHMARK_RELATIVE(hashMixTVLDispatch) {
+   hashRows(hashTVLKernels(bestTVLTarget()), rowHashes);
+   folly::doNotOptimizeAway(rowHashes.back());
+}
+
+BENCHMARK_NAMED_PARAM(toIndicesScalar, 0_1pct, 0)
+BENCHMARK_RELATIVE_NAMED_PARAM(toIndicesTVLDispatch, 0_1pct, 0)
+BENCHMARK_NAMED_PARAM(toIndicesScalar, 1pct, 1)
+BENCHMARK_RELATIVE_NAMED_PARAM(toIndicesTVLDispatch, 1pct, 1)
+BENCHMARK_NAMED_PARAM(toIndicesScalar, 10pct, 2)
+BENCHMARK_RELATIVE_NAMED_PARAM(toIndicesTVLDispatch, 10pct, 2)
+BENCHMARK_NAMED_PARAM(toIndicesScalar, 50pct, 3)
+BENCHMARK_RELATIVE_NAMED_PARAM(toIndicesTVLDispatch, 50pct, 3)
+BENCHMARK_NAMED_PARAM(toIndicesScalar, 90pct, 4)
+BENCHMARK_RELATIVE_NAMED_PARAM(toIndicesTVLDispatch, 90pct, 4)
+BENCHMARK_NAMED_PARAM(toIndicesScalar, 99pct, 5)
+BENCHMARK_RELATIVE_NAMED_PARAM(toIndicesTVLDispatch, 99pct, 5)
+
+BENCHMARK(bitLogicScalar) {
+   bitLogic(bitsTVLKernels(TVLTarget::kScalar));
+}
+BENCHMARK_RELATIVE(bitLogicTVLDispatch) {
+   bitLogic(nullptr);
+}
+
+BENCHMARK_NAMED_PARAM(scatterBitsSimple, 50pct, 3)
+BENCHMARK_RELATIVE_NAMED_PARAM(scatterBitsScalar, 50pct, 3)
+BENCHMARK_RELATIVE_NAMED_PARAM(scatterBitsSse, 50pct, 3)
+BENCHMARK_RELATIVE_NAMED_PARAM(scatterBitsTVLDispatch, 50pct, 3)
+BENCHMARK_NAMED_PARAM(scatterBitsSimple, 90pct, 4)
+BENCHMARK_RELATIVE_NAMED_PARAM(scatterBitsScalar, 90pct, 4)
+BENCHMARK_RELATIVE_NAMED_PARAM(scatterBitsSse, 90pct, 4)
+BENCHMARK_RELATIVE_NAMED_PARAM(scatterBitsTVLDispatch, 90pct, 4)
+BENCHMARK_NAMED_PARAM(scatterBitsSimple, 99pct, 5)
+BENCHMARK_RELATIVE_NAMED_PARAM(scatterBitsScalar, 99pct, 5)
+BENCHMARK_RELATIVE_NAMED_PARAM(scatterBitsSse, 99pct, 5)
+BENCHMARK_RELATIVE_NAMED_PARAM(scatterBitsTVLDispatch, 99pct, 5)
+
+BENCHMARK(copyBitsScalar) {
+   copyBitsUnaligned(bitsTVLKernels(TVLTarget::kScalar));
+}
+BENCHMARK_RELATIVE(copyBitsTVLDispatch) {
+   copyBitsUnaligned(nullptr);
+}
+
+BENCHMARK(isAllSetNoNulls) {
+   folly::doNotOptimizeAway(bits::isAllSet(noNulls.data(), 0, kNumBits));
+}
+BENCHMARK_RELATIVE(isAllSetNoNullsSummary) {
+   folly::doNotOptimizeAway(noNullsSummary->isAllSet(0, kNumBits));
+}
+
+BENCHMARK(countBitsClusteredNulls) {
+   folly::doNotOptimizeAway(bits::countBits(clusteredNulls.data(), 0, kNumBits));
+}
+BENCHMARK_RELATIVE(countBitsClusteredNullsSummary) {
+   folly::doNotOptimizeAway(clusteredNullsSummary->countBits(0, kNumBits));
+}
+
+BENCHMARK(findFirstBitLateRow) {
+   folly::doNotOptimizeAway(bits::findFirstBit(lateRow.data(), 0, kNumBits));
+}
+BENCHMARK_RELATIVE(findFirstBitLateRowSummary) {
+   folly::doNotOptimizeAway(lateRowSummary->findFirstBit(0, kNumBits));
+}
+
+BENCHMARK(forEachSetBitClusteredNulls) {
+   int64_t sum = 0;
+   bits::forEachSetBit(clusteredNulls.data(), 0, kNumBits, [&](int32_t row) { sum += row; });
+   folly::doNotOptimizeAway(sum);
+}
+BENCHMARK_RELATIVE(forEachSetBitClusteredNullsSummary) {
+   int64_t sum = 0;
+   clusteredNullsSummary->forEachSetBit(0, kNumBits, [&](int32_t row) { sum += row; });
+   folly::doNotOptimizeAway(sum);
+}
+
+// Rows passing a 0.1% and a range predicate, and the rows passing both of
+// the 50% and 99% predicates.
+BENCHMARK(intersectSparseBitmaps) {
+   rowSetResult = rowSetBits[0];
+   bits::andBits(rowSetResult.data(), rowSetBits[3].data(), 0, kRowSetRows);
+   folly::doNotOptimizeAway(bits::countBits(rowSetResult.data(), 0, kRowSetRows));
+}
+BENCHMARK_RELATIVE(intersectSparseRowSets) {
+   folly::doNotOptimizeAway(RowSet::intersect(rowSets[0], rowSets[3]).count());
+}
+BENCHMARK(intersectDenseBitmaps) {
+   rowSetResult = rowSetBits[1];
+   bits::andBits(rowSetResult.data(), rowSetBits[2].data(), 0, kRowSetRows);
+   folly::doNotOptimizeAway(bits::countBits(rowSetResult.data(), 0, kRowSetRows));
+}
+BENCHMARK_RELATIVE(intersectDenseRowSets) {
+   folly::doNotOptimizeAway(RowSet::intersect(rowSets[1], rowSets[2]).count());
+}
+
+// The ranges united with the 0.1% rows, and with the 99% rows: run chunks
+// with array and with run chunks.
+BENCHMARK(uniteSparseBitmaps) {
+   rowSetResult = rowSetBits[0];
+   bits::orBits(rowSetResult.data(), rowSetBits[3].data(), 0, kRowSetRows);
+   folly::doNotOptimizeAway(bits::countBits(rowSetResult.data(), 0, kRowSetRows));
+}
+BENCHMARK_RELATIVE(uniteSparseRowSets) {
+   folly::doNotOptimizeAway(RowSet::unite(rowSets[0], rowSets[3]).count());
+}
+BENCHMARK(uniteRunsBitmaps) {
+   rowSetResult = rowSetBits[2];
+   bits::orBits(rowSetResult.data(), rowSetBits[3].data(), 0, kRowSetRows);
+   folly::doNotOptimizeAway(bits::countBits(rowSetResult.data(), 0, kRowSetRows));
+}
+BENCHMARK_RELATIVE(uniteRunsRowSets) {
+   folly::doNotOptimizeAway(RowSet::unite(rowSets[2], rowSets[3]).count());
+}
+
+BENCHMARK_NAMED_PARAM(memcpyLibc, 7, 7)
+BENCHMARK_RELATIVE_NAMED_PARAM(memcpyTVLDispatch, 7, 7)
+BENCHMARK_NAMED_PARAM(memcpyLibc, 64, 64)
+BENCHMARK_RELATIVE_NAMED_PARAM(memcpyTVLDispatch, 64, 64)
+BENCHMARK_NAMED_PARAM(memcpyLibc, 200, 200)
+BENCHMARK_RELATIVE_NAMED_PARAM(memcpyTVLDispatch, 200, 200)
+BENCHMARK_NAMED_PARAM(memcpyLibc, 4K, 4 << 10)
+BENCHMARK_RELATIVE_NAMED_PARAM(memcpyTVLDispatch, 4K, 4 << 10)
+BENCHMARK_NAMED_PARAM(memcpyLibc, 64K, 64 << 10)
+BENCHMARK_RELATIVE_NAMED_PARAM(memcpyTVLDispatch, 64K, 64 << 10)
+BENCHMARK_NAMED_PARAM(memcpyLibc, 1M, 1 << 20)
+BENCHMARK_RELATIVE_NAMED_PARAM(memcpyTVLDispatch, 1M, 1 << 20)
+BENCHMARK_NAMED_PARAM(memcpyLibc, 32M, kCopyBytes - 64)
+BENCHMARK_RELATIVE_NAMED_PARAM(memcpyTVLDispatch, 32M, kCopyBytes - 64)
+
 int32_t main(int32_t argc, char* argv[]) {
    constexpr int32_t kNumValues = 1000000;
    constexpr int32_t kFilterValues = 1000;
@@ -131,24 +1294,133 @@ int32_t main(int32_t argc, char* argv[]) {
       }
    filter = std::make_unique<BigintValuesUsingHashTable>(
       filterValues.front(), filterValues.back(), filterValues, false);
-#ifdef NEON
-   filter_neon = std::make_unique<BigintValuesUsingHashTableTVL< tvl::simd< int64_t, tvl::neon > > >(
-      filterValues.front(), filterValues.back(), filterValues, false);
-#else
-
-   filter_sse = std::make_unique<BigintValuesUsingHashTableTVL< tvl::simd< int64_t, tvl::sse > > >(
-      filterValues.front(), filterValues.back(), filterValues, false);
-   filter_avx2 = std::make_unique<BigintValuesUsingHashTableTVL< tvl::simd< int64_t, tvl::avx2 > > >(
-      filterValues.front(), filterValues.back(), filterValues, false);
-   filter_avx512 = std::make_unique<BigintValuesUsingHashTableTVL< tvl::simd< int64_t, tvl::avx512 > > >(
-      filterValues.front(), filterValues.back(), filterValues, false);
-#endif
+   for (auto target : {TVLTarget::kScalar, TVLTarget::kNeon, TVLTarget::kSse,
+                       TVLTarget::kAvx2, TVLTarget::kAvx512VL, TVLTarget::kAvx512}) {
+      makeFilterTVL(target, filterValues);
+   }
+   for (auto i = 0; i < kFilterValues; ++i) {
+         excludedValues.push_back(i * 3000);
+      }
+   for (auto fused : {false, true}) {
+      betweenNotIn[fused] = createBetweenNotInTVLKernel(bestTVLTarget(), kLower, kUpper, excludedValues, fused);
+   }
+   std::vector<int64_t> inList;
+   for (auto i = 0; i < 100000; ++i) {
+         if (i % 4 != 0) {
+            inList.push_back(i * 1000);
+         }
+      }
+   conjuncts = {{0, 95'000'000, {}}, {0, 0, inList}, {0, 2'000'000, {}}};
+   for (auto adaptive : {false, true}) {
+      conjunctsTVL[adaptive] = createConjunctsTVLKernel(bestTVLTarget(), conjuncts, adaptive);
+   }
+   std::cout << "FilterTVL dispatches to " << tvlTargetName(bestTVLTarget()) << std::endl;
    denseValues.resize(kNumValues);
    sparseValues.resize(kNumValues);
    for (auto i = 0; i < kNumValues; ++i) {
          denseValues[i] = (folly::Random::rand32() % 3000) * 1000;
          sparseValues[i] = (folly::Random::rand32() % 100000) * 1000;
       }
+   denseValues32.assign(denseValues.begin(), denseValues.end());
+   for (auto i = 0; i < std::size(kDensities); ++i) {
+      densityBits[i].resize(bits::nwords(kNumBits));
+      for (auto bit = 0; bit < kNumBits; ++bit) {
+         bits::setBit(densityBits[i].data(), bit, folly::Random::rand32() % 1000 < kDensities[i]);
+      }
+   }
+   copySource.resize(kCopyBytes);
+   copyTarget.resize(kCopyBytes);
+   for (auto i = 0; i < kCopyBytes; ++i) {
+         copySource[i] = folly::Random::rand32();
+      }
+
+   for (auto* values : {&denseValues, &sparseValues}) {
+      for (auto target : {TVLTarget::kNeon, TVLTarget::kSse, TVLTarget::kAvx2,
+                          TVLTarget::kAvx512VL, TVLTarget::kAvx512}) {
+         verify(target, *values);
+      }
+   }
+   verifyBetweenNotIn();
+   verifyConjuncts();
+   verifyDynamicFilters(filterValues);
+   for (auto i = 0; i < 30'000; ++i) {
+      dynamicKeys.push_back(i * 100);
+   }
+   dynamicFilter = createFilterTVLKernel(bestTVLTarget(), *buildKeys(dynamicKeys, 100'000), false);
+   dynamicHashTable = createFilterTVLKernel(bestTVLTarget(), dynamicKeys, false);
+   // Ten clusters of 5000 nulls, some of them sprinkled with values.
+   for (auto cluster = 0; cluster < 10; ++cluster) {
+      auto begin = (cluster * 104729 + 1000) % (kNumBits - 5000);
+      bits::fillBits(clusteredNulls.data(), begin, begin + 5000, false);
+      for (auto row = begin; cluster % 3 == 0 && row < begin + 5000; row += 7) {
+         bits::setBit(clusteredNulls.data(), row);
+      }
+   }
+   bits::setBit(lateRow.data(), kNumBits - 10);
+   noNullsSummary = std::make_unique<bits::BitmapSummary>(noNulls.data(), kNumBits);
+   clusteredNullsSummary = std::make_unique<bits::BitmapSummary>(clusteredNulls.data(), kNumBits);
+   lateRowSummary = std::make_unique<bits::BitmapSummary>(lateRow.data(), kNumBits);
+   verifyBitmapSummary();
+   for (auto i = 0; i < std::size(rowSets); ++i) {
+      rowSetBits[i].resize(bits::nwords(kRowSetRows));
+      for (int64_t row = 0; row < kRowSetRows; ++row) {
+         auto random = folly::Random::rand32() % 1000;
+         bits::setBit(rowSetBits[i].data(), row, i == 0 ? random < 1 : i == 1 ? random < 500 : i == 2 ? random < 990 : row / 10000 % 3 == 1);
+      }
+      rowSets[i] = RowSet::fromBits(rowSetBits[i].data(), 0, kRowSetRows);
+   }
+   verifyRowSets();
+   filterRowsTVL = createConjunctsTVLKernel(bestTVLTarget(), {TVLConjunct{0, 0, filterValues}}, false);
+   filterBits.resize(bits::nwords(kNumValues));
+   packedDense = packBits(denseValues, kPackedBits);
+   unpackedDense.resize(kNumValues);
+   sortedValues = denseValues;
+   std::sort(sortedValues.begin(), sortedValues.end());
+   for (auto encoding : {0, 1}) {
+      encodedCodes[encoding].resize((kNumValues + kBlockValues - 1) / kBlockValues);
+      for (auto i = 0; i * kBlockValues < kNumValues; ++i) {
+         encodedBlocks[encoding].push_back(encodeBlock(
+            sortedValues.data() + i * kBlockValues, std::min(kBlockValues, kNumValues - i * kBlockValues),
+            static_cast<TVLEncodedBlock::Encoding>(encoding), encodedCodes[encoding][i]));
+      }
+   }
+   for (auto i = 0; i < kNumValues; ++i) {
+      if (i == 0 || sortedValues[i] != sortedValues[i - 1]) {
+         runValues.push_back(sortedValues[i]);
+         runLengths.push_back(0);
+      }
+      ++runLengths.back();
+   }
+   for (auto i : {0, 1}) {
+      for (auto entry = 0; entry < kDictionarySizes[i]; ++entry) {
+         dictionaries[i].push_back(entry * (i == 0 ? 500 : 1500));
+      }
+      dictionaryCodes[i].resize(kNumValues);
+      for (auto& code : dictionaryCodes[i]) {
+         code = folly::Random::rand32() % kDictionarySizes[i];
+      }
+   }
+   verifyDictionaryFilters();
+   for (auto target : {TVLTarget::kScalar, TVLTarget::kNeon, TVLTarget::kSse,
+                       TVLTarget::kAvx2, TVLTarget::kAvx512VL, TVLTarget::kAvx512}) {
+      verify32(target);
+      verifyFilterToBits(filterTVL[static_cast<int>(target)].get());
+      verifyFilterPacked(filterTVL[static_cast<int>(target)].get());
+      verifyFilterBlocks(filterTVL[static_cast<int>(target)].get());
+      verifyFilterRuns(filterTVL[static_cast<int>(target)].get());
+      verifyGatherBits(target);
+      verifyTail(target);
+      verifyHash(target);
+      verifyMemory(target);
+      verifyToIndices(target);
+      verifyBitLogic(target);
+      verifyCopyAndScatter(target);
+   }
+   // The conjuncts kernel decodes every input into batches of its own.
+   verifyFilterToBits(filterRowsTVL.get());
+   verifyFilterPacked(filterRowsTVL.get());
+   verifyFilterBlocks(filterRowsTVL.get());
+   verifyFilterRuns(filterRowsTVL.get());
 
    folly::runBenchmarks();
    return 0;
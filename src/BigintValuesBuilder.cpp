@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BigintValuesBuilder.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace facebook::velox::common{
+
+   namespace{
+      int32_t log2Ceil( int64_t value ){
+         int32_t result = 0;
+         while( ( 1LL<<result ) < value )
+            {
+               ++result;
+            }
+         return result;
+      }
+   } // namespace
+
+   BigintValuesBuilder::BigintValuesBuilder( int64_t maxValues, int64_t bloomBytes )
+      : maxValues_( maxValues ),
+        log2BloomWords_( std::max( log2Ceil( bloomBytes / 8 ), 3 ) ),
+        min_( std::numeric_limits< int64_t >::max( ) ),
+        max_( std::numeric_limits< int64_t >::min( ) ),
+        shards_( new Shard[kShards] ){ }
+
+   void BigintValuesBuilder::add( const int64_t * keys, int32_t size ){
+      if( size == 0 )
+         {
+            return;
+         }
+      auto [ low, high ] = std::minmax_element( keys, keys+size );
+      for( auto current = min_.load( std::memory_order_relaxed ); *low < current; )
+         {
+            min_.compare_exchange_weak( current, *low, std::memory_order_relaxed );
+         }
+      for( auto current = max_.load( std::memory_order_relaxed ); *high > current; )
+         {
+            max_.compare_exchange_weak( current, *high, std::memory_order_relaxed );
+         }
+
+      // Partition the batch so every shard is locked once.
+      std::vector< int64_t > partitions[kShards];
+      for( int32_t i = 0; i < size; ++i )
+         {
+            partitions[ ( static_cast< uint64_t >( keys[ i ] )*kBloomMultiplier )>>60 ].push_back( keys[ i ] );
+         }
+      for( int32_t shard = 0; shard < kShards; ++shard )
+         {
+            auto & partition = partitions[ shard ];
+            if( partition.empty( ) )
+               {
+                  continue;
+               }
+            {
+               std::lock_guard< std::mutex > lock( shards_[ shard ].mutex );
+               if( !overflowed_ )
+                  {
+                     auto & values = shards_[ shard ].values;
+                     auto const before = values.size( );
+                     values.insert( partition.begin( ), partition.end( ) );
+                     distinct_.fetch_add( values.size( )-before, std::memory_order_relaxed );
+                     continue;
+                  }
+            }
+            addToBloomFilter( partition.data( ), partition.size( ) );
+         }
+
+      if( distinct_.load( std::memory_order_relaxed ) > maxValues_ )
+         {
+            std::unique_lock< std::mutex > locks[kShards];
+            for( int32_t shard = 0; shard < kShards; ++shard )
+               {
+                  locks[ shard ] = std::unique_lock< std::mutex >( shards_[ shard ].mutex );
+               }
+            if( !overflowed_ )
+               {
+                  overflow( );
+               }
+         }
+   }
+
+   void BigintValuesBuilder::overflow( ){
+      bloom_.reset( new std::atomic< uint64_t >[1LL<<log2BloomWords_]( ) );
+      for( int32_t shard = 0; shard < kShards; ++shard )
+         {
+            auto & values = shards_[ shard ].values;
+            std::vector< int64_t > keys( values.begin( ), values.end( ) );
+            addToBloomFilter( keys.data( ), keys.size( ) );
+            std::unordered_set< int64_t >( ).swap( values );
+         }
+      overflowed_ = true;
+   }
+
+   void BigintValuesBuilder::addToBloomFilter( const int64_t * keys, int32_t size ){
+      for( int32_t i = 0; i < size; ++i )
+         {
+            bloom_[ bloomWord( keys[ i ], log2BloomWords_ ) ].fetch_or( bloomBits( keys[ i ], log2BloomWords_ ), std::memory_order_relaxed );
+         }
+   }
+
+   BigintValuesBuilder::Kind BigintValuesBuilder::kind( ) const{
+      if( overflowed_ )
+         {
+            return Kind::kBloomFilter;
+         }
+      auto const distinct = distinct_.load( std::memory_order_relaxed );
+      if( distinct == 0 )
+         {
+            return Kind::kEmpty;
+         }
+      // max - min may not fit into int64_t.
+      auto const range = static_cast< uint64_t >( max( ) )-static_cast< uint64_t >( min( ) );
+      if( range == static_cast< uint64_t >( distinct-1 ) )
+         {
+            return Kind::kRange;
+         }
+      if( range < static_cast< uint64_t >( kMaxBitmaskBits ) && range / kMaxBitmaskBitsPerValue < static_cast< uint64_t >( distinct ) )
+         {
+            return Kind::kBitmask;
+         }
+      return Kind::kHashTable;
+   }
+
+   int64_t BigintValuesBuilder::distinctCount( ) const{
+      if( !overflowed_ )
+         {
+            return distinct_.load( std::memory_order_relaxed );
+         }
+      // n = -m / k * ln( 1 - X / m ) for X of m bits set by k bits per key.
+      int64_t set = 0;
+      for( int64_t i = 0; i < ( 1LL<<log2BloomWords_ ); ++i )
+         {
+            set += __builtin_popcountll( bloom_[ i ].load( std::memory_order_relaxed ) );
+         }
+      double const bits = 64.0*( 1LL<<log2BloomWords_ );
+      if( set >= bits )
+         {
+            return std::numeric_limits< int64_t >::max( );
+         }
+      return std::llround( -bits / 3 * std::log1p( -set / bits ) );
+   }
+
+   std::vector< int64_t > BigintValuesBuilder::values( ) const{
+      std::vector< int64_t > result;
+      if( overflowed_ )
+         {
+            return result;
+         }
+      result.reserve( distinct_.load( std::memory_order_relaxed ) );
+      for( int32_t shard = 0; shard < kShards; ++shard )
+         {
+            result.insert( result.end( ), shards_[ shard ].values.begin( ), shards_[ shard ].values.end( ) );
+         }
+      std::sort( result.begin( ), result.end( ) );
+      return result;
+   }
+
+   std::vector< uint64_t > BigintValuesBuilder::bloomFilter( ) const{
+      std::vector< uint64_t > result;
+      if( !overflowed_ )
+         {
+            return result;
+         }
+      result.resize( 1LL<<log2BloomWords_ );
+      for( size_t i = 0; i < result.size( ); ++i )
+         {
+            result[ i ] = bloom_[ i ].load( std::memory_order_relaxed );
+         }
+      return result;
+   }
+
+} // namespace facebook::velox::common
@@ -15,114 +15,112 @@
  */
 
 #include "BitUtil.h"
-#ifdef NEON
-#include <arm_neon.h>
-#else
-#include <immintrin.h>
-#endif
 #include "Exceptions.h"
+#include "FilterTVLDispatch.h"
 #include "ProcessBase.h"
 
 namespace facebook::velox::bits {
 
 namespace {
-// Naive implementation that does not rely on BMI2.
-void scatterBitsSimple(
-    int32_t numSource,
-    int32_t numTarget,
-    const char* source,
-    const uint64_t* targetMask,
-    char* target) {
-  int64_t from = numSource - 1;
-  for (int64_t to = numTarget - 1; to >= 0; to--) {
-    bool maskIsSet = bits::isBitSet(targetMask, to);
-    bits::setBit(target, to, maskIsSet && bits::isBitSet(source, from));
-    from -= maskIsSet ? 1 : 0;
-  }
+// Resolved once, so the first bits:: call that reaches the TVL kernels must
+// come after flag parsing (see bestTVLTarget()).
+const common::BitsTVLKernels& bitsKernels() {
+  static const auto* kernels =
+      common::bitsTVLKernels(common::bestTVLTarget());
+  return *kernels;
 }
 
-// Fetches 'numBits' bits of data, from data starting at lastBit -
-// numbits (inclusive) and ending at lastBit (exclusive). 'lastBit' is
-// updated to be the bit offset of the lowest returned bit. Successive
-// calls will go through 'data' from high to low in consecutive chunks
-// of up to 64 bits each.
-uint64_t getBitField(const char* data, int32_t numBits, int32_t& lastBit) {
-  int32_t highByte = lastBit / 8;
-  int32_t lowByte = (lastBit - numBits) / 8;
-  int32_t lowBit = (lastBit - numBits) & 7;
-  uint64_t bits = *reinterpret_cast<const uint64_t*>(data + lowByte) >> lowBit;
-  if (numBits + lowBit > 64) {
-    auto fromNextByte = numBits + lowBit - 64;
-    uint8_t lastBits = *reinterpret_cast<const uint8_t*>(data + highByte) &
-        bits::lowMask(fromNextByte);
-    bits |= static_cast<uint64_t>(lastBits) << (64 - lowBit);
-  }
-  lastBit -= numBits;
-  return bits;
+// pdep is microcoded on some hosts. With --bmi2=false scatterBits stays on
+// the SSE kernels, which deposit through a byte table instead.
+const common::BitsTVLKernels& scatterKernels() {
+  static const auto* kernels = [] {
+    auto target = common::bestTVLTarget();
+    if (target >= common::TVLTarget::kAvx2 && !process::hasBmi2()) {
+      target = common::TVLTarget::kSse;
+    }
+    return common::bitsTVLKernels(target);
+  }();
+  return *kernels;
 }
 } // namespace
 
-#ifndef NEON
-__attribute__((__target__("bmi2")))
-#endif
+namespace detail {
+void andRangeTVL(
+    bool negate,
+    uint64_t* target,
+    const uint64_t* left,
+    const uint64_t* right,
+    int32_t begin,
+    int32_t end) {
+  auto& kernels = bitsKernels();
+  (negate ? kernels.andWithNegatedBits : kernels.andBits)(
+      target, left, right, begin, end);
+}
+
+void orRangeTVL(
+    bool negate,
+    uint64_t* target,
+    const uint64_t* left,
+    const uint64_t* right,
+    int32_t begin,
+    int32_t end) {
+  auto& kernels = bitsKernels();
+  (negate ? kernels.orWithNegatedBits : kernels.orBits)(
+      target, left, right, begin, end);
+}
+
+void negateTVL(char* bits, int32_t size) {
+  bitsKernels().negate(bits, size);
+}
+
+int32_t toIndicesTVL(
+    const uint64_t* bits,
+    int32_t begin,
+    int32_t end,
+    int32_t* indices) {
+  return bitsKernels().toIndices(bits, begin, end, indices);
+}
+
+int32_t countBitsTVL(const uint64_t* bits, int32_t begin, int32_t end) {
+  return bitsKernels().countBits(bits, begin, end);
+}
+
+void copyBitsTVL(
+    const uint64_t* source,
+    uint64_t sourceOffset,
+    uint64_t* target,
+    uint64_t targetOffset,
+    uint64_t numBits) {
+  bitsKernels().copyBits(
+      source, sourceOffset, target, targetOffset, numBits);
+}
+} // namespace detail
+
 void scatterBits(
     int32_t numSource,
     int32_t numTarget,
     const char* source,
     const uint64_t* targetMask,
     char* target) {
-  if (!process::hasBmi2()) {
-    scatterBitsSimple(numSource, numTarget, source, targetMask, target);
-    return;
-  }
-  int32_t highByte = numTarget / 8;
-  int32_t highBit = numTarget & 7;
-  int lowByte = std::max(0, highByte - 7);
-  auto maskAsBytes = reinterpret_cast<const char*>(targetMask);
-  // Loop from top to bottom of 'targetMask' up to 64 bits at a time,
-  // with a partial word at either end. Count the set bits and fetch
-  // as many consecutive bits of source data. Scatter the source bits
-  // over the set bits of the target mask with pdep and write the
-  // result into 'target'.
-  for (;;) {
-    auto numBitsToWrite = (highByte - lowByte) * 8 + highBit;
-    if (numBitsToWrite == 64) {
-      uint64_t mask =
-          *(reinterpret_cast<const uint64_t*>(maskAsBytes + lowByte));
-      int32_t consume = __builtin_popcountll(mask);
-      uint64_t bits = getBitField(source, consume, numSource);
-#ifdef NEON
-      *reinterpret_cast<uint64_t*>(target + lowByte) = ( ( bits >> 62 ) & 0b10 ) | ( bits >> 63 );
-#else
-      *reinterpret_cast<uint64_t*>(target + lowByte) = _pdep_u64(bits, mask);
-#endif
-    } else {
-      auto writeMask = bits::lowMask(numBitsToWrite);
-      uint64_t mask =
-          *(reinterpret_cast<const uint64_t*>(maskAsBytes + lowByte)) &
-          writeMask;
-      int32_t consume = __builtin_popcountll(mask);
-      uint64_t bits = getBitField(source, consume, numSource);
-      auto targetPtr = reinterpret_cast<uint64_t*>(target + lowByte);
-#ifdef NEON
-      uint64_t newBits = ( ( bits >> 62 ) & 0b10 ) | ( bits >> 63 );
-#else
-      uint64_t newBits = _pdep_u64(bits, mask);
-#endif
-      *targetPtr = (*targetPtr & ~writeMask) | (newBits & writeMask);
-    }
-    VELOX_DCHECK_GE(numSource, 0);
-    if (!lowByte) {
-      break;
-    }
-    highByte = lowByte;
-    highBit = 0;
-    lowByte = std::max(lowByte - 8, 0);
-  }
+  // Checked here so that Exceptions.h stays out of the per-ISA kernels.
+  VELOX_DCHECK_GE(numSource, 0);
   VELOX_DCHECK_EQ(
+      countBits(targetMask, 0, numTarget),
       numSource,
-      0,
       "scatterBits expects to have numSource bits set in targetMask");
+  scatterKernels().scatterBits(
+      numSource, numTarget, source, targetMask, target);
+}
+
+int32_t gatherBits(
+    const uint64_t* bits,
+    int32_t numBits,
+    const int32_t* indices,
+    int32_t size,
+    const uint64_t* selection,
+    uint64_t* result) {
+  return bitsKernels().gatherBits(
+      bits, numBits, indices, size, selection, result);
 }
 
 } // namespace facebook::velox::bits
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "DictionaryFilter.h"
+
+#include <cstring>
+
+#include "BitUtil.h"
+#include "FilterTVLDispatch.h"
+
+namespace facebook::velox::common{
+
+   DictionaryFilter::DictionaryFilter( const FilterTVLKernel & kernel, const int64_t * dictionary, int32_t size )
+      : DictionaryFilter( size ){
+      numPassing_ = kernel.filterToBits( dictionary, size, nullptr, passing_.data( ) );
+   }
+
+   int32_t DictionaryFilter::filterToBits( const int32_t * codes, int32_t size, const uint64_t * selection, uint64_t * result ) const{
+      auto const numWords = bits::nwords( size );
+      if( numPassing_ == 0 || size == 0 )
+         {
+            std::memset( result, 0, numWords*sizeof( uint64_t ) );
+            return 0;
+         }
+      if( numPassing_ == size_ )
+         {
+            if( selection )
+               {
+                  std::memcpy( result, selection, numWords*sizeof( uint64_t ) );
+               }
+            else
+               {
+                  std::memset( result, 0xff, numWords*sizeof( uint64_t ) );
+               }
+            if( size % 64 != 0 )
+               {
+                  result[ numWords-1 ] &= bits::lowMask( size % 64 );
+               }
+            return selection ? bits::countBits( result, 0, size ) : size;
+         }
+      return bits::gatherBits( passing_.data( ), size_, codes, size, selection, result );
+   }
+
+} // namespace facebook::velox::common
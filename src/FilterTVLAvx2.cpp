@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NEON
+// Headers shared with other translation units go before TVL_TARGET_PUSH.
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+#include <immintrin.h>
+
+#include "BigintValuesBuilder.h"
+#include "FilterMisc.h"
+#include "FilterTVLDispatch.h"
+
+TVL_TARGET_PUSH( "avx2,bmi,bmi2,popcnt" )
+#include "FilterTVLDispatch-inl.h"
+
+namespace facebook::velox::common::detail{
+   std::unique_ptr< FilterTVLKernel > createFilterTVLKernelAvx2( const std::vector< int64_t > & values, bool nullAllowed ){
+      return createFilterTVLKernelFor< tvl::simd< int64_t, tvl::avx2 >, TVLTarget::kAvx2 >( values, nullAllowed );
+   }
+
+   std::unique_ptr< FilterTVLKernel > createFilterTVLKernelAvx2( const BigintValuesBuilder & builder, bool nullAllowed ){
+      return createFilterTVLKernelFor< tvl::simd< int64_t, tvl::avx2 >, TVLTarget::kAvx2 >( builder, nullAllowed );
+   }
+
+   std::unique_ptr< FilterTVLKernel > createBetweenNotInTVLKernelAvx2( int64_t lower, int64_t upper, const std::vector< int64_t > & excluded, bool fused ){
+      return createBetweenNotInTVLKernelFor< tvl::simd< int64_t, tvl::avx2 >, TVLTarget::kAvx2 >( lower, upper, excluded, fused );
+   }
+
+   std::unique_ptr< FilterTVLKernel > createConjunctsTVLKernelAvx2( const std::vector< TVLConjunct > & conjuncts, bool adaptive ){
+      return createConjunctsTVLKernelFor< tvl::simd< int64_t, tvl::avx2 >, TVLTarget::kAvx2 >( conjuncts, adaptive );
+   }
+
+   const HashTVLKernels & hashTVLKernelsAvx2( ){
+      return hashTVLKernelsFor< tvl::simd< int64_t, tvl::avx2 > >( );
+   }
+
+   const BitsTVLKernels & bitsTVLKernelsAvx2( ){
+      return bitsTVLKernelsFor< tvl::simd< int64_t, tvl::avx2 > >( );
+   }
+
+   const MemoryTVLKernels & memoryTVLKernelsAvx2( ){
+      return memoryTVLKernelsFor< tvl::simd< int64_t, tvl::avx2 > >( );
+   }
+} // namespace facebook::velox::common::detail
+TVL_TARGET_POP( )
+#endif
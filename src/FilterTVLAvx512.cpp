@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NEON
+// Headers shared with other translation units go before TVL_TARGET_PUSH.
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+#include <immintrin.h>
+
+#include "BigintValuesBuilder.h"
+#include "FilterMisc.h"
+#include "FilterTVLDispatch.h"
+
+TVL_TARGET_PUSH( "avx512f,avx512vl,avx512dq,avx512bw,avx512cd,avx2,bmi,bmi2,popcnt" )
+#include "FilterTVLDispatch-inl.h"
+
+namespace facebook::velox::common::detail{
+   // 256-bit registers with AVX-512VL masks avoid the 512-bit frequency license.
+   std::unique_ptr< FilterTVLKernel > createFilterTVLKernelAvx512VL( const std::vector< int64_t > & values, bool nullAllowed ){
+      return createFilterTVLKernelFor< tvl::simd< int64_t, tvl::avx512, 256 >, TVLTarget::kAvx512VL >( values, nullAllowed );
+   }
+
+   std::unique_ptr< FilterTVLKernel > createFilterTVLKernelAvx512VL( const BigintValuesBuilder & builder, bool nullAllowed ){
+      return createFilterTVLKernelFor< tvl::simd< int64_t, tvl::avx512, 256 >, TVLTarget::kAvx512VL >( builder, nullAllowed );
+   }
+
+   std::unique_ptr< FilterTVLKernel > createBetweenNotInTVLKernelAvx512VL( int64_t lower, int64_t upper, const std::vector< int64_t > & excluded, bool fused ){
+      return createBetweenNotInTVLKernelFor< tvl::simd< int64_t, tvl::avx512, 256 >, TVLTarget::kAvx512VL >( lower, upper, excluded, fused );
+   }
+
+   std::unique_ptr< FilterTVLKernel > createConjunctsTVLKernelAvx512VL( const std::vector< TVLConjunct > & conjuncts, bool adaptive ){
+      return createConjunctsTVLKernelFor< tvl::simd< int64_t, tvl::avx512, 256 >, TVLTarget::kAvx512VL >( conjuncts, adaptive );
+   }
+
+   const HashTVLKernels & hashTVLKernelsAvx512VL( ){
+      return hashTVLKernelsFor< tvl::simd< int64_t, tvl::avx512, 256 > >( );
+   }
+
+   const BitsTVLKernels & bitsTVLKernelsAvx512VL( ){
+      return bitsTVLKernelsFor< tvl::simd< int64_t, tvl::avx512, 256 > >( );
+   }
+
+   const MemoryTVLKernels & memoryTVLKernelsAvx512VL( ){
+      return memoryTVLKernelsFor< tvl::simd< int64_t, tvl::avx512, 256 > >( );
+   }
+
+   std::unique_ptr< FilterTVLKernel > createFilterTVLKernelAvx512( const std::vector< int64_t > & values, bool nullAllowed ){
+      return createFilterTVLKernelFor< tvl::simd< int64_t, tvl::avx512 >, TVLTarget::kAvx512 >( values, nullAllowed );
+   }
+
+   std::unique_ptr< FilterTVLKernel > createFilterTVLKernelAvx512( const BigintValuesBuilder & builder, bool nullAllowed ){
+      return createFilterTVLKernelFor< tvl::simd< int64_t, tvl::avx512 >, TVLTarget::kAvx512 >( builder, nullAllowed );
+   }
+
+   std::unique_ptr< FilterTVLKernel > createBetweenNotInTVLKernelAvx512( int64_t lower, int64_t upper, const std::vector< int64_t > & excluded, bool fused ){
+      return createBetweenNotInTVLKernelFor< tvl::simd< int64_t, tvl::avx512 >, TVLTarget::kAvx512 >( lower, upper, excluded, fused );
+   }
+
+   std::unique_ptr< FilterTVLKernel > createConjunctsTVLKernelAvx512( const std::vector< TVLConjunct > & conjuncts, bool adaptive ){
+      return createConjunctsTVLKernelFor< tvl::simd< int64_t, tvl::avx512 >, TVLTarget::kAvx512 >( conjuncts, adaptive );
+   }
+
+   const HashTVLKernels & hashTVLKernelsAvx512( ){
+      return hashTVLKernelsFor< tvl::simd< int64_t, tvl::avx512 > >( );
+   }
+
+   const BitsTVLKernels & bitsTVLKernelsAvx512( ){
+      return bitsTVLKernelsFor< tvl::simd< int64_t, tvl::avx512 > >( );
+   }
+
+   const MemoryTVLKernels & memoryTVLKernelsAvx512( ){
+      return memoryTVLKernelsFor< tvl::simd< int64_t, tvl::avx512 > >( );
+   }
+} // namespace facebook::velox::common::detail
+TVL_TARGET_POP( )
+#endif
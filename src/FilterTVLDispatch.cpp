@@ -0,0 +1,325 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+
+#include "FilterTVLDispatch.h"
+#include "FilterTVLDispatch-inl.h"
+#include "ProcessBase.h"
+
+namespace facebook::velox::common{
+
+   namespace detail{
+      // The scalar backend only needs the baseline ISA of the build.
+      std::unique_ptr< FilterTVLKernel > createFilterTVLKernelScalar( const std::vector< int64_t > & values, bool nullAllowed ){
+         return createFilterTVLKernelFor< tvl::simd< int64_t, tvl::scalar >, TVLTarget::kScalar >( values, nullAllowed );
+      }
+
+      std::unique_ptr< FilterTVLKernel > createFilterTVLKernelScalar( const BigintValuesBuilder & builder, bool nullAllowed ){
+         return createFilterTVLKernelFor< tvl::simd< int64_t, tvl::scalar >, TVLTarget::kScalar >( builder, nullAllowed );
+      }
+
+      std::unique_ptr< FilterTVLKernel > createBetweenNotInTVLKernelScalar( int64_t lower, int64_t upper, const std::vector< int64_t > & excluded, bool fused ){
+         return createBetweenNotInTVLKernelFor< tvl::simd< int64_t, tvl::scalar >, TVLTarget::kScalar >( lower, upper, excluded, fused );
+      }
+
+      std::unique_ptr< FilterTVLKernel > createConjunctsTVLKernelScalar( const std::vector< TVLConjunct > & conjuncts, bool adaptive ){
+         return createConjunctsTVLKernelFor< tvl::simd< int64_t, tvl::scalar >, TVLTarget::kScalar >( conjuncts, adaptive );
+      }
+
+      const HashTVLKernels & hashTVLKernelsScalar( ){
+         return hashTVLKernelsFor< tvl::simd< int64_t, tvl::scalar > >( );
+      }
+
+      const BitsTVLKernels & bitsTVLKernelsScalar( ){
+         return bitsTVLKernelsFor< tvl::simd< int64_t, tvl::scalar > >( );
+      }
+
+      const MemoryTVLKernels & memoryTVLKernelsScalar( ){
+         return memoryTVLKernelsFor< tvl::simd< int64_t, tvl::scalar > >( );
+      }
+   } // namespace detail
+
+   const char * tvlTargetName( TVLTarget target ){
+      switch( target )
+         {
+            case TVLTarget::kScalar:
+               return "scalar";
+            case TVLTarget::kNeon:
+               return "neon";
+            case TVLTarget::kSse:
+               return "sse";
+            case TVLTarget::kAvx2:
+               return "avx2";
+            case TVLTarget::kAvx512VL:
+               return "avx512vl";
+            case TVLTarget::kAvx512:
+               return "avx512";
+         }
+      return "unknown";
+   }
+
+   bool tvlTargetSupported( TVLTarget target ){
+      switch( target )
+         {
+            case TVLTarget::kScalar:
+               return true;
+#ifdef NEON
+            case TVLTarget::kNeon:
+               return true;
+#else
+            case TVLTarget::kSse:
+               return process::hasSse42( );
+            case TVLTarget::kAvx2:
+               return process::hasAvx2( );
+            case TVLTarget::kAvx512VL:
+            case TVLTarget::kAvx512:
+               return process::hasAvx512( );
+#endif
+            default:
+               return false;
+         }
+   }
+
+   TVLTarget bestTVLTarget( ){
+      static const TVLTarget best = []( ){
+         auto const avx512 = process::preferAvx512VL( ) ? TVLTarget::kAvx512VL : TVLTarget::kAvx512;
+         for( auto target : { avx512, TVLTarget::kAvx2, TVLTarget::kSse, TVLTarget::kNeon } )
+            {
+               if( tvlTargetSupported( target ) )
+                  {
+                     return target;
+                  }
+            }
+         return TVLTarget::kScalar;
+      }( );
+      return best;
+   }
+
+   std::unique_ptr< FilterTVLKernel > createFilterTVLKernel(
+      TVLTarget target, const std::vector< int64_t > & values, bool nullAllowed
+   ){
+      if( !tvlTargetSupported( target ) )
+         {
+            return nullptr;
+         }
+      switch( target )
+         {
+            case TVLTarget::kScalar:
+               return detail::createFilterTVLKernelScalar( values, nullAllowed );
+#ifdef NEON
+            case TVLTarget::kNeon:
+               return detail::createFilterTVLKernelNeon( values, nullAllowed );
+#else
+            case TVLTarget::kSse:
+               return detail::createFilterTVLKernelSse( values, nullAllowed );
+            case TVLTarget::kAvx2:
+               return detail::createFilterTVLKernelAvx2( values, nullAllowed );
+            case TVLTarget::kAvx512VL:
+               return detail::createFilterTVLKernelAvx512VL( values, nullAllowed );
+            case TVLTarget::kAvx512:
+               return detail::createFilterTVLKernelAvx512( values, nullAllowed );
+#endif
+            default:
+               return nullptr;
+         }
+   }
+
+   std::unique_ptr< FilterTVLKernel > createFilterTVLKernel(
+      TVLTarget target, const BigintValuesBuilder & builder, bool nullAllowed
+   ){
+      if( !tvlTargetSupported( target ) )
+         {
+            return nullptr;
+         }
+      switch( target )
+         {
+            case TVLTarget::kScalar:
+               return detail::createFilterTVLKernelScalar( builder, nullAllowed );
+#ifdef NEON
+            case TVLTarget::kNeon:
+               return detail::createFilterTVLKernelNeon( builder, nullAllowed );
+#else
+            case TVLTarget::kSse:
+               return detail::createFilterTVLKernelSse( builder, nullAllowed );
+            case TVLTarget::kAvx2:
+               return detail::createFilterTVLKernelAvx2( builder, nullAllowed );
+            case TVLTarget::kAvx512VL:
+               return detail::createFilterTVLKernelAvx512VL( builder, nullAllowed );
+            case TVLTarget::kAvx512:
+               return detail::createFilterTVLKernelAvx512( builder, nullAllowed );
+#endif
+            default:
+               return nullptr;
+         }
+   }
+
+   std::unique_ptr< FilterTVLKernel > createBetweenNotInTVLKernel(
+      TVLTarget target, int64_t lower, int64_t upper, const std::vector< int64_t > & excluded, bool fused
+   ){
+      if( !tvlTargetSupported( target ) )
+         {
+            return nullptr;
+         }
+      switch( target )
+         {
+            case TVLTarget::kScalar:
+               return detail::createBetweenNotInTVLKernelScalar( lower, upper, excluded, fused );
+#ifdef NEON
+            case TVLTarget::kNeon:
+               return detail::createBetweenNotInTVLKernelNeon( lower, upper, excluded, fused );
+#else
+            case TVLTarget::kSse:
+               return detail::createBetweenNotInTVLKernelSse( lower, upper, excluded, fused );
+            case TVLTarget::kAvx2:
+               return detail::createBetweenNotInTVLKernelAvx2( lower, upper, excluded, fused );
+            case TVLTarget::kAvx512VL:
+               return detail::createBetweenNotInTVLKernelAvx512VL( lower, upper, excluded, fused );
+            case TVLTarget::kAvx512:
+               return detail::createBetweenNotInTVLKernelAvx512( lower, upper, excluded, fused );
+#endif
+            default:
+               return nullptr;
+         }
+   }
+
+   std::unique_ptr< FilterTVLKernel > createConjunctsTVLKernel(
+      TVLTarget target, const std::vector< TVLConjunct > & conjuncts, bool adaptive
+   ){
+      if( !tvlTargetSupported( target ) )
+         {
+            return nullptr;
+         }
+      switch( target )
+         {
+            case TVLTarget::kScalar:
+               return detail::createConjunctsTVLKernelScalar( conjuncts, adaptive );
+#ifdef NEON
+            case TVLTarget::kNeon:
+               return detail::createConjunctsTVLKernelNeon( conjuncts, adaptive );
+#else
+            case TVLTarget::kSse:
+               return detail::createConjunctsTVLKernelSse( conjuncts, adaptive );
+            case TVLTarget::kAvx2:
+               return detail::createConjunctsTVLKernelAvx2( conjuncts, adaptive );
+            case TVLTarget::kAvx512VL:
+               return detail::createConjunctsTVLKernelAvx512VL( conjuncts, adaptive );
+            case TVLTarget::kAvx512:
+               return detail::createConjunctsTVLKernelAvx512( conjuncts, adaptive );
+#endif
+            default:
+               return nullptr;
+         }
+   }
+
+   const HashTVLKernels * hashTVLKernels( TVLTarget target ){
+      if( !tvlTargetSupported( target ) )
+         {
+            return nullptr;
+         }
+      switch( target )
+         {
+            case TVLTarget::kScalar:
+               return &detail::hashTVLKernelsScalar( );
+#ifdef NEON
+            case TVLTarget::kNeon:
+               return &detail::hashTVLKernelsNeon( );
+#else
+            case TVLTarget::kSse:
+               return &detail::hashTVLKernelsSse( );
+            case TVLTarget::kAvx2:
+               return &detail::hashTVLKernelsAvx2( );
+            case TVLTarget::kAvx512VL:
+               return &detail::hashTVLKernelsAvx512VL( );
+            case TVLTarget::kAvx512:
+               return &detail::hashTVLKernelsAvx512( );
+#endif
+            default:
+               return nullptr;
+         }
+   }
+
+   const BitsTVLKernels * bitsTVLKernels( TVLTarget target ){
+      if( !tvlTargetSupported( target ) )
+         {
+            return nullptr;
+         }
+      switch( target )
+         {
+            case TVLTarget::kScalar:
+               return &detail::bitsTVLKernelsScalar( );
+#ifdef NEON
+            case TVLTarget::kNeon:
+               return &detail::bitsTVLKernelsNeon( );
+#else
+            case TVLTarget::kSse:
+               return &detail::bitsTVLKernelsSse( );
+            case TVLTarget::kAvx2:
+               return &detail::bitsTVLKernelsAvx2( );
+            case TVLTarget::kAvx512VL:
+               return &detail::bitsTVLKernelsAvx512VL( );
+            case TVLTarget::kAvx512:
+               return &detail::bitsTVLKernelsAvx512( );
+#endif
+            default:
+               return nullptr;
+         }
+   }
+
+   const MemoryTVLKernels * memoryTVLKernels( TVLTarget target ){
+      if( !tvlTargetSupported( target ) )
+         {
+            return nullptr;
+         }
+      switch( target )
+         {
+            case TVLTarget::kScalar:
+               return &detail::memoryTVLKernelsScalar( );
+#ifdef NEON
+            case TVLTarget::kNeon:
+               return &detail::memoryTVLKernelsNeon( );
+#else
+            case TVLTarget::kSse:
+               return &detail::memoryTVLKernelsSse( );
+            case TVLTarget::kAvx2:
+               return &detail::memoryTVLKernelsAvx2( );
+            case TVLTarget::kAvx512VL:
+               return &detail::memoryTVLKernelsAvx512VL( );
+            case TVLTarget::kAvx512:
+               return &detail::memoryTVLKernelsAvx512( );
+#endif
+            default:
+               return nullptr;
+         }
+   }
+
+   int64_t tvlStreamingBytes( ){
+      // Server parts report the cache shared by all cores, so the threshold is
+      // capped at simd::kStreamingBytes.
+      static const int64_t bytes = [ ]( ){
+         auto cacheBytes = process::lastLevelCacheBytes( );
+         return cacheBytes > 0 ? std::min( cacheBytes / 2, simd::kStreamingBytes ) : simd::kStreamingBytes;
+      }( );
+      return bytes;
+   }
+
+   namespace detail{
+      void tvlMemcpyDispatched( void * to, const void * from, int64_t bytes ){
+         static const auto * kernels = memoryTVLKernels( bestTVLTarget( ) );
+         kernels->memcpy( to, from, bytes );
+      }
+   } // namespace detail
+
+} // namespace facebook::velox::common
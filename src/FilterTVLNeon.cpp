@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifdef NEON
+// Advanced SIMD is part of the armv8 baseline, no target switch is needed.
+#include "FilterTVLDispatch-inl.h"
+
+namespace facebook::velox::common::detail{
+   std::unique_ptr< FilterTVLKernel > createFilterTVLKernelNeon( const std::vector< int64_t > & values, bool nullAllowed ){
+      return createFilterTVLKernelFor< tvl::simd< int64_t, tvl::neon >, TVLTarget::kNeon >( values, nullAllowed );
+   }
+
+   std::unique_ptr< FilterTVLKernel > createFilterTVLKernelNeon( const BigintValuesBuilder & builder, bool nullAllowed ){
+      return createFilterTVLKernelFor< tvl::simd< int64_t, tvl::neon >, TVLTarget::kNeon >( builder, nullAllowed );
+   }
+
+   std::unique_ptr< FilterTVLKernel > createBetweenNotInTVLKernelNeon( int64_t lower, int64_t upper, const std::vector< int64_t > & excluded, bool fused ){
+      return createBetweenNotInTVLKernelFor< tvl::simd< int64_t, tvl::neon >, TVLTarget::kNeon >( lower, upper, excluded, fused );
+   }
+
+   std::unique_ptr< FilterTVLKernel > createConjunctsTVLKernelNeon( const std::vector< TVLConjunct > & conjuncts, bool adaptive ){
+      return createConjunctsTVLKernelFor< tvl::simd< int64_t, tvl::neon >, TVLTarget::kNeon >( conjuncts, adaptive );
+   }
+
+   const HashTVLKernels & hashTVLKernelsNeon( ){
+      return hashTVLKernelsFor< tvl::simd< int64_t, tvl::neon > >( );
+   }
+
+   const BitsTVLKernels & bitsTVLKernelsNeon( ){
+      return bitsTVLKernelsFor< tvl::simd< int64_t, tvl::neon > >( );
+   }
+
+   const MemoryTVLKernels & memoryTVLKernelsNeon( ){
+      return memoryTVLKernelsFor< tvl::simd< int64_t, tvl::neon > >( );
+   }
+} // namespace facebook::velox::common::detail
+#endif
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NEON
+// Headers shared with other translation units go before TVL_TARGET_PUSH.
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+#include <immintrin.h>
+
+#include "BigintValuesBuilder.h"
+#include "FilterMisc.h"
+#include "FilterTVLDispatch.h"
+
+TVL_TARGET_PUSH( "sse4.2,popcnt" )
+#include "FilterTVLDispatch-inl.h"
+
+namespace facebook::velox::common::detail{
+   std::unique_ptr< FilterTVLKernel > createFilterTVLKernelSse( const std::vector< int64_t > & values, bool nullAllowed ){
+      return createFilterTVLKernelFor< tvl::simd< int64_t, tvl::sse >, TVLTarget::kSse >( values, nullAllowed );
+   }
+
+   std::unique_ptr< FilterTVLKernel > createFilterTVLKernelSse( const BigintValuesBuilder & builder, bool nullAllowed ){
+      return createFilterTVLKernelFor< tvl::simd< int64_t, tvl::sse >, TVLTarget::kSse >( builder, nullAllowed );
+   }
+
+   std::unique_ptr< FilterTVLKernel > createBetweenNotInTVLKernelSse( int64_t lower, int64_t upper, const std::vector< int64_t > & excluded, bool fused ){
+      return createBetweenNotInTVLKernelFor< tvl::simd< int64_t, tvl::sse >, TVLTarget::kSse >( lower, upper, excluded, fused );
+   }
+
+   std::unique_ptr< FilterTVLKernel > createConjunctsTVLKernelSse( const std::vector< TVLConjunct > & conjuncts, bool adaptive ){
+      return createConjunctsTVLKernelFor< tvl::simd< int64_t, tvl::sse >, TVLTarget::kSse >( conjuncts, adaptive );
+   }
+
+   const HashTVLKernels & hashTVLKernelsSse( ){
+      return hashTVLKernelsFor< tvl::simd< int64_t, tvl::sse > >( );
+   }
+
+   const BitsTVLKernels & bitsTVLKernelsSse( ){
+      return bitsTVLKernelsFor< tvl::simd< int64_t, tvl::sse > >( );
+   }
+
+   const MemoryTVLKernels & memoryTVLKernelsSse( ){
+      return memoryTVLKernelsFor< tvl::simd< int64_t, tvl::sse > >( );
+   }
+} // namespace facebook::velox::common::detail
+TVL_TARGET_POP( )
+#endif
@@ -28,9 +28,17 @@
 
 constexpr const char* kProcSelfCmdline = "/proc/self/cmdline";
 
-DECLARE_bool(avx2); // Enables use of AVX2 when available NOLINT
+DEFINE_bool(avx2, true, "Enables use of AVX2 when available"); // NOLINT
 
-DECLARE_bool(bmi2); // Enables use of BMI2 when available NOLINT
+DEFINE_bool(avx512, true, "Enables use of AVX-512 when available"); // NOLINT
+
+DEFINE_bool(bmi2, true, "Enables use of BMI2 when available"); // NOLINT
+
+DEFINE_bool(
+    tvl_avx512_256,
+    false,
+    "Runs the AVX-512 TVL kernels at 256 bits (AVX-512VL), which avoids the "
+    "512-bit frequency drop on Skylake and Cascade Lake"); // NOLINT
 
 namespace facebook {
 namespace velox {
@@ -105,23 +113,49 @@ uint64_t threadCpuNanos() {
   return ts.tv_sec * 1'000'000'000 + ts.tv_nsec;
 }
 
+int64_t lastLevelCacheBytes() {
+  for (auto name : {_SC_LEVEL3_CACHE_SIZE, _SC_LEVEL2_CACHE_SIZE}) {
+    auto bytes = sysconf(name);
+    if (bytes > 0) {
+      return bytes;
+    }
+  }
+  return 0;
+}
+
 namespace {
+// The TVL backends are compiled with POPCNT, the avx2 and avx512 ones with
+// BMI1 and BMI2 too. These are checked from the CPU bits, independent of
+// --bmi2, which only controls the explicit BMI2 paths.
+bool popcntCpuFlag = folly::CpuId().popcnt();
+bool sse42CpuFlag = folly::CpuId().sse42() && popcntCpuFlag;
 bool bmi2CpuFlag = folly::CpuId().bmi2();
-bool avx2CpuFlag = folly::CpuId().avx2();
+bool avx2CpuFlag = folly::CpuId().avx2() && folly::CpuId().bmi1() &&
+    bmi2CpuFlag && popcntCpuFlag;
+// The subset the avx512 TVL backend is compiled for (Skylake-SP and later).
+bool avx512CpuFlag = folly::CpuId().avx512f() && folly::CpuId().avx512vl() &&
+    folly::CpuId().avx512dq() && folly::CpuId().avx512bw() &&
+    folly::CpuId().avx512cd();
 } // namespace
 
+bool hasSse42() {
+  return sse42CpuFlag;
+}
+
 bool hasAvx2() {
-//  return avx2CpuFlag && FLAGS_avx2;
-   return false;
+  return avx2CpuFlag && FLAGS_avx2;
+}
+
+bool hasAvx512() {
+  return avx512CpuFlag && avx2CpuFlag && FLAGS_avx512 && FLAGS_avx2;
 }
 
 bool hasBmi2() {
-#ifdef NEON
-   return false;
-#else
-   return true;
-#endif
-//  return bmi2CpuFlag && FLAGS_bmi2;
+  return bmi2CpuFlag && FLAGS_bmi2;
+}
+
+bool preferAvx512VL() {
+  return FLAGS_tvl_avx512_256;
 }
 
 } // namespace process
@@ -0,0 +1,521 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "RowSet.h"
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+
+#include "BitUtil.h"
+
+namespace facebook::velox::common{
+
+   namespace{
+      constexpr int32_t kChunkWords = RowSet::kChunkRows / 64;
+
+      using Words = std::array< uint64_t, kChunkWords >;
+
+      // Returns the number of runs of set bits, or 'limit' if there are at
+      // least that many. A run starts at every set bit whose lower neighbour
+      // is clear. Checking the limit every 64 words stops early on the chunks
+      // of mid selectivity, where runs never win.
+      int32_t countRuns( const uint64_t * words, int32_t limit ){
+         constexpr int32_t kCheckWords = 64;
+         uint64_t previous = 0;
+         int32_t runs = 0;
+         for( int32_t i = 0; i < kChunkWords && runs < limit; i += kCheckWords )
+            {
+               for( int32_t j = i; j < i+kCheckWords; ++j )
+                  {
+                     runs += __builtin_popcountll( words[ j ]&~( ( words[ j ]<<1 )|( previous>>63 ) ) );
+                     previous = words[ j ];
+                  }
+            }
+         return std::min( runs, limit );
+      }
+
+      // Clears the bits in [begin, end) and returns how many were set. The
+      // gaps between runs are mostly within a word, which this handles
+      // without the generic range loops.
+      int32_t clearBits( uint64_t * words, int32_t begin, int32_t end ){
+         int32_t const first = begin / 64;
+         int32_t const last = ( end-1 ) / 64;
+         uint64_t const firstMask = ~0ULL<<( begin % 64 );
+         uint64_t const lastMask = ~0ULL>>( 63-( end-1 ) % 64 );
+         if( first == last )
+            {
+               int32_t const cleared = __builtin_popcountll( words[ first ]&firstMask&lastMask );
+               words[ first ] &= ~( firstMask&lastMask );
+               return cleared;
+            }
+         int32_t cleared = __builtin_popcountll( words[ first ]&firstMask )+__builtin_popcountll( words[ last ]&lastMask );
+         words[ first ] &= ~firstMask;
+         words[ last ] &= ~lastMask;
+         for( int32_t word = first+1; word < last; ++word )
+            {
+               cleared += __builtin_popcountll( words[ word ] );
+               words[ word ] = 0;
+            }
+         return cleared;
+      }
+
+      // Returns the first clear bit at or after 'offset', kChunkRows if none.
+      int32_t nextClearBit( const uint64_t * words, int32_t offset ){
+         for( int32_t word = offset / 64; word < kChunkWords; ++word )
+            {
+               uint64_t clear = ~words[ word ];
+               if( word == offset / 64 )
+                  {
+                     clear &= ~0ULL<<( offset % 64 );
+                  }
+               if( clear != 0 )
+                  {
+                     return word*64+__builtin_ctzll( clear );
+                  }
+            }
+         return RowSet::kChunkRows;
+      }
+   } // namespace
+
+   RowSet::Chunk RowSet::fromWords( int64_t key, const uint64_t * words ){
+      return fromWords( key, words, bits::countBits( words, 0, kChunkRows ) );
+   }
+
+   RowSet::Chunk RowSet::fromWords( int64_t key, const uint64_t * words, int32_t count ){
+      Chunk chunk{ key, Kind::kBitmap, count, { }, { } };
+      if( chunk.count == 0 )
+         {
+            return chunk;
+         }
+      int64_t const arrayBytes = chunk.count <= kMaxArrayRows ? sizeof( uint16_t )*chunk.count : sizeof( Words );
+      // Rounded up so that hitting the limit rules runs out.
+      int32_t const maxRuns = ( arrayBytes+2*sizeof( uint16_t )-1 ) / ( 2*sizeof( uint16_t ) );
+      int64_t const runBytes = 2*sizeof( uint16_t )*countRuns( words, maxRuns );
+      if( runBytes < arrayBytes )
+         {
+            chunk.kind = Kind::kRun;
+            chunk.values.reserve( runBytes / sizeof( uint16_t ) );
+            for( int32_t first = bits::findFirstBit( words, 0, kChunkRows ); first >= 0; )
+               {
+                  int32_t const end = nextClearBit( words, first );
+                  chunk.values.push_back( first );
+                  chunk.values.push_back( end-1 );
+                  first = end < kChunkRows ? bits::findFirstBit( words, end, kChunkRows ) : -1;
+               }
+         }
+      else if( chunk.count <= kMaxArrayRows )
+         {
+            // toIndices needs room for every bit of its range, so the chunk
+            // goes through in slices just wide enough for the TVL kernels.
+            std::array< int32_t, bits::kMinTVLBits > offsets;
+            chunk.kind = Kind::kArray;
+            chunk.values.reserve( chunk.count );
+            for( int32_t begin = 0; begin < kChunkRows; begin += offsets.size( ) )
+               {
+                  auto const count = bits::toIndices( words, begin, begin+offsets.size( ), offsets.data( ) );
+                  chunk.values.insert( chunk.values.end( ), offsets.begin( ), offsets.begin( )+count );
+               }
+         }
+      else
+         {
+            chunk.bits.assign( words, words+kChunkWords );
+         }
+      return chunk;
+   }
+
+   void RowSet::toWords( const Chunk & chunk, uint64_t * words ){
+      switch( chunk.kind )
+         {
+            case Kind::kBitmap:
+               std::copy( chunk.bits.begin( ), chunk.bits.end( ), words );
+               return;
+            case Kind::kArray:
+               std::fill( words, words+kChunkWords, 0 );
+               for( auto offset : chunk.values )
+                  {
+                     bits::setBit( words, offset );
+                  }
+               return;
+            case Kind::kRun:
+               std::fill( words, words+kChunkWords, 0 );
+               for( size_t i = 0; i < chunk.values.size( ); i += 2 )
+                  {
+                     bits::fillBits( words, chunk.values[ i ], chunk.values[ i+1 ]+1, true );
+                  }
+               return;
+         }
+   }
+
+   bool RowSet::containsOffset( const Chunk & chunk, uint16_t offset ){
+      switch( chunk.kind )
+         {
+            case Kind::kBitmap:
+               return bits::isBitSet( chunk.bits.data( ), offset );
+            case Kind::kArray:
+               return std::binary_search( chunk.values.begin( ), chunk.values.end( ), offset );
+            case Kind::kRun:
+               {
+                  // The last pair whose first offset is <= offset.
+                  size_t low = 0;
+                  size_t high = chunk.values.size( ) / 2;
+                  while( low < high )
+                     {
+                        auto const middle = ( low+high ) / 2;
+                        if( chunk.values[ 2*middle ] <= offset )
+                           {
+                              low = middle+1;
+                           }
+                        else
+                           {
+                              high = middle;
+                           }
+                     }
+                  return low > 0 && chunk.values[ 2*low-1 ] >= offset;
+               }
+         }
+      return false;
+   }
+
+   RowSet::Chunk RowSet::intersect( const Chunk & left, const Chunk & right ){
+      if( left.kind == Kind::kArray || right.kind == Kind::kArray )
+         {
+            auto const & array = left.kind == Kind::kArray ? left : right;
+            auto const & other = left.kind == Kind::kArray ? right : left;
+            Chunk result{ left.key, Kind::kArray, 0, { }, { } };
+            if( other.kind == Kind::kArray )
+               {
+                  std::set_intersection(
+                     array.values.begin( ), array.values.end( ), other.values.begin( ), other.values.end( ), std::back_inserter( result.values )
+                  );
+               }
+            else
+               {
+                  for( auto offset : array.values )
+                     {
+                        if( containsOffset( other, offset ) )
+                           {
+                              result.values.push_back( offset );
+                           }
+                     }
+               }
+            result.count = result.values.size( );
+            return result;
+         }
+      if( left.kind == Kind::kRun && right.kind == Kind::kRun )
+         {
+            return intersectRuns( left, right );
+         }
+      Words words;
+      if( left.kind == Kind::kBitmap && right.kind == Kind::kBitmap )
+         {
+            bits::andBits( words.data( ), left.bits.data( ), right.bits.data( ), 0, kChunkRows );
+            return fromWords( left.key, words.data( ) );
+         }
+      // A bitmap and runs: the bitmap with the gaps between the runs cleared.
+      // The gaps are few where runs pay off, so their bits are subtracted
+      // from the count instead of counting the result again.
+      auto const & bitmap = left.kind == Kind::kBitmap ? left : right;
+      auto const & runs = left.kind == Kind::kBitmap ? right : left;
+      Chunk result{ left.key, Kind::kBitmap, bitmap.count, { }, bitmap.bits };
+      int32_t gapBegin = 0;
+      for( size_t i = 0; i <= runs.values.size( ); i += 2 )
+         {
+            int32_t const gapEnd = i < runs.values.size( ) ? runs.values[ i ] : kChunkRows;
+            if( gapBegin < gapEnd )
+               {
+                  result.count -= clearBits( result.bits.data( ), gapBegin, gapEnd );
+               }
+            gapBegin = i < runs.values.size( ) ? runs.values[ i+1 ]+1 : kChunkRows;
+         }
+      // Too many rows for an array and too many runs for a run list: the
+      // bitmap is kept as is instead of being copied into a new chunk.
+      constexpr int32_t kMaxBitmapRuns = sizeof( Words ) / ( 2*sizeof( uint16_t ) );
+      if( result.count <= kMaxArrayRows || countRuns( result.bits.data( ), kMaxBitmapRuns ) < kMaxBitmapRuns )
+         {
+            return fromWords( left.key, result.bits.data( ), result.count );
+         }
+      return result;
+   }
+
+   RowSet::Chunk RowSet::intersectRuns( const Chunk & left, const Chunk & right ){
+      Chunk result{ left.key, Kind::kRun, 0, { }, { } };
+      auto const & l = left.values;
+      auto const & r = right.values;
+      for( size_t i = 0, j = 0; i < l.size( ) && j < r.size( ); )
+         {
+            auto const first = std::max( l[ i ], r[ j ] );
+            auto const last = std::min( l[ i+1 ], r[ j+1 ] );
+            if( first <= last )
+               {
+                  result.values.push_back( first );
+                  result.values.push_back( last );
+                  result.count += last-first+1;
+               }
+            l[ i+1 ] < r[ j+1 ] ? ( i += 2 ) : ( j += 2 );
+         }
+      // The overlaps of two run lists are rarely larger than an array or a
+      // bitmap of the same rows, but may be.
+      return encodeRuns( std::move( result ) );
+   }
+
+   RowSet::Chunk RowSet::encodeRuns( Chunk chunk ){
+      int64_t const runBytes = sizeof( uint16_t )*chunk.values.size( );
+      if( chunk.count <= kMaxArrayRows && sizeof( uint16_t )*chunk.count <= runBytes )
+         {
+            std::vector< uint16_t > offsets;
+            offsets.reserve( chunk.count );
+            for( size_t i = 0; i < chunk.values.size( ); i += 2 )
+               {
+                  for( int32_t offset = chunk.values[ i ]; offset <= chunk.values[ i+1 ]; ++offset )
+                     {
+                        offsets.push_back( offset );
+                     }
+               }
+            chunk.kind = Kind::kArray;
+            chunk.values = std::move( offsets );
+         }
+      else if( chunk.count > kMaxArrayRows && runBytes >= static_cast< int64_t >( sizeof( Words ) ) )
+         {
+            Words words;
+            toWords( chunk, words.data( ) );
+            chunk.kind = Kind::kBitmap;
+            chunk.values.clear( );
+            chunk.bits.assign( words.begin( ), words.end( ) );
+         }
+      return chunk;
+   }
+
+   RowSet::Chunk RowSet::unite( const Chunk & left, const Chunk & right ){
+      if( left.kind == Kind::kArray && right.kind == Kind::kArray && left.count+right.count <= kMaxArrayRows )
+         {
+            Chunk result{ left.key, Kind::kArray, 0, { }, { } };
+            std::set_union(
+               left.values.begin( ), left.values.end( ), right.values.begin( ), right.values.end( ), std::back_inserter( result.values )
+            );
+            result.count = result.values.size( );
+            return result;
+         }
+      if( left.kind != Kind::kBitmap && right.kind != Kind::kBitmap )
+         {
+            return uniteRuns( left, right );
+         }
+      Words words;
+      if( left.kind == Kind::kBitmap && right.kind == Kind::kBitmap )
+         {
+            bits::orBits( words.data( ), left.bits.data( ), right.bits.data( ), 0, kChunkRows );
+            return fromWords( left.key, words.data( ) );
+         }
+      // A bitmap and runs or an array: the bitmap with their rows set.
+      auto const & bitmap = left.kind == Kind::kBitmap ? left : right;
+      auto const & other = left.kind == Kind::kBitmap ? right : left;
+      std::copy( bitmap.bits.begin( ), bitmap.bits.end( ), words.begin( ) );
+      for( size_t i = 0; i < other.values.size( ); i += other.kind == Kind::kRun ? 2 : 1 )
+         {
+            if( other.kind == Kind::kRun )
+               {
+                  bits::fillBits( words.data( ), other.values[ i ], other.values[ i+1 ]+1, true );
+               }
+            else
+               {
+                  bits::setBit( words.data( ), other.values[ i ] );
+               }
+         }
+      return fromWords( left.key, words.data( ) );
+   }
+
+   RowSet::Chunk RowSet::uniteRuns( const Chunk & left, const Chunk & right ){
+      Chunk result{ left.key, Kind::kRun, 0, { }, { } };
+      // Appends [first, last], joining it to the last run if they overlap or
+      // touch. The runs come sorted by their first row.
+      auto append = [ & ]( int32_t first, int32_t last ){
+         if( !result.values.empty( ) && first <= result.values.back( )+1 )
+            {
+               if( last > result.values.back( ) )
+                  {
+                     result.count += last-result.values.back( );
+                     result.values.back( ) = last;
+                  }
+               return;
+            }
+         result.values.push_back( first );
+         result.values.push_back( last );
+         result.count += last-first+1;
+      };
+      auto const & l = left.values;
+      auto const & r = right.values;
+      size_t const lStep = left.kind == Kind::kRun ? 2 : 1;
+      size_t const rStep = right.kind == Kind::kRun ? 2 : 1;
+      for( size_t i = 0, j = 0; i < l.size( ) || j < r.size( ); )
+         {
+            if( j == r.size( ) || ( i < l.size( ) && l[ i ] <= r[ j ] ) )
+               {
+                  append( l[ i ], l[ i+lStep-1 ] );
+                  i += lStep;
+               }
+            else
+               {
+                  append( r[ j ], r[ j+rStep-1 ] );
+                  j += rStep;
+               }
+         }
+      return encodeRuns( std::move( result ) );
+   }
+
+   RowSet RowSet::fromBits( const uint64_t * bits, int64_t begin, int64_t numRows ){
+      RowSet result;
+      int64_t const end = begin+numRows;
+      Words words;
+      for( int64_t key = begin>>kChunkBits; numRows > 0 && key <= ( end-1 )>>kChunkBits; ++key )
+         {
+            int64_t const chunkBegin = key<<kChunkBits;
+            int64_t const from = std::max( begin, chunkBegin );
+            int64_t const to = std::min( end, chunkBegin+kChunkRows );
+            words.fill( 0 );
+            bits::copyBits( bits, from-begin, words.data( ), from-chunkBegin, to-from );
+            auto chunk = fromWords( key, words.data( ) );
+            if( chunk.count > 0 )
+               {
+                  result.chunks_.push_back( std::move( chunk ) );
+               }
+         }
+      return result;
+   }
+
+   RowSet RowSet::fromRange( int64_t begin, int64_t end ){
+      RowSet result;
+      for( int64_t key = begin>>kChunkBits; begin < end && key <= ( end-1 )>>kChunkBits; ++key )
+         {
+            int64_t const chunkBegin = key<<kChunkBits;
+            int64_t const from = std::max( begin, chunkBegin );
+            int64_t const to = std::min( end, chunkBegin+kChunkRows );
+            Chunk chunk{ key, Kind::kRun, static_cast< int32_t >( to-from ), { }, { } };
+            chunk.values = { static_cast< uint16_t >( from-chunkBegin ), static_cast< uint16_t >( to-1-chunkBegin ) };
+            result.chunks_.push_back( std::move( chunk ) );
+         }
+      return result;
+   }
+
+   RowSet RowSet::intersect( const RowSet & left, const RowSet & right ){
+      RowSet result;
+      auto l = left.chunks_.begin( );
+      auto r = right.chunks_.begin( );
+      while( l != left.chunks_.end( ) && r != right.chunks_.end( ) )
+         {
+            if( l->key != r->key )
+               {
+                  l->key < r->key ? ++l : ++r;
+                  continue;
+               }
+            auto chunk = intersect( *l++, *r++ );
+            if( chunk.count > 0 )
+               {
+                  result.chunks_.push_back( std::move( chunk ) );
+               }
+         }
+      return result;
+   }
+
+   RowSet RowSet::unite( const RowSet & left, const RowSet & right ){
+      RowSet result;
+      auto l = left.chunks_.begin( );
+      auto r = right.chunks_.begin( );
+      while( l != left.chunks_.end( ) || r != right.chunks_.end( ) )
+         {
+            if( r == right.chunks_.end( ) || ( l != left.chunks_.end( ) && l->key < r->key ) )
+               {
+                  result.chunks_.push_back( *l++ );
+               }
+            else if( l == left.chunks_.end( ) || r->key < l->key )
+               {
+                  result.chunks_.push_back( *r++ );
+               }
+            else
+               {
+                  result.chunks_.push_back( unite( *l++, *r++ ) );
+               }
+         }
+      return result;
+   }
+
+   int64_t RowSet::count( ) const{
+      int64_t count = 0;
+      for( auto & chunk : chunks_ )
+         {
+            count += chunk.count;
+         }
+      return count;
+   }
+
+   size_t RowSet::lowerBound( int64_t key ) const{
+      return std::lower_bound(
+         chunks_.begin( ), chunks_.end( ), key, []( const Chunk & chunk, int64_t key ){
+            return chunk.key < key;
+         }
+      )-chunks_.begin( );
+   }
+
+   bool RowSet::contains( int64_t row ) const{
+      auto const index = lowerBound( row>>kChunkBits );
+      return index < chunks_.size( ) && chunks_[ index ].key == row>>kChunkBits && containsOffset( chunks_[ index ], row&( kChunkRows-1 ) );
+   }
+
+   void RowSet::toBits( int64_t begin, int32_t numRows, uint64_t * bits ) const{
+      std::fill( bits, bits+bits::nwords( numRows ), 0 );
+      int64_t const end = begin+numRows;
+      for( auto index = lowerBound( begin>>kChunkBits ); index < chunks_.size( ) && chunks_[ index ].key<<kChunkBits < end; ++index )
+         {
+            auto const & chunk = chunks_[ index ];
+            int64_t const chunkBegin = chunk.key<<kChunkBits;
+            int64_t const from = std::max( begin, chunkBegin );
+            int64_t const to = std::min( end, chunkBegin+kChunkRows );
+            switch( chunk.kind )
+               {
+                  case Kind::kBitmap:
+                     bits::copyBits( chunk.bits.data( ), from-chunkBegin, bits, from-begin, to-from );
+                     break;
+                  case Kind::kArray:
+                     for( auto it = std::lower_bound( chunk.values.begin( ), chunk.values.end( ), from-chunkBegin );
+                          it != chunk.values.end( ) && chunkBegin+*it < to; ++it )
+                        {
+                           bits::setBit( bits, chunkBegin+*it-begin );
+                        }
+                     break;
+                  case Kind::kRun:
+                     for( size_t i = 0; i < chunk.values.size( ); i += 2 )
+                        {
+                           auto const first = std::max( from, chunkBegin+chunk.values[ i ] );
+                           auto const last = std::min( to, chunkBegin+chunk.values[ i+1 ]+1 );
+                           if( first < last )
+                              {
+                                 bits::fillBits( bits, first-begin, last-begin, true );
+                              }
+                        }
+                     break;
+               }
+         }
+   }
+
+   int64_t RowSet::bytes( ) const{
+      int64_t bytes = chunks_.capacity( )*sizeof( Chunk );
+      for( auto & chunk : chunks_ )
+         {
+            bytes += chunk.values.capacity( )*sizeof( uint16_t )+chunk.bits.capacity( )*sizeof( uint64_t );
+         }
+      return bytes;
+   }
+
+} // namespace facebook::velox::common